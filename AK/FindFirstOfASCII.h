@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Array.h>
+#include <AK/Assertions.h>
+#include <AK/BitCast.h>
+#include <AK/Optional.h>
+#include <AK/SIMD.h>
+#include <AK/SIMDExtras.h>
+#include <AK/Span.h>
+#include <AK/StdLibExtras.h>
+#include <AK/Types.h>
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpsabi"
+
+namespace AK {
+
+// Returns the index of the first code unit at or after `offset` that is one of the given ASCII characters. Up to four
+// needles are compared against a whole vector of code units at a time.
+template<typename CodeUnit>
+requires(sizeof(CodeUnit) <= 2)
+Optional<size_t> find_first_of_ascii(ReadonlySpan<CodeUnit> haystack, size_t offset, ReadonlySpan<char> needles)
+{
+    using UnsignedCodeUnit = Conditional<sizeof(CodeUnit) == 1, u8, u16>;
+    using VectorType = Conditional<sizeof(CodeUnit) == 1, SIMD::u8x16, SIMD::u16x8>;
+    constexpr size_t code_units_per_vector = SIMD::vector_length<VectorType>;
+
+    VERIFY(!needles.is_empty() && needles.size() <= 4);
+
+    Array<VectorType, 4> splatted_needles {};
+    for (size_t i = 0; i < needles.size(); ++i) {
+        for (size_t lane = 0; lane < code_units_per_vector; ++lane)
+            splatted_needles[i][lane] = static_cast<UnsignedCodeUnit>(needles[i]);
+    }
+
+    auto is_needle = [&](CodeUnit code_unit) {
+        for (auto needle : needles) {
+            if (static_cast<UnsignedCodeUnit>(code_unit) == static_cast<UnsignedCodeUnit>(needle))
+                return true;
+        }
+        return false;
+    };
+
+    auto const* data = haystack.data();
+    size_t i = offset;
+    for (; i + code_units_per_vector <= haystack.size(); i += code_units_per_vector) {
+        auto chunk = SIMD::load_unaligned<VectorType>(data + i);
+        VectorType hits {};
+        for (size_t needle = 0; needle < needles.size(); ++needle)
+            hits |= bit_cast<VectorType>(chunk == splatted_needles[needle]);
+
+        auto hit_words = bit_cast<SIMD::u64x2>(hits);
+        if ((hit_words[0] | hit_words[1]) == 0)
+            continue;
+
+        for (size_t lane = 0; lane < code_units_per_vector; ++lane) {
+            if (hits[lane] != 0)
+                return i + lane;
+        }
+    }
+
+    for (; i < haystack.size(); ++i) {
+        if (is_needle(data[i]))
+            return i;
+    }
+
+    return {};
+}
+
+}
+
+#pragma GCC diagnostic pop
+
+#if USING_AK_GLOBALLY
+using AK::find_first_of_ascii;
+#endif
@@ -98,14 +98,26 @@ static ErrorOr<void> decode_avif_header(AVIFLoadingContext& context)
     return {};
 }
 
-static ErrorOr<void> decode_avif_image(AVIFLoadingContext& context)
+static ErrorOr<void> decode_avif_image(AVIFLoadingContext& context, Optional<IntSize> ideal_size)
 {
     VERIFY(context.state >= AVIFLoadingContext::State::HeaderDecoded);
 
     avifRGBImage rgb;
     while (avifDecoderNextImage(context.decoder) == AVIF_RESULT_OK) {
+        auto size = context.size.value();
+
+        // NOTE: Scaling the YUV planes down before converting them to RGB saves the conversion most of its work. We only
+        //       do this for still images, so that we don't replace planes the decoder may still need for later frames.
+        if (context.image_count == 1) {
+            size = size_to_decode_at(size, ideal_size);
+            if (size != context.size.value()) {
+                if (avifImageScale(context.decoder->image, size.width(), size.height(), &context.decoder->diag) != AVIF_RESULT_OK)
+                    return Error::from_string_literal("Failed to scale AVIF image");
+            }
+        }
+
         auto bitmap_format = context.has_alpha ? BitmapFormat::BGRA8888 : BitmapFormat::BGRx8888;
-        auto bitmap = TRY(Bitmap::create(bitmap_format, context.size.value()));
+        auto bitmap = TRY(Bitmap::create(bitmap_format, size));
 
         avifRGBImageSetDefaults(&rgb, context.decoder->image);
         rgb.pixels = bitmap->scanline_u8(0);
@@ -168,7 +180,7 @@ size_t AVIFImageDecoderPlugin::first_animated_frame_index()
     return 0;
 }
 
-ErrorOr<ImageFrameDescriptor> AVIFImageDecoderPlugin::frame(size_t index, Optional<IntSize>)
+ErrorOr<ImageFrameDescriptor> AVIFImageDecoderPlugin::frame(size_t index, Optional<IntSize> ideal_size)
 {
     if (index >= frame_count())
         return Error::from_string_literal("AVIFImageDecoderPlugin: Invalid frame index");
@@ -177,7 +189,7 @@ ErrorOr<ImageFrameDescriptor> AVIFImageDecoderPlugin::frame(size_t index, Option
         return Error::from_string_literal("AVIFImageDecoderPlugin: Decoding failed");
 
     if (m_context->state < AVIFLoadingContext::State::BitmapDecoded) {
-        TRY(decode_avif_image(*m_context));
+        TRY(decode_avif_image(*m_context, ideal_size));
         m_context->state = AVIFLoadingContext::State::BitmapDecoded;
     }
 
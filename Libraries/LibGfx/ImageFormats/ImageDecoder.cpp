@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/Math.h>
 #include <LibGfx/ImageFormats/AVIFLoader.h>
 #include <LibGfx/ImageFormats/BMPLoader.h>
 #include <LibGfx/ImageFormats/GIFLoader.h>
@@ -47,6 +48,21 @@ static ErrorOr<OwnPtr<ImageDecoderPlugin>> probe_and_sniff_for_appropriate_plugi
     return OwnPtr<ImageDecoderPlugin> {};
 }
 
+IntSize size_to_decode_at(IntSize image_size, Optional<IntSize> ideal_size)
+{
+    if (!ideal_size.has_value() || ideal_size->is_empty() || image_size.is_empty())
+        return image_size;
+
+    auto scale = max(static_cast<double>(ideal_size->width()) / image_size.width(), static_cast<double>(ideal_size->height()) / image_size.height());
+    if (scale >= 1)
+        return image_size;
+
+    return {
+        clamp(static_cast<int>(AK::ceil(image_size.width() * scale)), 1, image_size.width()),
+        clamp(static_cast<int>(AK::ceil(image_size.height() * scale)), 1, image_size.height()),
+    };
+}
+
 ErrorOr<ColorSpace> ImageDecoder::color_space()
 {
     auto maybe_cicp = TRY(m_plugin->cicp());
@@ -67,6 +83,25 @@ ErrorOr<RefPtr<ImageDecoder>> ImageDecoder::try_create_for_raw_bytes(ReadonlyByt
     return RefPtr<ImageDecoder> {};
 }
 
+ErrorOr<OwnPtr<IncrementalImageDecoder>> IncrementalImageDecoder::try_create_for_format_of(ReadonlyBytes bytes)
+{
+    struct IncrementalDecoderInitializer {
+        bool (*sniff)(ReadonlyBytes) = nullptr;
+        ErrorOr<NonnullOwnPtr<IncrementalImageDecoder>> (*create)() = nullptr;
+    };
+
+    static constexpr IncrementalDecoderInitializer s_initializers[] = {
+        { JPEGImageDecoderPlugin::sniff, JPEGImageDecoderPlugin::create_incremental_decoder },
+        { PNGImageDecoderPlugin::sniff, PNGImageDecoderPlugin::create_incremental_decoder },
+    };
+
+    for (auto& initializer : s_initializers) {
+        if (initializer.sniff(bytes))
+            return TRY(initializer.create());
+    }
+    return OwnPtr<IncrementalImageDecoder> {};
+}
+
 ImageDecoder::ImageDecoder(NonnullOwnPtr<ImageDecoderPlugin> plugin)
     : m_plugin(move(plugin))
 {
@@ -83,6 +83,8 @@ public:
     virtual size_t frame_count() { return 1; }
     virtual size_t first_animated_frame_index() { return 0; }
 
+    // The ideal size is the size the frame is going to be displayed at. Plugins that can cheaply do so may decode the
+    // frame at a smaller size than that of the image, as long as it's no smaller than size_to_decode_at() returns.
     virtual ErrorOr<ImageFrameDescriptor> frame(size_t index, Optional<IntSize> ideal_size = {}) = 0;
 
     virtual Optional<Metadata const&> metadata() { return OptionalNone {}; }
@@ -98,6 +100,34 @@ protected:
     ImageDecoderPlugin() = default;
 };
 
+// The smallest size with the same aspect ratio as the image that still covers the ideal size, but no larger than the
+// image itself.
+IntSize size_to_decode_at(IntSize image_size, Optional<IntSize> ideal_size);
+
+// Decodes the first frame of an image as its data arrives, e.g. over the network, for the formats that can be shown
+// before all of it has. The decoder picks up where it left off whenever more data has arrived, so every piece of it is
+// only decoded once.
+class IncrementalImageDecoder {
+public:
+    // Returns null for formats that can't be shown in part.
+    static ErrorOr<OwnPtr<IncrementalImageDecoder>> try_create_for_format_of(ReadonlyBytes);
+
+    virtual ~IncrementalImageDecoder() = default;
+
+    // Decodes what it can of the data that has arrived so far, which starts with all of the data that was given before.
+    // NOTE: The decoder doesn't keep a reference to the data in between, so it may move elsewhere in memory as it grows.
+    virtual ErrorOr<void> decode_more(ReadonlyBytes data_so_far) = 0;
+
+    // What can be shown of the image so far, if anything. The parts of it that haven't arrived yet are transparent.
+    // NOTE: The decoder keeps drawing into this bitmap as more data arrives.
+    virtual RefPtr<Bitmap> bitmap() const = 0;
+
+    virtual ErrorOr<ColorSpace> color_space() const = 0;
+
+protected:
+    IncrementalImageDecoder() = default;
+};
+
 class ImageDecoder : public RefCounted<ImageDecoder> {
 public:
     static ErrorOr<RefPtr<ImageDecoder>> try_create_for_raw_bytes(ReadonlyBytes, Optional<ByteString> mime_type = {});
@@ -15,11 +15,15 @@ struct JPEGLoadingContext {
     enum class State {
         NotDecoded,
         Error,
+        HeaderDecoded,
         Decoded,
     };
 
     State state { State::NotDecoded };
 
+    IntSize size;
+    bool is_cmyk { false };
+
     RefPtr<Gfx::Bitmap> rgb_bitmap;
     RefPtr<Gfx::CMYKBitmap> cmyk_bitmap;
 
@@ -31,35 +35,27 @@ struct JPEGLoadingContext {
     {
     }
 
-    ErrorOr<void> decode();
+    ErrorOr<void> decode_header();
+    ErrorOr<void> decode(Optional<IntSize> ideal_size);
 };
 
 struct JPEGErrorManager : jpeg_error_mgr {
     jmp_buf setjmp_buffer {};
 };
 
-ErrorOr<void> JPEGLoadingContext::decode()
+static void set_up_error_manager(jpeg_decompress_struct& cinfo, JPEGErrorManager& jerr)
 {
-    struct jpeg_decompress_struct cinfo;
-    ScopeGuard guard { [&]() { jpeg_destroy_decompress(&cinfo); } };
-
-    struct JPEGErrorManager jerr;
     cinfo.err = jpeg_std_error(&jerr);
-
-    jpeg_source_mgr source_manager {};
-
-    if (setjmp(jerr.setjmp_buffer))
-        return Error::from_string_literal("Failed to decode JPEG");
-
     jerr.error_exit = [](j_common_ptr cinfo) {
         char buffer[JMSG_LENGTH_MAX];
         (*cinfo->err->format_message)(cinfo, buffer);
         dbgln("JPEG error: {}", buffer);
         longjmp(static_cast<JPEGErrorManager*>(cinfo->err)->setjmp_buffer, 1);
     };
+}
 
-    jpeg_create_decompress(&cinfo);
-
+static void set_up_source_manager(jpeg_decompress_struct& cinfo, jpeg_source_mgr& source_manager, ReadonlyBytes data)
+{
     source_manager.next_input_byte = data.data();
     source_manager.bytes_in_buffer = data.size();
     source_manager.init_source = [](j_decompress_ptr) { };
@@ -76,11 +72,79 @@ ErrorOr<void> JPEGLoadingContext::decode()
     source_manager.term_source = [](j_decompress_ptr) { };
 
     cinfo.src = &source_manager;
+}
+
+ErrorOr<void> JPEGLoadingContext::decode_header()
+{
+    struct jpeg_decompress_struct cinfo;
+    ScopeGuard guard { [&]() { jpeg_destroy_decompress(&cinfo); } };
+
+    struct JPEGErrorManager jerr;
+    set_up_error_manager(cinfo, jerr);
+
+    jpeg_source_mgr source_manager {};
+
+    if (setjmp(jerr.setjmp_buffer))
+        return Error::from_string_literal("Failed to decode JPEG header");
+
+    jpeg_create_decompress(&cinfo);
+    set_up_source_manager(cinfo, source_manager, data);
 
     jpeg_save_markers(&cinfo, JPEG_APP0 + 2, 0xFFFF);
     if (jpeg_read_header(&cinfo, TRUE) != JPEG_HEADER_OK)
         return Error::from_string_literal("Failed to read JPEG header");
 
+    size = { static_cast<int>(cinfo.image_width), static_cast<int>(cinfo.image_height) };
+    is_cmyk = cinfo.jpeg_color_space == JCS_CMYK || cinfo.jpeg_color_space == JCS_YCCK;
+
+    JOCTET* icc_data_ptr = nullptr;
+    unsigned int icc_data_length = 0;
+    if (jpeg_read_icc_profile(&cinfo, &icc_data_ptr, &icc_data_length)) {
+        icc_data.resize(icc_data_length);
+        memcpy(icc_data.data(), icc_data_ptr, icc_data_length);
+        free(icc_data_ptr);
+    }
+
+    return {};
+}
+
+// libjpeg-turbo can scale the image by M/8 while decoding it, which is a lot cheaper than decoding it at full size and
+// scaling it down afterwards. Pick the smallest such scale that still covers the ideal size.
+static void choose_scale_for_ideal_size(jpeg_decompress_struct& cinfo, Optional<IntSize> ideal_size)
+{
+    auto target_size = size_to_decode_at({ static_cast<int>(cinfo.image_width), static_cast<int>(cinfo.image_height) }, ideal_size);
+
+    for (unsigned int scale_num = 1; scale_num < 8; ++scale_num) {
+        if (ceil_div(cinfo.image_width * scale_num, 8u) >= static_cast<unsigned int>(target_size.width())
+            && ceil_div(cinfo.image_height * scale_num, 8u) >= static_cast<unsigned int>(target_size.height())) {
+            cinfo.scale_num = scale_num;
+            cinfo.scale_denom = 8;
+            return;
+        }
+    }
+}
+
+ErrorOr<void> JPEGLoadingContext::decode(Optional<IntSize> ideal_size)
+{
+    struct jpeg_decompress_struct cinfo;
+    ScopeGuard guard { [&]() { jpeg_destroy_decompress(&cinfo); } };
+
+    struct JPEGErrorManager jerr;
+    set_up_error_manager(cinfo, jerr);
+
+    jpeg_source_mgr source_manager {};
+
+    if (setjmp(jerr.setjmp_buffer))
+        return Error::from_string_literal("Failed to decode JPEG");
+
+    jpeg_create_decompress(&cinfo);
+    set_up_source_manager(cinfo, source_manager, data);
+
+    if (jpeg_read_header(&cinfo, TRUE) != JPEG_HEADER_OK)
+        return Error::from_string_literal("Failed to read JPEG header");
+
+    choose_scale_for_ideal_size(cinfo, ideal_size);
+
     if (cinfo.jpeg_color_space == JCS_CMYK) {
         cinfo.out_color_space = JCS_CMYK;
     } else if (cinfo.jpeg_color_space == JCS_YCCK) {
@@ -165,14 +229,6 @@ ErrorOr<void> JPEGLoadingContext::decode()
         }
     }
 
-    JOCTET* icc_data_ptr = nullptr;
-    unsigned int icc_data_length = 0;
-    if (jpeg_read_icc_profile(&cinfo, &icc_data_ptr, &icc_data_length)) {
-        icc_data.resize(icc_data_length);
-        memcpy(icc_data.data(), icc_data_ptr, icc_data_length);
-        free(icc_data_ptr);
-    }
-
     if (could_read_all_scanlines)
         jpeg_finish_decompress(&cinfo);
     else
@@ -191,18 +247,25 @@ JPEGImageDecoderPlugin::JPEGImageDecoderPlugin(NonnullOwnPtr<JPEGLoadingContext>
 
 JPEGImageDecoderPlugin::~JPEGImageDecoderPlugin() = default;
 
+static void ensure_header_decoded(JPEGLoadingContext& context)
+{
+    if (context.state != JPEGLoadingContext::State::NotDecoded)
+        return;
+
+    if (auto result = context.decode_header(); result.is_error()) {
+        context.state = JPEGLoadingContext::State::Error;
+        return;
+    }
+    context.state = JPEGLoadingContext::State::HeaderDecoded;
+}
+
 IntSize JPEGImageDecoderPlugin::size()
 {
-    if (m_context->state == JPEGLoadingContext::State::NotDecoded)
-        (void)frame(0);
+    ensure_header_decoded(*m_context);
 
     if (m_context->state == JPEGLoadingContext::State::Error)
         return {};
-    if (m_context->rgb_bitmap)
-        return m_context->rgb_bitmap->size();
-    if (m_context->cmyk_bitmap)
-        return m_context->cmyk_bitmap->size();
-    return {};
+    return m_context->size;
 }
 
 bool JPEGImageDecoderPlugin::sniff(ReadonlyBytes data)
@@ -218,16 +281,238 @@ ErrorOr<NonnullOwnPtr<ImageDecoderPlugin>> JPEGImageDecoderPlugin::create(Readon
     return adopt_own(*new JPEGImageDecoderPlugin(make<JPEGLoadingContext>(data)));
 }
 
-ErrorOr<ImageFrameDescriptor> JPEGImageDecoderPlugin::frame(size_t index, Optional<IntSize>)
+// Decodes a JPEG image as its data arrives, by having libjpeg suspend whenever it runs out of data, and resume from
+// there once there is more. Progressive images are decoded in libjpeg's buffered-image mode, which shows the latest scan
+// that has arrived of them.
+class JPEGIncrementalImageDecoder final : public IncrementalImageDecoder {
+public:
+    JPEGIncrementalImageDecoder()
+    {
+        set_up_error_manager(m_cinfo, m_error_manager);
+    }
+
+    virtual ~JPEGIncrementalImageDecoder() override
+    {
+        if (m_is_initialized)
+            jpeg_destroy_decompress(&m_cinfo);
+    }
+
+    virtual ErrorOr<void> decode_more(ReadonlyBytes data_so_far) override
+    {
+        if (m_phase == Phase::Error)
+            return Error::from_string_literal("JPEGIncrementalImageDecoder: Decoding failed");
+        if (m_phase == Phase::Done || m_phase == Phase::CannotShow)
+            return {};
+
+        VERIFY(data_so_far.size() >= m_consumed_size);
+
+        // NOTE: libjpeg may have asked us to skip over more data than had arrived when it last suspended.
+        auto skip = min(m_source_manager.bytes_to_skip, data_so_far.size() - m_consumed_size);
+        m_source_manager.bytes_to_skip -= skip;
+        m_consumed_size += skip;
+
+        m_source_manager.next_input_byte = data_so_far.offset_pointer(m_consumed_size);
+        m_source_manager.bytes_in_buffer = data_so_far.size() - m_consumed_size;
+
+        auto result = decode_available_data();
+        m_consumed_size = data_so_far.size() - m_source_manager.bytes_in_buffer;
+        if (result.is_error())
+            m_phase = Phase::Error;
+        return result;
+    }
+
+    virtual RefPtr<Bitmap> bitmap() const override
+    {
+        if (!m_has_decoded_rows)
+            return nullptr;
+        return m_bitmap;
+    }
+
+    virtual ErrorOr<ColorSpace> color_space() const override
+    {
+        if (m_icc_data.is_empty())
+            return ColorSpace {};
+        return ColorSpace::load_from_icc_bytes(m_icc_data);
+    }
+
+private:
+    enum class Phase {
+        ReadingHeader,
+        StartingDecompression,
+        StartingOutputPass,
+        ReadingScanlines,
+        FinishingOutputPass,
+        FinishingDecompression,
+        Done,
+        CannotShow,
+        Error,
+    };
+
+    struct SuspendingSourceManager : jpeg_source_mgr {
+        size_t bytes_to_skip { 0 };
+    };
+
+    ErrorOr<void> decode_available_data()
+    {
+        if (setjmp(m_error_manager.setjmp_buffer))
+            return Error::from_string_literal("JPEGIncrementalImageDecoder: Decoding failed");
+
+        if (!m_is_initialized) {
+            jpeg_create_decompress(&m_cinfo);
+            m_is_initialized = true;
+            set_up_suspending_source_manager();
+            jpeg_save_markers(&m_cinfo, JPEG_APP0 + 2, 0xFFFF);
+        }
+
+        // NOTE: Each libjpeg call below returns early if it runs out of data, and we call it again once more has arrived.
+        while (true) {
+            switch (m_phase) {
+            case Phase::ReadingHeader:
+                if (jpeg_read_header(&m_cinfo, TRUE) == JPEG_SUSPENDED)
+                    return {};
+                read_icc_data();
+
+                // NOTE: CMYK images are rare enough on the web that we only show them once all of their data has arrived.
+                if (m_cinfo.jpeg_color_space == JCS_CMYK || m_cinfo.jpeg_color_space == JCS_YCCK) {
+                    m_phase = Phase::CannotShow;
+                    return {};
+                }
+
+                // NOTE: The part of the image we have no data for is left transparent.
+                m_cinfo.out_color_space = JCS_EXT_BGRA;
+                m_cinfo.buffered_image = jpeg_has_multiple_scans(&m_cinfo);
+                m_phase = Phase::StartingDecompression;
+                break;
+
+            case Phase::StartingDecompression:
+                if (!jpeg_start_decompress(&m_cinfo))
+                    return {};
+                m_bitmap = TRY(Bitmap::create(BitmapFormat::BGRA8888, { static_cast<int>(m_cinfo.output_width), static_cast<int>(m_cinfo.output_height) }));
+                m_phase = m_cinfo.buffered_image ? Phase::StartingOutputPass : Phase::ReadingScanlines;
+                break;
+
+            case Phase::StartingOutputPass: {
+                // Take in all of the data that has arrived, and only show the latest scan of it. There's no point in
+                // showing another scan until the next one has started arriving.
+                int status;
+                do {
+                    status = jpeg_consume_input(&m_cinfo);
+                } while (status != JPEG_SUSPENDED && status != JPEG_REACHED_EOI);
+
+                if (!m_output_scan_number.has_value()) {
+                    // NOTE: Once all of the data has arrived, the last scan is shown once more, as it may not have been
+                    //       complete the last time around.
+                    auto input_is_complete = jpeg_input_complete(&m_cinfo);
+                    if (!input_is_complete && m_cinfo.input_scan_number <= m_cinfo.output_scan_number)
+                        return {};
+                    m_output_scan_number = m_cinfo.input_scan_number;
+                    m_is_final_output_pass = input_is_complete;
+                }
+                if (!jpeg_start_output(&m_cinfo, *m_output_scan_number))
+                    return {};
+                m_output_scan_number.clear();
+                m_phase = Phase::ReadingScanlines;
+                break;
+            }
+
+            case Phase::ReadingScanlines:
+                while (m_cinfo.output_scanline < m_cinfo.output_height) {
+                    auto* row = m_bitmap->scanline_u8(m_cinfo.output_scanline);
+                    if (jpeg_read_scanlines(&m_cinfo, &row, 1) == 0)
+                        return {};
+                    m_has_decoded_rows = true;
+                }
+                m_phase = m_cinfo.buffered_image ? Phase::FinishingOutputPass : Phase::FinishingDecompression;
+                break;
+
+            case Phase::FinishingOutputPass:
+                if (!jpeg_finish_output(&m_cinfo))
+                    return {};
+                m_phase = m_is_final_output_pass ? Phase::FinishingDecompression : Phase::StartingOutputPass;
+                break;
+
+            case Phase::FinishingDecompression:
+                if (!jpeg_finish_decompress(&m_cinfo))
+                    return {};
+                m_phase = Phase::Done;
+                return {};
+
+            case Phase::Done:
+            case Phase::CannotShow:
+            case Phase::Error:
+                return {};
+            }
+        }
+    }
+
+    void set_up_suspending_source_manager()
+    {
+        m_source_manager.init_source = [](j_decompress_ptr) { };
+
+        // NOTE: Returning false has libjpeg suspend and return to us, keeping whatever data it hasn't consumed yet.
+        m_source_manager.fill_input_buffer = [](j_decompress_ptr) -> boolean { return false; };
+        m_source_manager.skip_input_data = [](j_decompress_ptr context, long num_bytes) {
+            auto& source_manager = static_cast<SuspendingSourceManager&>(*context->src);
+            if (num_bytes <= 0)
+                return;
+            auto skip = min(static_cast<size_t>(num_bytes), source_manager.bytes_in_buffer);
+            source_manager.next_input_byte += skip;
+            source_manager.bytes_in_buffer -= skip;
+            source_manager.bytes_to_skip += static_cast<size_t>(num_bytes) - skip;
+        };
+        m_source_manager.resync_to_restart = jpeg_resync_to_restart;
+        m_source_manager.term_source = [](j_decompress_ptr) { };
+        m_cinfo.src = &m_source_manager;
+    }
+
+    void read_icc_data()
+    {
+        JOCTET* icc_data_ptr = nullptr;
+        unsigned int icc_data_length = 0;
+        if (jpeg_read_icc_profile(&m_cinfo, &icc_data_ptr, &icc_data_length)) {
+            m_icc_data.resize(icc_data_length);
+            memcpy(m_icc_data.data(), icc_data_ptr, icc_data_length);
+            free(icc_data_ptr);
+        }
+    }
+
+    jpeg_decompress_struct m_cinfo {};
+    JPEGErrorManager m_error_manager;
+    SuspendingSourceManager m_source_manager {};
+    bool m_is_initialized { false };
+
+    Phase m_phase { Phase::ReadingHeader };
+
+    // How much of the data libjpeg has consumed so far.
+    size_t m_consumed_size { 0 };
+
+    // The scan that we're waiting for jpeg_start_output() to be able to show, if it had to suspend.
+    Optional<int> m_output_scan_number;
+    bool m_is_final_output_pass { false };
+
+    RefPtr<Bitmap> m_bitmap;
+    bool m_has_decoded_rows { false };
+    Vector<u8> m_icc_data;
+};
+
+ErrorOr<NonnullOwnPtr<IncrementalImageDecoder>> JPEGImageDecoderPlugin::create_incremental_decoder()
+{
+    return adopt_nonnull_own_or_enomem(new (nothrow) JPEGIncrementalImageDecoder);
+}
+
+ErrorOr<ImageFrameDescriptor> JPEGImageDecoderPlugin::frame(size_t index, Optional<IntSize> ideal_size)
 {
     if (index > 0)
         return Error::from_string_literal("JPEGImageDecoderPlugin: Invalid frame index");
 
+    ensure_header_decoded(*m_context);
+
     if (m_context->state == JPEGLoadingContext::State::Error)
         return Error::from_string_literal("JPEGImageDecoderPlugin: Decoding failed");
 
+    // NOTE: Whichever size we decode the image at first is the one we stick with.
     if (m_context->state < JPEGLoadingContext::State::Decoded) {
-        if (auto result = m_context->decode(); result.is_error()) {
+        if (auto result = m_context->decode(ideal_size); result.is_error()) {
             m_context->state = JPEGLoadingContext::State::Error;
             return result.release_error();
         }
@@ -245,8 +530,7 @@ Optional<Metadata const&> JPEGImageDecoderPlugin::metadata()
 
 ErrorOr<Optional<ReadonlyBytes>> JPEGImageDecoderPlugin::icc_data()
 {
-    if (m_context->state == JPEGLoadingContext::State::NotDecoded)
-        (void)frame(0);
+    ensure_header_decoded(*m_context);
 
     if (!m_context->icc_data.is_empty())
         return m_context->icc_data;
@@ -255,10 +539,9 @@ ErrorOr<Optional<ReadonlyBytes>> JPEGImageDecoderPlugin::icc_data()
 
 NaturalFrameFormat JPEGImageDecoderPlugin::natural_frame_format() const
 {
-    if (m_context->state == JPEGLoadingContext::State::NotDecoded)
-        (void)const_cast<JPEGImageDecoderPlugin&>(*this).frame(0);
+    ensure_header_decoded(*m_context);
 
-    if (m_context->cmyk_bitmap)
+    if (m_context->is_cmyk)
         return NaturalFrameFormat::CMYK;
     return NaturalFrameFormat::RGB;
 }
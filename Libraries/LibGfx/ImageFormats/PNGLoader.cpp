@@ -37,6 +37,9 @@ struct PNGLoadingContext {
     ErrorOr<size_t> read_frames(png_structp, png_infop);
     ErrorOr<void> apply_exif_orientation();
 
+    ErrorOr<void> read_still_frame(Optional<IntSize> ideal_size);
+    ErrorOr<NonnullRefPtr<Bitmap>> read_rows_scaled_down(IntSize target_size);
+
     ErrorOr<void> read_all_frames()
     {
         // NOTE: We need to setjmp() here because libpng uses longjmp() for error handling.
@@ -59,6 +62,16 @@ ErrorOr<NonnullOwnPtr<ImageDecoderPlugin>> PNGImageDecoderPlugin::create(Readonl
     auto decoder = adopt_own(*new PNGImageDecoderPlugin(bytes));
     TRY(decoder->initialize());
 
+    // NOTE: Plain still images are only decoded once we're asked for their frame, as we may be able to scale them down
+    //       to the size they're going to be displayed at while decoding them.
+    u32 apng_frame_count = 0;
+    u32 apng_loop_count = 0;
+    bool is_apng = png_get_acTL(decoder->m_context->png_ptr, decoder->m_context->info_ptr, &apng_frame_count, &apng_loop_count) != 0;
+    if (!is_apng && !decoder->m_context->exif_metadata) {
+        decoder->m_context->frame_count = 1;
+        return decoder;
+    }
+
     auto result = decoder->m_context->read_all_frames();
     if (result.is_error()) {
         // NOTE: If we didn't fail in initialize(), that means we have size information.
@@ -104,8 +117,16 @@ size_t PNGImageDecoderPlugin::frame_count()
     return m_context->frame_count;
 }
 
-ErrorOr<ImageFrameDescriptor> PNGImageDecoderPlugin::frame(size_t index, Optional<IntSize>)
+ErrorOr<ImageFrameDescriptor> PNGImageDecoderPlugin::frame(size_t index, Optional<IntSize> ideal_size)
 {
+    if (m_context->frame_descriptors.is_empty()) {
+        if (m_context->read_still_frame(ideal_size).is_error()) {
+            // NOTE: Like for images we decode up front, fall back to a blank frame of the right size (see create()).
+            auto bitmap = TRY(Bitmap::create(BitmapFormat::BGRA8888, AlphaType::Premultiplied, m_context->size));
+            m_context->frame_descriptors.append({ move(bitmap), 0 });
+        }
+    }
+
     if (index >= m_context->frame_descriptors.size())
         return Error::from_errno(EINVAL);
 
@@ -135,6 +156,57 @@ static void log_png_warning(png_structp, char const* warning_message)
     dbgln("libpng warning: {}", warning_message);
 }
 
+// Has libpng hand us rows as 8-bit BGRA, whatever format the image is in.
+static void set_up_transformations(png_structp png_ptr, png_infop info_ptr)
+{
+    int bit_depth = png_get_bit_depth(png_ptr, info_ptr);
+    int color_type = png_get_color_type(png_ptr, info_ptr);
+
+    if (color_type == PNG_COLOR_TYPE_PALETTE)
+        png_set_palette_to_rgb(png_ptr);
+
+    if (color_type == PNG_COLOR_TYPE_GRAY && bit_depth < 8)
+        png_set_expand_gray_1_2_4_to_8(png_ptr);
+
+    if (png_get_valid(png_ptr, info_ptr, PNG_INFO_tRNS))
+        png_set_tRNS_to_alpha(png_ptr);
+
+    if (bit_depth == 16)
+        png_set_strip_16(png_ptr);
+
+    if (color_type == PNG_COLOR_TYPE_GRAY || color_type == PNG_COLOR_TYPE_GRAY_ALPHA)
+        png_set_gray_to_rgb(png_ptr);
+
+    if (png_get_interlace_type(png_ptr, info_ptr) != PNG_INTERLACE_NONE)
+        png_set_interlace_handling(png_ptr);
+
+    png_set_filler(png_ptr, 0xFF, PNG_FILLER_AFTER);
+    png_set_bgr(png_ptr);
+}
+
+static ErrorOr<void> read_color_space_info(png_structp png_ptr, png_infop info_ptr, Optional<Media::CodingIndependentCodePoints>& cicp, Optional<ByteBuffer>& icc_profile)
+{
+    png_byte color_primaries { 0 };
+    png_byte transfer_function { 0 };
+    png_byte matrix_coefficients { 0 };
+    png_byte video_full_range_flag { 0 };
+    if (png_get_cICP(png_ptr, info_ptr, &color_primaries, &transfer_function, &matrix_coefficients, &video_full_range_flag)) {
+        Media::ColorPrimaries cp { color_primaries };
+        Media::TransferCharacteristics tc { transfer_function };
+        Media::MatrixCoefficients mc { matrix_coefficients };
+        Media::VideoFullRangeFlag rf { video_full_range_flag };
+        cicp = Media::CodingIndependentCodePoints { cp, tc, mc, rf };
+    } else {
+        char* profile_name = nullptr;
+        int compression_type = 0;
+        u8* profile_data = nullptr;
+        u32 profile_len = 0;
+        if (png_get_iCCP(png_ptr, info_ptr, &profile_name, &compression_type, &profile_data, &profile_len))
+            icc_profile = TRY(ByteBuffer::copy(profile_data, profile_len));
+    }
+    return {};
+}
+
 ErrorOr<void> PNGImageDecoderPlugin::initialize()
 {
     m_context->png_ptr = png_create_read_struct(PNG_LIBPNG_VER_STRING, nullptr, nullptr, nullptr);
@@ -164,61 +236,195 @@ ErrorOr<void> PNGImageDecoderPlugin::initialize()
 
     png_read_info(m_context->png_ptr, m_context->info_ptr);
 
-    u32 width = 0;
-    u32 height = 0;
-    int bit_depth = 0;
-    int color_type = 0;
-    int interlace_type = 0;
-    png_get_IHDR(m_context->png_ptr, m_context->info_ptr, &width, &height, &bit_depth, &color_type, &interlace_type, nullptr, nullptr);
+    u32 width = png_get_image_width(m_context->png_ptr, m_context->info_ptr);
+    u32 height = png_get_image_height(m_context->png_ptr, m_context->info_ptr);
     m_context->size = { static_cast<int>(width), static_cast<int>(height) };
 
-    if (color_type == PNG_COLOR_TYPE_PALETTE)
-        png_set_palette_to_rgb(m_context->png_ptr);
+    set_up_transformations(m_context->png_ptr, m_context->info_ptr);
+    TRY(read_color_space_info(m_context->png_ptr, m_context->info_ptr, m_context->cicp, m_context->icc_profile));
 
-    if (color_type == PNG_COLOR_TYPE_GRAY && bit_depth < 8)
-        png_set_expand_gray_1_2_4_to_8(m_context->png_ptr);
+    u8* exif_data = nullptr;
+    u32 exif_length = 0;
+    int const num_exif_chunks = png_get_eXIf_1(m_context->png_ptr, m_context->info_ptr, &exif_length, &exif_data);
+    if (num_exif_chunks > 0)
+        m_context->exif_metadata = TRY(TIFFImageDecoderPlugin::read_exif_metadata({ exif_data, exif_length }));
 
-    if (png_get_valid(m_context->png_ptr, m_context->info_ptr, PNG_INFO_tRNS))
-        png_set_tRNS_to_alpha(m_context->png_ptr);
+    return {};
+}
 
-    if (bit_depth == 16)
-        png_set_strip_16(m_context->png_ptr);
+// Decodes a PNG image as its data arrives with libpng's progressive reader, which keeps its state between pieces of data.
+class PNGIncrementalImageDecoder final : public IncrementalImageDecoder {
+public:
+    virtual ~PNGIncrementalImageDecoder() override
+    {
+        png_destroy_read_struct(&m_png_ptr, &m_info_ptr, nullptr);
+    }
 
-    if (color_type == PNG_COLOR_TYPE_GRAY || color_type == PNG_COLOR_TYPE_GRAY_ALPHA)
-        png_set_gray_to_rgb(m_context->png_ptr);
+    ErrorOr<void> initialize()
+    {
+        m_png_ptr = png_create_read_struct(PNG_LIBPNG_VER_STRING, nullptr, log_png_error, log_png_warning);
+        if (!m_png_ptr)
+            return Error::from_string_view("Failed to allocate read struct"sv);
+
+        m_info_ptr = png_create_info_struct(m_png_ptr);
+        if (!m_info_ptr)
+            return Error::from_string_view("Failed to allocate info struct"sv);
+
+        png_set_progressive_read_fn(
+            m_png_ptr, this,
+            [](png_structp png_ptr, png_infop) {
+                static_cast<PNGIncrementalImageDecoder*>(png_get_progressive_ptr(png_ptr))->did_read_info();
+            },
+            [](png_structp png_ptr, png_bytep row, png_uint_32 row_number, int pass) {
+                static_cast<PNGIncrementalImageDecoder*>(png_get_progressive_ptr(png_ptr))->did_read_row(row, row_number, pass);
+            },
+            [](png_structp png_ptr, png_infop) {
+                static_cast<PNGIncrementalImageDecoder*>(png_get_progressive_ptr(png_ptr))->m_state = State::Done;
+            });
+        return {};
+    }
 
-    if (interlace_type != PNG_INTERLACE_NONE)
-        png_set_interlace_handling(m_context->png_ptr);
+    virtual ErrorOr<void> decode_more(ReadonlyBytes data_so_far) override
+    {
+        if (m_state == State::Error)
+            return Error::from_string_literal("PNGIncrementalImageDecoder: Decoding failed");
+        if (m_state != State::Decoding)
+            return {};
 
-    png_set_filler(m_context->png_ptr, 0xFF, PNG_FILLER_AFTER);
-    png_set_bgr(m_context->png_ptr);
+        // NOTE: libpng holds on to whatever it can't decode yet of the data it's given, so we only give it the new data.
+        VERIFY(data_so_far.size() >= m_consumed_size);
+        auto new_data = data_so_far.slice(m_consumed_size);
+        m_consumed_size = data_so_far.size();
 
-    png_byte color_primaries { 0 };
-    png_byte transfer_function { 0 };
-    png_byte matrix_coefficients { 0 };
-    png_byte video_full_range_flag { 0 };
-    if (png_get_cICP(m_context->png_ptr, m_context->info_ptr, &color_primaries, &transfer_function, &matrix_coefficients, &video_full_range_flag)) {
-        Media::ColorPrimaries cp { color_primaries };
-        Media::TransferCharacteristics tc { transfer_function };
-        Media::MatrixCoefficients mc { matrix_coefficients };
-        Media::VideoFullRangeFlag rf { video_full_range_flag };
-        m_context->cicp = Media::CodingIndependentCodePoints { cp, tc, mc, rf };
-    } else {
-        char* profile_name = nullptr;
-        int compression_type = 0;
-        u8* profile_data = nullptr;
-        u32 profile_len = 0;
-        if (png_get_iCCP(m_context->png_ptr, m_context->info_ptr, &profile_name, &compression_type, &profile_data, &profile_len))
-            m_context->icc_profile = TRY(ByteBuffer::copy(profile_data, profile_len));
+        // NOTE: We need to setjmp() here because libpng uses longjmp() for error handling.
+        if (auto error_value = setjmp(png_jmpbuf(m_png_ptr)); error_value) {
+            m_state = State::Error;
+            return Error::from_errno(error_value);
+        }
+
+        png_process_data(m_png_ptr, m_info_ptr, const_cast<u8*>(new_data.data()), new_data.size());
+
+        if (m_bitmap_error.has_value()) {
+            m_state = State::Error;
+            return m_bitmap_error.release_value();
+        }
+        return {};
     }
 
-    u8* exif_data = nullptr;
-    u32 exif_length = 0;
-    int const num_exif_chunks = png_get_eXIf_1(m_context->png_ptr, m_context->info_ptr, &exif_length, &exif_data);
-    if (num_exif_chunks > 0)
-        m_context->exif_metadata = TRY(TIFFImageDecoderPlugin::read_exif_metadata({ exif_data, exif_length }));
+    virtual RefPtr<Bitmap> bitmap() const override
+    {
+        if (!m_has_decoded_rows)
+            return nullptr;
+        return m_bitmap;
+    }
 
-    return {};
+    virtual ErrorOr<ColorSpace> color_space() const override
+    {
+        if (m_cicp.has_value())
+            return ColorSpace::from_cicp(*m_cicp);
+        if (m_icc_profile.has_value())
+            return ColorSpace::load_from_icc_bytes(*m_icc_profile);
+        return ColorSpace {};
+    }
+
+private:
+    enum class State {
+        Decoding,
+        Done,
+        CannotShow,
+        Error,
+    };
+
+    void did_read_info()
+    {
+        // NOTE: Animated images, and those that have to be rotated according to their EXIF metadata, are only shown once
+        //       all of their data has arrived.
+        u32 apng_frame_count = 0;
+        u32 apng_loop_count = 0;
+        u8* exif_data = nullptr;
+        u32 exif_length = 0;
+        if (png_get_acTL(m_png_ptr, m_info_ptr, &apng_frame_count, &apng_loop_count) != 0 || png_get_eXIf_1(m_png_ptr, m_info_ptr, &exif_length, &exif_data) > 0) {
+            m_state = State::CannotShow;
+            png_process_data_pause(m_png_ptr, 0);
+            return;
+        }
+
+        set_up_transformations(m_png_ptr, m_info_ptr);
+        if (auto result = read_color_space_info(m_png_ptr, m_info_ptr, m_cicp, m_icc_profile); result.is_error())
+            dbgln("PNGIncrementalImageDecoder: Failed to read color space: {}", result.error());
+        png_read_update_info(m_png_ptr, m_info_ptr);
+
+        // NOTE: A new bitmap is fully transparent, which is what we show for the rows we don't have data for.
+        IntSize size { static_cast<int>(png_get_image_width(m_png_ptr, m_info_ptr)), static_cast<int>(png_get_image_height(m_png_ptr, m_info_ptr)) };
+        auto bitmap = Bitmap::create(BitmapFormat::BGRA8888, AlphaType::Unpremultiplied, size);
+        if (bitmap.is_error()) {
+            m_bitmap_error = bitmap.release_error();
+            m_state = State::Error;
+            png_process_data_pause(m_png_ptr, 0);
+            return;
+        }
+        m_bitmap = bitmap.release_value();
+        m_is_interlaced = png_get_interlace_type(m_png_ptr, m_info_ptr) != PNG_INTERLACE_NONE;
+    }
+
+    void did_read_row(png_bytep row, png_uint_32 row_number, int pass)
+    {
+        // NOTE: For interlaced images, libpng tells us about rows that the current pass has no pixels in, too.
+        if (!row || !m_bitmap || m_state != State::Decoding)
+            return;
+
+        png_progressive_combine_row(m_png_ptr, m_bitmap->scanline_u8(row_number), row);
+        m_has_decoded_rows = true;
+
+        if (m_is_interlaced)
+            fill_in_rest_of_adam7_blocks(row_number, pass);
+    }
+
+    // Until the later passes of an interlaced image have arrived, each of its pixels stands in for the ones that come
+    // after it, like libpng's "rectangle" effect does.
+    void fill_in_rest_of_adam7_blocks(png_uint_32 row_number, int pass)
+    {
+        static constexpr int block_widths[] = { 8, 4, 4, 2, 2, 1, 1 };
+        static constexpr int block_heights[] = { 8, 8, 4, 4, 2, 2, 1 };
+        if (pass < 0 || pass >= 6)
+            return;
+
+        int block_width = block_widths[pass];
+        int block_height = block_heights[pass];
+        int x_start = PNG_PASS_START_COL(pass);
+        int x_step = 1 << PNG_PASS_COL_SHIFT(pass);
+
+        auto* source_row = m_bitmap->scanline(row_number);
+        for (int x = x_start; x < m_bitmap->width(); x += x_step) {
+            auto pixel = source_row[x];
+            for (int y = static_cast<int>(row_number); y < min(static_cast<int>(row_number) + block_height, m_bitmap->height()); ++y) {
+                auto* target_row = m_bitmap->scanline(y);
+                for (int block_x = x; block_x < min(x + block_width, m_bitmap->width()); ++block_x)
+                    target_row[block_x] = pixel;
+            }
+        }
+    }
+
+    png_structp m_png_ptr { nullptr };
+    png_infop m_info_ptr { nullptr };
+    State m_state { State::Decoding };
+
+    // How much of the data we've given to libpng so far.
+    size_t m_consumed_size { 0 };
+
+    RefPtr<Bitmap> m_bitmap;
+    Optional<Error> m_bitmap_error;
+    bool m_is_interlaced { false };
+    bool m_has_decoded_rows { false };
+    Optional<Media::CodingIndependentCodePoints> m_cicp;
+    Optional<ByteBuffer> m_icc_profile;
+};
+
+ErrorOr<NonnullOwnPtr<IncrementalImageDecoder>> PNGImageDecoderPlugin::create_incremental_decoder()
+{
+    auto decoder = TRY(adopt_nonnull_own_or_enomem(new (nothrow) PNGIncrementalImageDecoder));
+    TRY(decoder->initialize());
+    return decoder;
 }
 
 ErrorOr<void> PNGLoadingContext::apply_exif_orientation()
@@ -360,6 +566,93 @@ ErrorOr<size_t> PNGLoadingContext::read_frames(png_structp png_ptr, png_infop in
     return frame_count;
 }
 
+ErrorOr<void> PNGLoadingContext::read_still_frame(Optional<IntSize> ideal_size)
+{
+    // NOTE: We need to setjmp() here because libpng uses longjmp() for error handling.
+    if (auto error_value = setjmp(png_jmpbuf(png_ptr)); error_value) {
+        return Error::from_errno(error_value);
+    }
+
+    png_read_update_info(png_ptr, info_ptr);
+
+    // NOTE: Interlaced images don't arrive row by row, so we can only scale down the others as we decode them.
+    auto target_size = size_to_decode_at(size, ideal_size);
+    if (target_size != size && png_get_interlace_type(png_ptr, info_ptr) == PNG_INTERLACE_NONE) {
+        frame_descriptors.append({ TRY(read_rows_scaled_down(target_size)), 0 });
+        return {};
+    }
+
+    auto bitmap = TRY(Bitmap::create(BitmapFormat::BGRA8888, AlphaType::Unpremultiplied, size));
+    Vector<u8*> row_pointers;
+    TRY(row_pointers.try_resize(size.height()));
+    for (auto i = 0; i < size.height(); ++i)
+        row_pointers[i] = bitmap->scanline_u8(i);
+
+    png_read_image(png_ptr, row_pointers.data());
+    frame_descriptors.append({ move(bitmap), 0 });
+    return {};
+}
+
+// Reads the image one row at a time, averaging the pixels that end up in the same pixel of the target size, so that we
+// never hold on to more than one row of the image at its full size.
+ErrorOr<NonnullRefPtr<Bitmap>> PNGLoadingContext::read_rows_scaled_down(IntSize target_size)
+{
+    auto bitmap = TRY(Bitmap::create(BitmapFormat::BGRA8888, AlphaType::Unpremultiplied, target_size));
+
+    Vector<u8> row;
+    TRY(row.try_resize(static_cast<size_t>(size.width()) * 4));
+
+    // NOTE: Color channels are weighted by alpha, so that fully transparent pixels don't bleed their color into the result.
+    struct Sum {
+        u64 blue { 0 };
+        u64 green { 0 };
+        u64 red { 0 };
+        u64 alpha { 0 };
+        u64 count { 0 };
+    };
+    Vector<Sum> sums;
+    TRY(sums.try_resize(target_size.width()));
+
+    auto flush_row = [&](int target_y) {
+        auto* target_row = bitmap->scanline_u8(target_y);
+        for (int target_x = 0; target_x < target_size.width(); ++target_x) {
+            auto& sum = sums[target_x];
+            auto* pixel = target_row + target_x * 4;
+            if (sum.alpha == 0) {
+                pixel[0] = pixel[1] = pixel[2] = pixel[3] = 0;
+            } else {
+                pixel[0] = static_cast<u8>(sum.blue / sum.alpha);
+                pixel[1] = static_cast<u8>(sum.green / sum.alpha);
+                pixel[2] = static_cast<u8>(sum.red / sum.alpha);
+                pixel[3] = static_cast<u8>(sum.alpha / sum.count);
+            }
+            sum = {};
+        }
+    };
+
+    for (int y = 0; y < size.height(); ++y) {
+        png_read_row(png_ptr, row.data(), nullptr);
+
+        for (int x = 0; x < size.width(); ++x) {
+            auto& sum = sums[static_cast<i64>(x) * target_size.width() / size.width()];
+            auto const* pixel = row.data() + x * 4;
+            u64 alpha = pixel[3];
+            sum.blue += pixel[0] * alpha;
+            sum.green += pixel[1] * alpha;
+            sum.red += pixel[2] * alpha;
+            sum.alpha += alpha;
+            ++sum.count;
+        }
+
+        auto target_y = static_cast<i64>(y) * target_size.height() / size.height();
+        auto next_target_y = static_cast<i64>(y + 1) * target_size.height() / size.height();
+        if (y + 1 == size.height() || next_target_y != target_y)
+            flush_row(static_cast<int>(target_y));
+    }
+
+    return bitmap;
+}
+
 PNGImageDecoderPlugin::~PNGImageDecoderPlugin() = default;
 
 bool PNGImageDecoderPlugin::sniff(ReadonlyBytes data)
@@ -16,6 +16,7 @@ class PNGImageDecoderPlugin final : public ImageDecoderPlugin {
 public:
     static bool sniff(ReadonlyBytes);
     static ErrorOr<NonnullOwnPtr<ImageDecoderPlugin>> create(ReadonlyBytes);
+    static ErrorOr<NonnullOwnPtr<IncrementalImageDecoder>> create_incremental_decoder();
 
     virtual ~PNGImageDecoderPlugin() override;
 
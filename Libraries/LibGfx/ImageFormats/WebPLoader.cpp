@@ -115,7 +115,7 @@ static ErrorOr<void> decode_webp_header(WebPLoadingContext& context)
     return {};
 }
 
-static ErrorOr<void> decode_webp_image(WebPLoadingContext& context)
+static ErrorOr<void> decode_webp_image(WebPLoadingContext& context, Optional<IntSize> ideal_size)
 {
     VERIFY(context.state >= WebPLoadingContext::State::HeaderDecoded);
 
@@ -149,11 +149,31 @@ static ErrorOr<void> decode_webp_image(WebPLoadingContext& context)
             context.frame_descriptors.append(ImageFrameDescriptor { bitmap, duration });
         }
     } else {
+        // NOTE: libwebp can scale still images while decoding them, but not animated ones.
+        auto size = size_to_decode_at(context.size, ideal_size);
+
         auto bitmap_format = context.has_alpha ? BitmapFormat::BGRA8888 : BitmapFormat::BGRx8888;
-        auto bitmap = TRY(Bitmap::create(bitmap_format, Gfx::AlphaType::Unpremultiplied, context.size));
+        auto bitmap = TRY(Bitmap::create(bitmap_format, Gfx::AlphaType::Unpremultiplied, size));
+
+        WebPDecoderConfig config;
+        if (!WebPInitDecoderConfig(&config))
+            return Error::from_string_literal("Failed to initialize webp decoder config");
+
+        if (size != context.size) {
+            config.options.use_scaling = 1;
+            config.options.scaled_width = size.width();
+            config.options.scaled_height = size.height();
+        }
+
+        config.output.colorspace = MODE_BGRA;
+        config.output.is_external_memory = 1;
+        config.output.u.RGBA.rgba = bitmap->scanline_u8(0);
+        config.output.u.RGBA.stride = bitmap->pitch();
+        config.output.u.RGBA.size = bitmap->data_size();
 
-        auto image_data = WebPDecodeBGRAInto(context.data.data(), context.data.size(), bitmap->scanline_u8(0), bitmap->data_size(), bitmap->pitch());
-        if (image_data == nullptr)
+        auto status = WebPDecode(context.data.data(), context.data.size(), &config);
+        WebPFreeDecBuffer(&config.output);
+        if (status != VP8_STATUS_OK)
             return Error::from_string_literal("Failed to decode webp image into bitmap");
 
         auto duration = 0;
@@ -204,7 +224,7 @@ size_t WebPImageDecoderPlugin::first_animated_frame_index()
     return 0;
 }
 
-ErrorOr<ImageFrameDescriptor> WebPImageDecoderPlugin::frame(size_t index, Optional<IntSize>)
+ErrorOr<ImageFrameDescriptor> WebPImageDecoderPlugin::frame(size_t index, Optional<IntSize> ideal_size)
 {
     if (index >= frame_count())
         return Error::from_string_literal("WebPImageDecoderPlugin: Invalid frame index");
@@ -213,7 +233,7 @@ ErrorOr<ImageFrameDescriptor> WebPImageDecoderPlugin::frame(size_t index, Option
         return Error::from_string_literal("WebPImageDecoderPlugin: Decoding failed");
 
     if (m_context->state < WebPLoadingContext::State::BitmapDecoded) {
-        TRY(decode_webp_image(*m_context));
+        TRY(decode_webp_image(*m_context, ideal_size));
         m_context->state = WebPLoadingContext::State::BitmapDecoded;
     }
 
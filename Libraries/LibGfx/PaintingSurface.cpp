@@ -124,6 +124,21 @@ NonnullRefPtr<PaintingSurface> PaintingSurface::wrap_bitmap(Bitmap& bitmap)
     return adopt_ref(*new PaintingSurface(make<Impl>(RefPtr<SkiaBackendContext> {}, size, surface, bitmap)));
 }
 
+RefPtr<PaintingSurface> PaintingSurface::wrap_rows(int first_row, int row_count)
+{
+    auto const& bitmap = m_impl->bitmap;
+    if (!bitmap)
+        return nullptr;
+    VERIFY(first_row >= 0 && row_count > 0 && first_row + row_count <= bitmap->height());
+
+    auto color_type = to_skia_color_type(bitmap->format());
+    auto alpha_type = to_skia_alpha_type(bitmap->format(), bitmap->alpha_type());
+    auto image_info = SkImageInfo::Make(bitmap->width(), row_count, color_type, alpha_type, SkColorSpace::MakeSRGB());
+    auto surface = SkSurfaces::WrapPixels(image_info, bitmap->scanline_u8(first_row), bitmap->pitch());
+    VERIFY(surface);
+    return adopt_ref(*new PaintingSurface(make<Impl>(RefPtr<SkiaBackendContext> {}, IntSize { bitmap->width(), row_count }, surface, bitmap)));
+}
+
 #ifdef AK_OS_MACOS
 NonnullRefPtr<PaintingSurface> PaintingSurface::create_from_iosurface(Core::IOSurfaceHandle&& iosurface_handle, NonnullRefPtr<SkiaBackendContext> context, Origin origin)
 {
@@ -35,6 +35,10 @@ public:
     static NonnullRefPtr<PaintingSurface> create_with_size(RefPtr<SkiaBackendContext> context, IntSize size, BitmapFormat color_type, AlphaType alpha_type);
     static NonnullRefPtr<PaintingSurface> wrap_bitmap(Bitmap&);
 
+    // Returns a surface that paints directly into the given rows of this surface, or null if this surface is not backed
+    // by a bitmap. NOTE: Call notify_content_will_change() on this surface before painting into the returned one.
+    RefPtr<PaintingSurface> wrap_rows(int first_row, int row_count);
+
 #ifdef AK_OS_MACOS
     static NonnullRefPtr<PaintingSurface> create_from_iosurface(Core::IOSurfaceHandle&&, NonnullRefPtr<SkiaBackendContext>, Origin = Origin::TopLeft);
 #endif
@@ -7,6 +7,10 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/ByteBuffer.h>
+#include <AK/HashFunctions.h>
+#include <AK/HashMap.h>
+#include <AK/StringHash.h>
 #include <AK/Utf16View.h>
 #include <AK/Utf8View.h>
 #include <LibGfx/Point.h>
@@ -98,8 +102,79 @@ static hb_buffer_t* setup_text_shaping(UnicodeView const& string, Font const& fo
     return buffer;
 }
 
+// Shaping the same text with the same font over and over again is very common (relayout, repeated words across a
+// document), so we keep a bounded cache of shaping results. Entries are positioned relative to a zero baseline start
+// and copied into a fresh GlyphRun on every lookup, since callers are allowed to modify the glyphs they get back.
+struct ShapedText {
+    Vector<DrawGlyph> glyphs;
+    float width { 0 };
+};
+
+struct ShapingCacheKey {
+    NonnullRefPtr<Font const> font;
+    float letter_spacing { 0 };
+    GlyphRun::TextType text_type { GlyphRun::TextType::Common };
+    ShapeFeatures features;
+    bool is_utf16 { false };
+    ByteBuffer code_units;
+    unsigned hash { 0 };
+};
+
+static bool features_are_equal(ShapeFeatures const& a, ShapeFeatures const& b)
+{
+    if (a.size() != b.size())
+        return false;
+    for (size_t i = 0; i < a.size(); ++i) {
+        if (__builtin_memcmp(a[i].tag, b[i].tag, sizeof(a[i].tag)) != 0 || a[i].value != b[i].value)
+            return false;
+    }
+    return true;
+}
+
+static bool shaping_cache_key_matches(ShapingCacheKey const& key, unsigned hash, Font const& font, float letter_spacing, GlyphRun::TextType text_type, ShapeFeatures const& features, bool is_utf16, ReadonlyBytes code_units)
+{
+    return key.hash == hash
+        && key.font.ptr() == &font
+        && bit_cast<u32>(key.letter_spacing) == bit_cast<u32>(letter_spacing)
+        && key.text_type == text_type
+        && key.is_utf16 == is_utf16
+        && key.code_units.bytes() == code_units
+        && features_are_equal(key.features, features);
+}
+
+struct ShapingCacheKeyTraits : public DefaultTraits<ShapingCacheKey> {
+    static unsigned hash(ShapingCacheKey const& key) { return key.hash; }
+    static bool equals(ShapingCacheKey const& a, ShapingCacheKey const& b)
+    {
+        return shaping_cache_key_matches(a, b.hash, b.font, b.letter_spacing, b.text_type, b.features, b.is_utf16, b.code_units.bytes());
+    }
+};
+
+static constexpr size_t max_shaping_cache_entries = 8192;
+
+static OrderedHashMap<ShapingCacheKey, ShapedText, ShapingCacheKeyTraits>& shaping_cache()
+{
+    static OrderedHashMap<ShapingCacheKey, ShapedText, ShapingCacheKeyTraits> cache;
+    return cache;
+}
+
+// NOTE: ASCII text produces the same clusters whether it is stored as UTF-8 or as ASCII-only UTF-16, so both share entries.
 template<typename UnicodeView>
-NonnullRefPtr<GlyphRun> shape_text(FloatPoint baseline_start, float letter_spacing, UnicodeView const& string, Font const& font, GlyphRun::TextType text_type, ShapeFeatures const& features)
+static ReadonlyBytes code_units_for_shaping_cache(UnicodeView const& string, bool& is_utf16)
+{
+    if constexpr (IsSame<UnicodeView, Utf8View>) {
+        is_utf16 = false;
+        return ReadonlyBytes { string.bytes(), string.byte_length() };
+    } else {
+        is_utf16 = !string.has_ascii_storage();
+        if (!is_utf16)
+            return to_readonly_bytes(string.ascii_span());
+        return to_readonly_bytes(string.utf16_span());
+    }
+}
+
+template<typename UnicodeView>
+static ShapedText shape_text_uncached(float letter_spacing, UnicodeView const& string, Font const& font, ShapeFeatures const& features)
 {
     auto* buffer = setup_text_shaping(string, font, features);
 
@@ -109,7 +184,7 @@ NonnullRefPtr<GlyphRun> shape_text(FloatPoint baseline_start, float letter_spaci
 
     Vector<DrawGlyph> glyph_run;
     glyph_run.ensure_capacity(glyph_count);
-    FloatPoint point = baseline_start;
+    FloatPoint point;
 
     // We track the code unit length rather than just the code unit offset because LibWeb may later collapse glyph runs.
     // Updating the offset of each glyph gets tricky when handling text direction (LTR/RTL). So rather than doing that,
@@ -147,7 +222,55 @@ NonnullRefPtr<GlyphRun> shape_text(FloatPoint baseline_start, float letter_spaci
         point.translate_by(letter_spacing, 0);
     }
 
-    return adopt_ref(*new GlyphRun(move(glyph_run), font, text_type, point.x() - baseline_start.x()));
+    return { move(glyph_run), point.x() };
+}
+
+template<typename UnicodeView>
+NonnullRefPtr<GlyphRun> shape_text(FloatPoint baseline_start, float letter_spacing, UnicodeView const& string, Font const& font, GlyphRun::TextType text_type, ShapeFeatures const& features)
+{
+    bool is_utf16 = false;
+    auto code_units = code_units_for_shaping_cache(string, is_utf16);
+
+    auto hash = pair_int_hash(ptr_hash(&font), string_hash(reinterpret_cast<char const*>(code_units.data()), code_units.size()));
+    hash = pair_int_hash(hash, pair_int_hash(bit_cast<u32>(letter_spacing), to_underlying(text_type)));
+    for (auto const& feature : features)
+        hash = pair_int_hash(hash, pair_int_hash(string_hash(feature.tag, sizeof(feature.tag)), feature.value));
+
+    auto make_glyph_run = [&](ShapedText const& shaped_text) {
+        Vector<DrawGlyph> glyph_run;
+        glyph_run.ensure_capacity(shaped_text.glyphs.size());
+        for (auto glyph : shaped_text.glyphs) {
+            glyph.position.translate_by(baseline_start);
+            glyph_run.unchecked_append(glyph);
+        }
+        return adopt_ref(*new GlyphRun(move(glyph_run), font, text_type, shaped_text.width));
+    };
+
+    auto& cache = shaping_cache();
+    auto it = cache.find(hash, [&](auto const& entry) {
+        return shaping_cache_key_matches(entry.key, hash, font, letter_spacing, text_type, features, is_utf16, code_units);
+    });
+    if (it != cache.end())
+        return make_glyph_run(it->value);
+
+    auto shaped_text = shape_text_uncached(letter_spacing, string, font, features);
+    auto glyph_run = make_glyph_run(shaped_text);
+
+    if (cache.size() >= max_shaping_cache_entries)
+        cache.remove(cache.begin());
+    cache.set(
+        ShapingCacheKey {
+            .font = font,
+            .letter_spacing = letter_spacing,
+            .text_type = text_type,
+            .features = features,
+            .is_utf16 = is_utf16,
+            .code_units = MUST(ByteBuffer::copy(code_units)),
+            .hash = hash,
+        },
+        move(shaped_text));
+
+    return glyph_run;
 }
 
 template NonnullRefPtr<GlyphRun> shape_text(FloatPoint, float, Utf8View const&, Font const&, GlyphRun::TextType, ShapeFeatures const&);
@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/Checked.h>
 #include <LibCore/AnonymousBuffer.h>
 #include <LibImageDecoderClient/Client.h>
 
@@ -20,9 +21,18 @@ void Client::die()
         promise->reject(Error::from_string_literal("ImageDecoder disconnected"));
     }
     m_pending_decoded_images.clear();
+    m_partial_image_handlers.clear();
+    m_incremental_decodes.clear();
+
+    // NOTE: The failure callbacks may end their sessions while they run.
+    auto animation_frame_handlers = move(m_animation_frame_handlers);
+    for (auto& [_, handlers] : animation_frame_handlers) {
+        if (handlers.on_failure)
+            handlers.on_failure();
+    }
 }
 
-NonnullRefPtr<Core::Promise<DecodedImage>> Client::decode_image(ReadonlyBytes encoded_data, Function<ErrorOr<void>(DecodedImage&)> on_resolved, Function<void(Error&)> on_rejected, Optional<Gfx::IntSize> ideal_size, Optional<ByteString> mime_type)
+NonnullRefPtr<Core::Promise<DecodedImage>> Client::decode_image(ReadonlyBytes encoded_data, Function<ErrorOr<void>(DecodedImage&)> on_resolved, Function<void(Error&)> on_rejected, Optional<Gfx::IntSize> ideal_size, Optional<ByteString> mime_type, AnimationFrameDecoding animation_frame_decoding)
 {
     auto promise = Core::Promise<DecodedImage>::construct();
     if (on_resolved)
@@ -45,7 +55,7 @@ NonnullRefPtr<Core::Promise<DecodedImage>> Client::decode_image(ReadonlyBytes en
 
     memcpy(encoded_buffer.data<void>(), encoded_data.data(), encoded_data.size());
 
-    auto response = send_sync_but_allow_failure<Messages::ImageDecoderServer::DecodeImage>(move(encoded_buffer), ideal_size, mime_type);
+    auto response = send_sync_but_allow_failure<Messages::ImageDecoderServer::DecodeImage>(move(encoded_buffer), ideal_size, mime_type, animation_frame_decoding == AnimationFrameDecoding::Lazy);
     if (!response) {
         dbgln("ImageDecoder disconnected trying to decode image");
         promise->reject(Error::from_string_literal("ImageDecoder disconnected"));
@@ -57,7 +67,118 @@ NonnullRefPtr<Core::Promise<DecodedImage>> Client::decode_image(ReadonlyBytes en
     return promise;
 }
 
-void Client::did_decode_image(i64 image_id, bool is_animated, u32 loop_count, Gfx::BitmapSequence bitmap_sequence, Vector<u32> durations, Gfx::FloatPoint scale, Gfx::ColorSpace color_space)
+Optional<i64> Client::start_incremental_decode(Optional<ByteString> mime_type, OnPartialImageDecoded on_partial_image_decoded)
+{
+    if (!is_open()) {
+        dbgln("ImageDecoder disconnected trying to start decoding image");
+        return {};
+    }
+
+    // NOTE: We pick the ID ourselves, so that we don't have to wait for the image decoder to start decoding. The IDs that
+    //       the image decoder picks are never negative.
+    auto image_id = m_next_incremental_decode_id--;
+    m_partial_image_handlers.set(image_id, move(on_partial_image_decoded));
+    m_incremental_decodes.set(image_id, {});
+    async_start_incremental_decode(image_id, move(mime_type));
+    return image_id;
+}
+
+ErrorOr<void> Client::append_encoded_data(i64 image_id, ReadonlyBytes encoded_data)
+{
+    auto decode = m_incremental_decodes.get(image_id);
+    if (!decode.has_value())
+        return Error::from_string_literal("ImageDecoder disconnected");
+    if (encoded_data.is_empty())
+        return {};
+
+    Checked<size_t> new_encoded_size = decode->encoded_size;
+    new_encoded_size += encoded_data.size();
+    if (new_encoded_size.has_overflow())
+        return Error::from_errno(EOVERFLOW);
+
+    if (new_encoded_size.value() > decode->encoded_buffer.size()) {
+        Checked<size_t> new_capacity = max(minimum_encoded_buffer_size, decode->encoded_buffer.size());
+        while (new_capacity.value() < new_encoded_size.value()) {
+            new_capacity *= 2;
+            if (new_capacity.has_overflow())
+                return Error::from_errno(EOVERFLOW);
+        }
+
+        auto new_buffer = TRY(Core::AnonymousBuffer::create_with_size(new_capacity.value()));
+        if (decode->encoded_size > 0)
+            memcpy(new_buffer.data<void>(), decode->encoded_buffer.data<void>(), decode->encoded_size);
+        decode->encoded_buffer = move(new_buffer);
+
+        if (is_open())
+            async_set_encoded_data_buffer(image_id, decode->encoded_buffer);
+    }
+
+    memcpy(decode->encoded_buffer.data<u8>() + decode->encoded_size, encoded_data.data(), encoded_data.size());
+    decode->encoded_size = new_encoded_size.value();
+
+    if (is_open())
+        async_did_append_encoded_data(image_id, decode->encoded_size);
+    return {};
+}
+
+ReadonlyBytes Client::encoded_data(i64 image_id) const
+{
+    auto decode = m_incremental_decodes.get(image_id);
+    if (!decode.has_value() || decode->encoded_size == 0)
+        return {};
+    return { decode->encoded_buffer.data<u8>(), decode->encoded_size };
+}
+
+NonnullRefPtr<Core::Promise<DecodedImage>> Client::finish_incremental_decode(i64 image_id, Function<ErrorOr<void>(DecodedImage&)> on_resolved, Function<void(Error&)> on_rejected, Optional<Gfx::IntSize> ideal_size, AnimationFrameDecoding animation_frame_decoding)
+{
+    auto promise = Core::Promise<DecodedImage>::construct();
+    if (on_resolved)
+        promise->on_resolution = move(on_resolved);
+    if (on_rejected)
+        promise->on_rejection = move(on_rejected);
+
+    m_partial_image_handlers.remove(image_id);
+    m_incremental_decodes.remove(image_id);
+
+    if (!is_open()) {
+        promise->reject(Error::from_string_literal("ImageDecoder disconnected"));
+        return promise;
+    }
+
+    m_pending_decoded_images.set(image_id, promise);
+    async_finish_incremental_decode(image_id, ideal_size, animation_frame_decoding == AnimationFrameDecoding::Lazy);
+    return promise;
+}
+
+void Client::cancel_incremental_decode(i64 image_id)
+{
+    m_partial_image_handlers.remove(image_id);
+    m_incremental_decodes.remove(image_id);
+    m_pending_decoded_images.remove(image_id);
+    if (is_open())
+        async_cancel_decoding(image_id);
+}
+
+void Client::decode_animation_frames(i64 animation_session_id, u32 start_frame_index, u32 count, OnAnimationFramesDecoded on_frames_decoded, OnAnimationFramesFailed on_failure)
+{
+    if (!is_open()) {
+        if (on_failure)
+            on_failure();
+        return;
+    }
+
+    m_animation_frame_handlers.set(animation_session_id, { move(on_frames_decoded), move(on_failure) });
+    async_decode_animation_frames(animation_session_id, start_frame_index, count);
+}
+
+void Client::end_animation_session(i64 animation_session_id)
+{
+    m_animation_frame_handlers.remove(animation_session_id);
+    if (is_open())
+        async_end_animation_session(animation_session_id);
+}
+
+void Client::did_decode_image(i64 image_id, bool is_animated, u32 loop_count, u32 frame_count, Gfx::IntSize natural_size, Gfx::BitmapSequence bitmap_sequence, Vector<u32> durations, Gfx::FloatPoint scale, Gfx::ColorSpace color_space)
 {
     auto bitmaps = move(bitmap_sequence.bitmaps);
     VERIFY(!bitmaps.is_empty());
@@ -72,6 +193,8 @@ void Client::did_decode_image(i64 image_id, bool is_animated, u32 loop_count, Gf
     DecodedImage image;
     image.is_animated = is_animated;
     image.loop_count = loop_count;
+    image.frame_count = frame_count;
+    image.natural_size = natural_size;
     image.scale = scale;
     image.frames.ensure_capacity(bitmaps.size());
     image.color_space = move(color_space);
@@ -85,9 +208,44 @@ void Client::did_decode_image(i64 image_id, bool is_animated, u32 loop_count, Gf
         image.frames.empend(bitmaps[i].release_nonnull(), durations[i]);
     }
 
+    if (image.frames.size() < frame_count)
+        image.animation_session_id = image_id;
+
     promise->resolve(move(image));
 }
 
+void Client::did_decode_partial_image(i64 image_id, Gfx::ShareableBitmap bitmap, Gfx::ColorSpace color_space)
+{
+    if (!bitmap.is_valid())
+        return;
+
+    auto handler = m_partial_image_handlers.take(image_id);
+    if (!handler.has_value() || !*handler)
+        return;
+
+    // NOTE: As with animation frames, the handler may finish or cancel the decode while it runs.
+    m_partial_image_handlers.set(image_id, nullptr);
+    (*handler)(*bitmap.bitmap(), move(color_space));
+
+    if (auto it = m_partial_image_handlers.find(image_id); it != m_partial_image_handlers.end() && !it->value)
+        it->value = handler.release_value();
+}
+
+void Client::did_decode_animation_frames(i64 image_id, u32 start_frame_index, Gfx::BitmapSequence bitmap_sequence, Vector<u32> durations)
+{
+    auto handlers = m_animation_frame_handlers.take(image_id);
+    if (!handlers.has_value() || !handlers->on_frames_decoded)
+        return;
+
+    // NOTE: The handler may end the session, or replace itself, while it runs. Leave an empty placeholder behind so that
+    //       we can tell whether to put it back afterwards.
+    m_animation_frame_handlers.set(image_id, {});
+    handlers->on_frames_decoded(start_frame_index, move(bitmap_sequence.bitmaps), move(durations));
+
+    if (auto it = m_animation_frame_handlers.find(image_id); it != m_animation_frame_handlers.end() && !it->value.on_frames_decoded)
+        it->value = handlers.release_value();
+}
+
 void Client::did_fail_to_decode_image(i64 image_id, String error_message)
 {
     auto maybe_promise = m_pending_decoded_images.take(image_id);
@@ -9,6 +9,7 @@
 #include <AK/HashMap.h>
 #include <ImageDecoder/ImageDecoderClientEndpoint.h>
 #include <ImageDecoder/ImageDecoderServerEndpoint.h>
+#include <LibCore/AnonymousBuffer.h>
 #include <LibCore/Promise.h>
 #include <LibGfx/ColorSpace.h>
 #include <LibIPC/ConnectionToServer.h>
@@ -24,8 +25,19 @@ struct DecodedImage {
     bool is_animated { false };
     Gfx::FloatPoint scale { 1, 1 };
     u32 loop_count { 0 };
+    u32 frame_count { 0 };
+    // The size of the image, which its frames may have been decoded at a fraction of.
+    Gfx::IntSize natural_size;
     Vector<Frame> frames;
     Gfx::ColorSpace color_space;
+
+    // Set if only some of the frames were decoded, in which case the rest may be requested with this ID.
+    Optional<i64> animation_session_id;
+};
+
+enum class AnimationFrameDecoding {
+    Eager,
+    Lazy,
 };
 
 class Client final
@@ -38,17 +50,55 @@ public:
 
     Client(NonnullOwnPtr<IPC::Transport>);
 
-    NonnullRefPtr<Core::Promise<DecodedImage>> decode_image(ReadonlyBytes, Function<ErrorOr<void>(DecodedImage&)> on_resolved, Function<void(Error&)> on_rejected, Optional<Gfx::IntSize> ideal_size = {}, Optional<ByteString> mime_type = {});
+    NonnullRefPtr<Core::Promise<DecodedImage>> decode_image(ReadonlyBytes, Function<ErrorOr<void>(DecodedImage&)> on_resolved, Function<void(Error&)> on_rejected, Optional<Gfx::IntSize> ideal_size = {}, Optional<ByteString> mime_type = {}, AnimationFrameDecoding = AnimationFrameDecoding::Eager);
+
+    // Decodes an image whose encoded data is still arriving, e.g. over the network, and is appended as it does. Until the
+    // decode is finished, the callback is invoked with what can be shown of the image so far, for formats that allow it.
+    // Returns nothing if the image decoder has gone away.
+    using OnPartialImageDecoded = Function<void(NonnullRefPtr<Gfx::Bitmap>, Gfx::ColorSpace)>;
+    Optional<i64> start_incremental_decode(Optional<ByteString> mime_type, OnPartialImageDecoded);
+    ErrorOr<void> append_encoded_data(i64 image_id, ReadonlyBytes);
+    // The encoded data appended so far, which stays valid until the decode is finished or canceled.
+    ReadonlyBytes encoded_data(i64 image_id) const;
+    NonnullRefPtr<Core::Promise<DecodedImage>> finish_incremental_decode(i64 image_id, Function<ErrorOr<void>(DecodedImage&)> on_resolved, Function<void(Error&)> on_rejected, Optional<Gfx::IntSize> ideal_size = {}, AnimationFrameDecoding = AnimationFrameDecoding::Eager);
+    void cancel_incremental_decode(i64 image_id);
+
+    // Frames that could not be decoded are passed as null bitmaps. Only the most recently given callbacks of a session
+    // are kept, and they are invoked for every batch of frames decoded from then on. If the image decoder goes away, the
+    // failure callback is invoked instead, and no more frames will be decoded for the session.
+    using OnAnimationFramesDecoded = Function<void(u32 start_frame_index, Vector<RefPtr<Gfx::Bitmap>>, Vector<u32> durations)>;
+    using OnAnimationFramesFailed = Function<void()>;
+    void decode_animation_frames(i64 animation_session_id, u32 start_frame_index, u32 count, OnAnimationFramesDecoded, OnAnimationFramesFailed);
+    void end_animation_session(i64 animation_session_id);
 
     Function<void()> on_death;
 
 private:
     virtual void die() override;
 
-    virtual void did_decode_image(i64 image_id, bool is_animated, u32 loop_count, Gfx::BitmapSequence bitmap_sequence, Vector<u32> durations, Gfx::FloatPoint scale, Gfx::ColorSpace color_space) override;
+    virtual void did_decode_image(i64 image_id, bool is_animated, u32 loop_count, u32 frame_count, Gfx::IntSize natural_size, Gfx::BitmapSequence bitmap_sequence, Vector<u32> durations, Gfx::FloatPoint scale, Gfx::ColorSpace color_space) override;
+    virtual void did_decode_partial_image(i64 image_id, Gfx::ShareableBitmap bitmap, Gfx::ColorSpace color_space) override;
+    virtual void did_decode_animation_frames(i64 image_id, u32 start_frame_index, Gfx::BitmapSequence bitmap_sequence, Vector<u32> durations) override;
     virtual void did_fail_to_decode_image(i64 image_id, String error_message) override;
 
     HashMap<i64, NonnullRefPtr<Core::Promise<DecodedImage>>> m_pending_decoded_images;
+    struct AnimationFrameHandlers {
+        OnAnimationFramesDecoded on_frames_decoded;
+        OnAnimationFramesFailed on_failure;
+    };
+    HashMap<i64, AnimationFrameHandlers> m_animation_frame_handlers;
+    HashMap<i64, OnPartialImageDecoded> m_partial_image_handlers;
+
+    // NOTE: The encoded data of an incremental decode is appended to a buffer that we share with the image decoder, so
+    //       that neither of us has to copy it as it arrives. The buffer is replaced with one twice its size when it runs
+    //       out of room.
+    struct IncrementalDecode {
+        Core::AnonymousBuffer encoded_buffer;
+        size_t encoded_size { 0 };
+    };
+    HashMap<i64, IncrementalDecode> m_incremental_decodes;
+    static constexpr size_t minimum_encoded_buffer_size = 64 * KiB;
+    i64 m_next_incremental_decode_id { -1 };
 };
 
 }
@@ -51,6 +51,20 @@ public:
         return m_view.get<Utf16View>();
     }
 
+    // Invokes the callback with the raw code units of this view, either as a span of chars (for byte
+    // and ASCII-backed views) or as a span of UTF-16 code units.
+    template<typename Callback>
+    decltype(auto) visit_code_units(Callback&& callback) const
+    {
+        return m_view.visit(
+            [&](StringView view) { return callback(ReadonlySpan<char> { view.characters_without_null_termination(), view.length() }); },
+            [&](Utf16View const& view) {
+                if (view.has_ascii_storage())
+                    return callback(view.ascii_span());
+                return callback(view.utf16_span());
+            });
+    }
+
     bool unicode() const { return m_unicode; }
     void set_unicode(bool unicode) { m_unicode = unicode; }
 
@@ -4,10 +4,12 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/Array.h>
 #include <AK/BinarySearch.h>
 #include <AK/BumpAllocator.h>
 #include <AK/ByteString.h>
 #include <AK/Debug.h>
+#include <AK/FindFirstOfASCII.h>
 #include <AK/StringBuilder.h>
 #include <LibRegex/RegexMatcher.h>
 #include <LibRegex/RegexParser.h>
@@ -22,6 +24,58 @@ namespace regex {
 static RegexDebug s_regex_dbg(stderr);
 #endif
 
+// Returns the index of the first occurrence of the ASCII literal `needle` at or after `offset`.
+template<typename CodeUnit>
+static Optional<size_t> find_ascii_literal(ReadonlySpan<CodeUnit> haystack, size_t offset, StringView needle)
+{
+    VERIFY(!needle.is_empty());
+    ReadonlySpan<char> first_character { needle.characters_without_null_termination(), 1 };
+
+    while (offset + needle.length() <= haystack.size()) {
+        auto candidate = find_first_of_ascii(haystack, offset, first_character);
+        if (!candidate.has_value() || *candidate + needle.length() > haystack.size())
+            return {};
+
+        bool matches = true;
+        for (size_t i = 1; i < needle.length(); ++i) {
+            if (static_cast<u32>(haystack[*candidate + i]) != static_cast<u8>(needle[i])) {
+                matches = false;
+                break;
+            }
+        }
+        if (matches)
+            return candidate;
+
+        offset = *candidate + 1;
+    }
+
+    return {};
+}
+
+// Skips ahead to the next position at which a match could possibly start, based on the literal
+// prefix or the set of starting characters extracted from the pattern. Returns an empty optional
+// if no such position exists in the rest of the view.
+static Optional<size_t> find_next_candidate_position(RegexStringView const& view, size_t offset, auto const& optimization_data)
+{
+    return view.visit_code_units([&](auto code_units) -> Optional<size_t> {
+        if (offset >= code_units.size())
+            return {};
+        if (optimization_data.literal_prefix.has_value())
+            return find_ascii_literal(code_units, offset, optimization_data.literal_prefix->view());
+        return find_first_of_ascii(code_units, offset, optimization_data.starting_ascii_characters.span());
+    });
+}
+
+// Returns the index of the first occurrence of the ASCII literal `needle` in the view at or after `offset`.
+static Optional<size_t> find_ascii_literal_in_view(RegexStringView const& view, size_t offset, StringView needle)
+{
+    return view.visit_code_units([&](auto code_units) -> Optional<size_t> {
+        if (offset >= code_units.size())
+            return {};
+        return find_ascii_literal(code_units, offset, needle);
+    });
+}
+
 template<class Parser>
 regex::Parser::Result Regex<Parser>::parse_pattern(StringView pattern, typename ParserTraits<Parser>::OptionsType regex_options)
 {
@@ -209,6 +263,8 @@ RegexResult Matcher<Parser>::match(Vector<RegexStringView> const& views, Optiona
         continue_search = false;
 
     auto single_match_only = input.regex_options.has_flag_set(AllFlags::SingleMatch);
+    auto const& optimization_data = m_pattern->parser_result.optimization_data;
+    auto has_literal_prefilter = optimization_data.literal_prefix.has_value() || !optimization_data.starting_ascii_characters.is_empty();
     auto only_start_of_line = m_pattern->parser_result.optimization_data.only_start_of_line && !input.regex_options.has_flag_set(AllFlags::Multiline);
 
     auto compare_range = [insensitive = input.regex_options & AllFlags::Insensitive](auto needle, CharRange range) {
@@ -243,6 +299,9 @@ RegexResult Matcher<Parser>::match(Vector<RegexStringView> const& views, Optiona
         state.string_position_in_code_units = view_index;
         bool succeeded = false;
 
+        // Where the literal that every match contains next occurs, as far as we've looked.
+        Optional<size_t> required_literal_position;
+
         if (view_index == view_length && m_pattern->parser_result.match_length_minimum == 0) {
             // Run the code until it tries to consume something.
             // This allows non-consuming code to run on empty strings, for instance
@@ -289,6 +348,26 @@ RegexResult Matcher<Parser>::match(Vector<RegexStringView> const& views, Optiona
                 break;
 
             auto const insensitive = input.regex_options.has_flag_set(AllFlags::Insensitive);
+
+            // When searching, jump straight to the next position where the pattern could start matching
+            // instead of running the bytecode at every position in between.
+            // NOTE: Case-insensitive matching can fold non-ASCII code points onto ASCII ones, so it always takes the slow path.
+            if (continue_search && !only_start_of_line && !insensitive && view_index < view_length && has_literal_prefilter) {
+                auto candidate = find_next_candidate_position(input.view, view_index, optimization_data);
+                if (!candidate.has_value())
+                    break;
+                view_index = *candidate;
+                if (match_length_minimum && match_length_minimum > view_length - view_index)
+                    break;
+            }
+
+            // Every match contains the required literal, so none can start past its last occurrence.
+            if (!insensitive && optimization_data.required_literal.has_value() && (!required_literal_position.has_value() || *required_literal_position < view_index)) {
+                required_literal_position = find_ascii_literal_in_view(input.view, view_index, *optimization_data.required_literal);
+                if (!required_literal_position.has_value())
+                    break;
+            }
+
             if (auto& starting_ranges = m_pattern->parser_result.optimization_data.starting_ranges; !starting_ranges.is_empty()) {
                 auto ranges = insensitive ? m_pattern->parser_result.optimization_data.starting_ranges_insensitive.span() : starting_ranges.span();
                 auto ch = input.view.unicode_aware_code_point_at(view_index);
@@ -10,6 +10,7 @@
 #include <AK/QuickSort.h>
 #include <AK/RedBlackTree.h>
 #include <AK/Stack.h>
+#include <AK/StringBuilder.h>
 #include <AK/TemporaryChange.h>
 #include <AK/Trie.h>
 #include <AK/Vector.h>
@@ -178,6 +179,110 @@ static bool interpret_compares(Vector<CompareTypeAndValuePair> const& lhs, Stati
     return true;
 }
 
+static Optional<char> single_ascii_character(StaticallyInterpretedCompares const& compares)
+{
+    if (compares.has_any_unicode_property || !compares.char_classes.is_empty() || !compares.negated_char_classes.is_empty() || !compares.negated_ranges.is_empty())
+        return {};
+    if (compares.ranges.size() != 1)
+        return {};
+    auto it = compares.ranges.begin();
+    if (it.key() != *it || *it > 0x7f)
+        return {};
+    return static_cast<char>(*it);
+}
+
+// Returns the longest run of single ASCII character compares that every match has to go through, one right after the
+// other. Every match contains that run as a substring, so there can't be a match that starts past its last occurrence.
+static Optional<ByteString> find_required_literal(ByteCode const& bytecode)
+{
+    struct Instruction {
+        size_t position { 0 };
+        Optional<size_t> jump_target;
+        Optional<char> character;
+        bool is_zero_width { false };
+    };
+    Vector<Instruction> instructions;
+
+    auto state = MatchState::only_for_enumeration();
+    auto bytecode_size = bytecode.size();
+    for (state.instruction_position = 0; state.instruction_position < bytecode_size;) {
+        auto& opcode = bytecode.get_opcode(state);
+        Instruction instruction { .position = state.instruction_position };
+        auto jump_target = [&](ssize_t offset) {
+            return static_cast<size_t>(static_cast<ssize_t>(state.instruction_position + opcode.size()) + offset);
+        };
+
+        switch (opcode.opcode_id()) {
+        case OpCodeId::Compare: {
+            StaticallyInterpretedCompares compares;
+            if (interpret_compares(static_cast<OpCode_Compare const&>(opcode).flat_compares(), compares))
+                instruction.character = single_ascii_character(compares);
+            break;
+        }
+        case OpCodeId::Jump:
+            instruction.jump_target = jump_target(static_cast<OpCode_Jump const&>(opcode).offset());
+            break;
+        case OpCodeId::JumpNonEmpty:
+            instruction.jump_target = jump_target(static_cast<OpCode_JumpNonEmpty const&>(opcode).offset());
+            break;
+        case OpCodeId::ForkJump:
+        case OpCodeId::ForkReplaceJump:
+            instruction.jump_target = jump_target(static_cast<OpCode_ForkJump const&>(opcode).offset());
+            break;
+        case OpCodeId::ForkStay:
+        case OpCodeId::ForkReplaceStay:
+            instruction.jump_target = jump_target(static_cast<OpCode_ForkStay const&>(opcode).offset());
+            break;
+        case OpCodeId::Repeat:
+            instruction.jump_target = state.instruction_position - static_cast<OpCode_Repeat const&>(opcode).offset();
+            break;
+        case OpCodeId::Checkpoint:
+        case OpCodeId::SaveLeftCaptureGroup:
+        case OpCodeId::SaveRightCaptureGroup:
+        case OpCodeId::SaveRightNamedCaptureGroup:
+        case OpCodeId::ClearCaptureGroup:
+        case OpCodeId::ResetRepeat:
+        case OpCodeId::CheckBegin:
+        case OpCodeId::CheckEnd:
+        case OpCodeId::CheckBoundary:
+            instruction.is_zero_width = true;
+            break;
+        default:
+            // Lookarounds run compares that aren't part of the match, and the like, so don't bother with those.
+            return {};
+        }
+
+        instructions.append(instruction);
+        state.instruction_position += opcode.size();
+    }
+
+    // The only way to get from before an instruction to past it without running it is to jump over it, so every match
+    // runs the instructions that nothing before them jumps past.
+    size_t furthest_jump_target = 0;
+    StringBuilder run;
+    ByteString longest_run;
+    for (auto const& instruction : instructions) {
+        auto is_required = furthest_jump_target <= instruction.position;
+        if (is_required && instruction.character.has_value()) {
+            run.append(*instruction.character);
+            if (run.length() > longest_run.length())
+                longest_run = run.to_byte_string();
+        } else if (!is_required || !instruction.is_zero_width) {
+            // NOTE: Only instructions that neither jump nor match anything can sit between the characters of a run.
+            run.clear();
+        }
+
+        if (instruction.jump_target.has_value()) {
+            furthest_jump_target = max(furthest_jump_target, *instruction.jump_target);
+            run.clear();
+        }
+    }
+
+    if (longest_run.is_empty())
+        return {};
+    return longest_run;
+}
+
 template<class Parser>
 void Regex<Parser>::fill_optimization_data(BasicBlockList const& blocks)
 {
@@ -200,11 +305,28 @@ void Regex<Parser>::fill_optimization_data(BasicBlockList const& blocks)
             for (auto const& range : parser_result.optimization_data.starting_ranges)
                 dbgln("  - starting range: {}-{}", range.from, range.to);
             dbgln("; - only start of line: {}", parser_result.optimization_data.only_start_of_line);
+            if (parser_result.optimization_data.literal_prefix.has_value())
+                dbgln("; - literal prefix: '{}'", *parser_result.optimization_data.literal_prefix);
+            if (parser_result.optimization_data.required_literal.has_value())
+                dbgln("; - required literal: '{}'", *parser_result.optimization_data.required_literal);
         }
     };
 
     auto& bytecode = parser_result.bytecode;
 
+    // Every opcode in the first block runs, in order, on every match attempt, so a run of single-character
+    // compares at the start of that block is a literal that every match has to start with.
+    StringBuilder literal_prefix;
+    auto required_literal = find_required_literal(bytecode);
+    ScopeGuard store_literals = [&] {
+        if (literal_prefix.length() > 1)
+            parser_result.optimization_data.literal_prefix = literal_prefix.to_byte_string();
+
+        // NOTE: Finding where a match could start already involves finding its literal prefix.
+        if (required_literal.has_value() && !literal_prefix.string_view().contains(required_literal->view()))
+            parser_result.optimization_data.required_literal = required_literal.release_value();
+    };
+
     auto state = MatchState::only_for_enumeration();
     auto block = blocks.first();
     for (state.instruction_position = block.start; state.instruction_position < block.end;) {
@@ -216,6 +338,16 @@ void Regex<Parser>::fill_optimization_data(BasicBlockList const& blocks)
             if (!interpret_compares(flat_compares, compares))
                 return; // No idea, the bytecode is too complex.
 
+            if (!parser_result.optimization_data.starting_ranges.is_empty()) {
+                // We're past the first compare, only keep extending the literal prefix.
+                auto character = single_ascii_character(compares);
+                if (!character.has_value())
+                    return;
+                literal_prefix.append(*character);
+                state.instruction_position += opcode.size();
+                continue;
+            }
+
             if (compares.has_any_unicode_property)
                 return; // Faster to just run the bytecode.
 
@@ -223,14 +355,35 @@ void Regex<Parser>::fill_optimization_data(BasicBlockList const& blocks)
             if (!compares.char_classes.is_empty() || !compares.negated_char_classes.is_empty() || !compares.negated_ranges.is_empty())
                 return;
 
+            size_t starting_character_count = 0;
+            bool only_ascii_starting_characters = true;
             for (auto it = compares.ranges.begin(); it != compares.ranges.end(); ++it) {
                 parser_result.optimization_data.starting_ranges.append({ it.key(), *it });
                 parser_result.optimization_data.starting_ranges_insensitive.append({ to_ascii_lowercase(it.key()), to_ascii_lowercase(*it) });
                 quick_sort(parser_result.optimization_data.starting_ranges_insensitive, [](CharRange a, CharRange b) { return a.from < b.from; });
+                starting_character_count += *it - it.key() + 1;
+                if (*it > 0x7f)
+                    only_ascii_starting_characters = false;
             }
-            return;
+
+            // A handful of ASCII characters can be scanned for with a few vector compares per chunk of input.
+            if (only_ascii_starting_characters && starting_character_count > 0 && starting_character_count <= 4) {
+                for (auto it = compares.ranges.begin(); it != compares.ranges.end(); ++it) {
+                    for (auto ch = it.key(); ch <= *it; ++ch)
+                        parser_result.optimization_data.starting_ascii_characters.append(static_cast<char>(ch));
+                }
+            }
+
+            auto character = single_ascii_character(compares);
+            if (!character.has_value())
+                return;
+            literal_prefix.append(*character);
+            state.instruction_position += opcode.size();
+            continue;
         }
         case OpCodeId::CheckBegin:
+            if (!parser_result.optimization_data.starting_ranges.is_empty())
+                return;
             parser_result.optimization_data.only_start_of_line = true;
             return;
         case OpCodeId::Checkpoint:
@@ -67,6 +67,12 @@ public:
             // If populated, the pattern only accepts strings that start with a character in these ranges.
             Vector<CharRange> starting_ranges;
             Vector<CharRange> starting_ranges_insensitive;
+            // If populated, every match starts with one of these (at most four) ASCII characters.
+            Vector<char> starting_ascii_characters;
+            // If populated, every match starts with this ASCII literal (at least two characters long).
+            Optional<ByteString> literal_prefix;
+            // If populated, every match contains this ASCII literal, though not necessarily at its start.
+            Optional<ByteString> required_literal;
             bool only_start_of_line = false;
         } optimization_data {};
     };
@@ -8,6 +8,8 @@
  */
 
 #include <AK/BinarySearch.h>
+#include <AK/ByteBuffer.h>
+#include <AK/Endian.h>
 #include <AK/StringBuilder.h>
 #include <AK/Utf16View.h>
 #include <AK/Utf8View.h>
@@ -348,10 +350,92 @@ bool Decoder::validate(StringView input)
 ErrorOr<String> Decoder::to_utf8(StringView input)
 {
     StringBuilder builder(input.length());
-    TRY(process(input, [&builder](u32 c) { return builder.try_append_code_point(c); }));
+    TRY(decode_into(input, builder));
     return builder.to_string_without_validation();
 }
 
+ErrorOr<void> Decoder::decode_into(StringView input, StringBuilder& output)
+{
+    DecoderStreamState state;
+    TRY(decode_bulk(state, input, output, true));
+    return {};
+}
+
+ErrorOr<void> Decoder::decode_chunk_into(DecoderStreamState& state, StringView input, StringBuilder& output, bool end_of_stream)
+{
+    ByteBuffer buffer;
+    if (!state.pending_bytes.is_empty()) {
+        // The previous chunk ended in the middle of a sequence, so decode its remaining bytes together with this chunk.
+        TRY(buffer.try_append(state.pending_bytes.span()));
+        TRY(buffer.try_append(input.bytes()));
+        state.pending_bytes.clear();
+        input = StringView { buffer.bytes() };
+    }
+
+    auto pending_length = TRY(decode_bulk(state, input, output, end_of_stream));
+    VERIFY(end_of_stream ? pending_length == 0 : pending_length <= input.length());
+    auto pending_bytes = input.bytes().slice(input.length() - pending_length);
+    TRY(state.pending_bytes.try_append(pending_bytes.data(), pending_bytes.size()));
+    return {};
+}
+
+ErrorOr<size_t> Decoder::decode_bulk(DecoderStreamState&, StringView input, StringBuilder& output, bool)
+{
+    // NOTE: This is only correct for decoders that don't keep state in between code points.
+    TRY(process(input, [&output](u32 code_point) { return output.try_append_code_point(code_point); }));
+    return 0;
+}
+
+// Appends runs of ASCII bytes to the output as a whole, and maps every other byte to a code point one by one.
+template<typename MapByte>
+static ErrorOr<void> decode_single_byte_encoding(StringView input, StringBuilder& output, MapByte map_byte)
+{
+    while (!input.is_empty()) {
+        auto ascii_length = input.length_of_ascii_prefix();
+        TRY(output.try_append(input.substring_view(0, ascii_length)));
+
+        auto index = ascii_length;
+        for (; index < input.length() && static_cast<u8>(input[index]) >= 0x80; ++index)
+            TRY(output.try_append_code_point(map_byte(static_cast<u8>(input[index]))));
+
+        input = input.substring_view(index);
+    }
+    return {};
+}
+
+// Returns the length of a UTF-8 sequence at the end of the input that is valid so far, but misses its last bytes.
+static size_t length_of_incomplete_utf8_sequence_at_end(ReadonlyBytes bytes)
+{
+    // A sequence is at most four bytes long, so only the last three bytes can belong to an incomplete one.
+    for (size_t length = 1; length <= min<size_t>(3, bytes.size()); ++length) {
+        auto lead = bytes[bytes.size() - length];
+        if ((lead & 0xC0) == 0x80)
+            continue;
+
+        size_t sequence_length = 0;
+        if (lead >= 0xC2 && lead <= 0xDF)
+            sequence_length = 2;
+        else if (lead >= 0xE0 && lead <= 0xEF)
+            sequence_length = 3;
+        else if (lead >= 0xF0 && lead <= 0xF4)
+            sequence_length = 4;
+        if (sequence_length <= length)
+            return 0;
+
+        // https://encoding.spec.whatwg.org/#utf-8-decoder
+        // Some lead bytes narrow down the range of the byte that follows them.
+        if (length >= 2) {
+            u8 lower_boundary = lead == 0xE0 ? 0xA0 : lead == 0xF0 ? 0x90 : 0x80;
+            u8 upper_boundary = lead == 0xED ? 0x9F : lead == 0xF4 ? 0x8F : 0xBF;
+            auto second = bytes[bytes.size() - length + 1];
+            if (second < lower_boundary || second > upper_boundary)
+                return 0;
+        }
+        return length;
+    }
+    return 0;
+}
+
 ErrorOr<void> UTF8Decoder::process(StringView input, Function<ErrorOr<void>(u32)> on_code_point)
 {
     for (auto c : Utf8View(input)) {
@@ -370,6 +454,54 @@ ErrorOr<String> UTF8Decoder::to_utf8(StringView input)
     return String::from_utf8_with_replacement_character(input);
 }
 
+ErrorOr<size_t> UTF8Decoder::decode_bulk(DecoderStreamState&, StringView input, StringBuilder& output, bool end_of_stream)
+{
+    auto pending_length = end_of_stream ? 0 : length_of_incomplete_utf8_sequence_at_end(input.bytes());
+    input = input.substring_view(0, input.length() - pending_length);
+
+    Utf8View utf8_view { input };
+    if (utf8_view.validate(AllowLonelySurrogates::No)) {
+        TRY(output.try_append(input));
+        return pending_length;
+    }
+
+    for (auto code_point : utf8_view)
+        TRY(output.try_append_code_point(is_unicode_surrogate(code_point) ? replacement_code_point : code_point));
+    return pending_length;
+}
+
+template<AK::Endianness endianness>
+static ErrorOr<size_t> decode_utf16(StringView input, StringBuilder& output, bool end_of_stream)
+{
+    auto bytes = input.bytes();
+    auto complete_length = bytes.size() - (bytes.size() % 2);
+
+    if (!end_of_stream && complete_length >= 2) {
+        // Keep a trailing lead surrogate around, as its trail surrogate may be in the next chunk.
+        auto first_byte = bytes[complete_length - 2];
+        auto second_byte = bytes[complete_length - 1];
+        u16 code_unit = endianness == AK::Endianness::Big ? (first_byte << 8) | second_byte : (second_byte << 8) | first_byte;
+        if (AK::UnicodeUtils::is_utf16_high_surrogate(code_unit))
+            complete_length -= 2;
+    }
+
+    auto complete_bytes = bytes.trim(complete_length);
+    String string;
+    if constexpr (endianness == AK::Endianness::Big)
+        string = TRY(String::from_utf16_be_with_replacement_character(complete_bytes));
+    else
+        string = TRY(String::from_utf16_le_with_replacement_character(complete_bytes));
+    TRY(output.try_append(string.bytes_as_string_view()));
+
+    if (!end_of_stream)
+        return bytes.size() - complete_length;
+
+    // A lone byte at the very end of the stream can't form a code unit.
+    if (complete_length != bytes.size())
+        TRY(output.try_append_code_point(replacement_code_point));
+    return 0;
+}
+
 bool UTF16BEDecoder::validate(StringView input)
 {
     return AK::validate_utf16_be(input.bytes());
@@ -384,6 +516,11 @@ ErrorOr<String> UTF16BEDecoder::to_utf8(StringView input)
     return String::from_utf16_be_with_replacement_character(input.bytes());
 }
 
+ErrorOr<size_t> UTF16BEDecoder::decode_bulk(DecoderStreamState&, StringView input, StringBuilder& output, bool end_of_stream)
+{
+    return decode_utf16<AK::Endianness::Big>(input, output, end_of_stream);
+}
+
 bool UTF16LEDecoder::validate(StringView input)
 {
     return AK::validate_utf16_le(input.bytes());
@@ -398,6 +535,11 @@ ErrorOr<String> UTF16LEDecoder::to_utf8(StringView input)
     return String::from_utf16_le_with_replacement_character(input.bytes());
 }
 
+ErrorOr<size_t> UTF16LEDecoder::decode_bulk(DecoderStreamState&, StringView input, StringBuilder& output, bool end_of_stream)
+{
+    return decode_utf16<AK::Endianness::Little>(input, output, end_of_stream);
+}
+
 ErrorOr<void> Latin1Decoder::process(StringView input, Function<ErrorOr<void>(u32)> on_code_point)
 {
     for (u8 ch : input) {
@@ -408,6 +550,12 @@ ErrorOr<void> Latin1Decoder::process(StringView input, Function<ErrorOr<void>(u3
     return {};
 }
 
+ErrorOr<size_t> Latin1Decoder::decode_bulk(DecoderStreamState&, StringView input, StringBuilder& output, bool)
+{
+    TRY(decode_single_byte_encoding(input, output, [](u8 byte) -> u32 { return byte; }));
+    return 0;
+}
+
 ErrorOr<void> PDFDocEncodingDecoder::process(StringView input, Function<ErrorOr<void>(u32)> on_code_point)
 {
     // PDF 1.7 spec, Appendix D.2 "PDFDocEncoding Character Set"
@@ -479,6 +627,12 @@ ErrorOr<void> XUserDefinedDecoder::process(StringView input, Function<ErrorOr<vo
     return {};
 }
 
+ErrorOr<size_t> XUserDefinedDecoder::decode_bulk(DecoderStreamState&, StringView input, StringBuilder& output, bool)
+{
+    TRY(decode_single_byte_encoding(input, output, [](u8 byte) -> u32 { return 0xF780 + byte - 0x80; }));
+    return 0;
+}
+
 // https://encoding.spec.whatwg.org/#single-byte-decoder
 template<Integral ArrayType>
 ErrorOr<void> SingleByteDecoder<ArrayType>::process(StringView input, Function<ErrorOr<void>(u32)> on_code_point)
@@ -502,6 +656,13 @@ ErrorOr<void> SingleByteDecoder<ArrayType>::process(StringView input, Function<E
     return {};
 }
 
+template<Integral ArrayType>
+ErrorOr<size_t> SingleByteDecoder<ArrayType>::decode_bulk(DecoderStreamState&, StringView input, StringBuilder& output, bool)
+{
+    TRY(decode_single_byte_encoding(input, output, [this](u8 byte) -> u32 { return m_translation_table[byte - 0x80]; }));
+    return 0;
+}
+
 // https://encoding.spec.whatwg.org/#index-gb18030-ranges-code-point
 static Optional<u32> index_gb18030_ranges_code_point(u32 pointer)
 {
@@ -569,7 +730,8 @@ static Optional<u32> index_gb18030_ranges_code_point(u32 pointer)
 }
 
 // https://encoding.spec.whatwg.org/#gb18030-decoder
-ErrorOr<void> GB18030Decoder::process(StringView input, Function<ErrorOr<void>(u32)> on_code_point)
+template<typename Callback>
+static ErrorOr<size_t> decode_gb18030(DecoderStreamState&, StringView input, bool end_of_stream, Callback on_code_point)
 {
     // gb18030’s decoder has an associated gb18030 first, gb18030 second, and gb18030 third (all initially 0x00).
     u8 first = 0x00;
@@ -581,7 +743,11 @@ ErrorOr<void> GB18030Decoder::process(StringView input, Function<ErrorOr<void>(u
     while (true) {
         // 1. If byte is end-of-queue and gb18030 first, gb18030 second, and gb18030 third are 0x00, return finished.
         if (index >= input.length() && first == 0x00 && second == 0x00 && third == 0x00)
-            return {};
+            return 0;
+
+        // NOTE: In the middle of a stream, the bytes of an incomplete sequence are kept for the next chunk instead.
+        if (index >= input.length() && !end_of_stream)
+            return (first != 0x00) + (second != 0x00) + (third != 0x00);
 
         // 2. If byte is end-of-queue, and gb18030 first, gb18030 second, or gb18030 third is not 0x00, set gb18030 first, gb18030 second, and gb18030 third to 0x00, and return error.
         if (index >= input.length() && (first != 0x00 || second != 0x00 || third != 0x00)) {
@@ -706,8 +872,21 @@ ErrorOr<void> GB18030Decoder::process(StringView input, Function<ErrorOr<void>(u
     }
 }
 
+ErrorOr<void> GB18030Decoder::process(StringView input, Function<ErrorOr<void>(u32)> on_code_point)
+{
+    DecoderStreamState state;
+    TRY(decode_gb18030(state, input, true, [&](u32 code_point) { return on_code_point(code_point); }));
+    return {};
+}
+
+ErrorOr<size_t> GB18030Decoder::decode_bulk(DecoderStreamState& state, StringView input, StringBuilder& output, bool end_of_stream)
+{
+    return decode_gb18030(state, input, end_of_stream, [&](u32 code_point) { return output.try_append_code_point(code_point); });
+}
+
 // https://encoding.spec.whatwg.org/#big5-decoder
-ErrorOr<void> Big5Decoder::process(StringView input, Function<ErrorOr<void>(u32)> on_code_point)
+template<typename Callback>
+static ErrorOr<size_t> decode_big5(DecoderStreamState&, StringView input, bool end_of_stream, Callback on_code_point)
 {
     // Big5’s decoder has an associated Big5 lead (initially 0x00).
     u8 big5_lead = 0x00;
@@ -715,6 +894,10 @@ ErrorOr<void> Big5Decoder::process(StringView input, Function<ErrorOr<void>(u32)
     // Big5’s decoder’s handler, given ioQueue and byte, runs these steps:
     size_t index = 0;
     while (true) {
+        // NOTE: In the middle of a stream, a pending lead byte is kept for the next chunk instead.
+        if (index >= input.length() && !end_of_stream && big5_lead != 0x00)
+            return 1;
+
         // 1. If byte is end-of-queue and Big5 lead is not 0x00, set Big5 lead to 0x00 and return error.
         if (index >= input.length() && big5_lead != 0x00) {
             big5_lead = 0x00;
@@ -724,7 +907,7 @@ ErrorOr<void> Big5Decoder::process(StringView input, Function<ErrorOr<void>(u32)
 
         // 2. If byte is end-of-queue and Big5 lead is 0x00, return finished.
         if (index >= input.length() && big5_lead == 0x00)
-            return {};
+            return 0;
 
         u8 const byte = input[index++];
 
@@ -798,8 +981,21 @@ ErrorOr<void> Big5Decoder::process(StringView input, Function<ErrorOr<void>(u32)
     }
 }
 
+ErrorOr<void> Big5Decoder::process(StringView input, Function<ErrorOr<void>(u32)> on_code_point)
+{
+    DecoderStreamState state;
+    TRY(decode_big5(state, input, true, [&](u32 code_point) { return on_code_point(code_point); }));
+    return {};
+}
+
+ErrorOr<size_t> Big5Decoder::decode_bulk(DecoderStreamState& state, StringView input, StringBuilder& output, bool end_of_stream)
+{
+    return decode_big5(state, input, end_of_stream, [&](u32 code_point) { return output.try_append_code_point(code_point); });
+}
+
 // https://encoding.spec.whatwg.org/#euc-jp-decoder
-ErrorOr<void> EUCJPDecoder::process(StringView input, Function<ErrorOr<void>(u32)> on_code_point)
+template<typename Callback>
+static ErrorOr<size_t> decode_euc_jp(DecoderStreamState&, StringView input, bool end_of_stream, Callback on_code_point)
 {
     // EUC-JP’s decoder has an associated EUC-JP jis0212 (initially false) and EUC-JP lead (initially 0x00).
     bool jis0212 = false;
@@ -808,6 +1004,10 @@ ErrorOr<void> EUCJPDecoder::process(StringView input, Function<ErrorOr<void>(u32
     // EUC-JP’s decoder’s handler, given ioQueue and byte, runs these steps:
     size_t index = 0;
     while (true) {
+        // NOTE: In the middle of a stream, the bytes of an incomplete sequence are kept for the next chunk instead.
+        if (index >= input.length() && !end_of_stream && euc_jp_lead != 0x00)
+            return jis0212 ? 2 : 1;
+
         // 1. If byte is end-of-queue and EUC-JP lead is not 0x00, set EUC-JP lead to 0x00, and return error.
         if (index >= input.length() && euc_jp_lead != 0x00) {
             euc_jp_lead = 0x00;
@@ -817,7 +1017,7 @@ ErrorOr<void> EUCJPDecoder::process(StringView input, Function<ErrorOr<void>(u32
 
         // 2. If byte is end-of-queue and EUC-JP lead is 0x00, return finished.
         if (index >= input.length() && euc_jp_lead == 0x00)
-            return {};
+            return 0;
 
         u8 const byte = input[index++];
 
@@ -884,7 +1084,19 @@ ErrorOr<void> EUCJPDecoder::process(StringView input, Function<ErrorOr<void>(u32
     }
 }
 
-enum class ISO2022JPState {
+ErrorOr<void> EUCJPDecoder::process(StringView input, Function<ErrorOr<void>(u32)> on_code_point)
+{
+    DecoderStreamState state;
+    TRY(decode_euc_jp(state, input, true, [&](u32 code_point) { return on_code_point(code_point); }));
+    return {};
+}
+
+ErrorOr<size_t> EUCJPDecoder::decode_bulk(DecoderStreamState& state, StringView input, StringBuilder& output, bool end_of_stream)
+{
+    return decode_euc_jp(state, input, end_of_stream, [&](u32 code_point) { return output.try_append_code_point(code_point); });
+}
+
+enum class ISO2022JPState : u8 {
     ASCII,
     Roman,
     Katakana,
@@ -895,13 +1107,15 @@ enum class ISO2022JPState {
 };
 
 // https://encoding.spec.whatwg.org/#iso-2022-jp-decoder
-ErrorOr<void> ISO2022JPDecoder::process(StringView input, Function<ErrorOr<void>(u32)> on_code_point)
+template<typename Callback>
+static ErrorOr<size_t> decode_iso_2022_jp(DecoderStreamState& state, StringView input, bool end_of_stream, Callback on_code_point)
 {
     // ISO-2022-JP’s decoder has an associated ISO-2022-JP decoder state (initially ASCII), ISO-2022-JP decoder output state (initially ASCII), ISO-2022-JP lead (initially 0x00), and ISO-2022-JP output (initially false).
-    auto decoder_state = ISO2022JPState::ASCII;
-    auto output_state = ISO2022JPState::ASCII;
+    // NOTE: When continuing a stream, both states start out in the mode the previous chunk ended in.
+    auto decoder_state = static_cast<ISO2022JPState>(state.mode);
+    auto output_state = decoder_state;
     u8 iso2022_jp_lead = 0x00;
-    bool iso2022_jp_output = false;
+    bool iso2022_jp_output = state.flag;
 
     size_t index = 0;
     while (true) {
@@ -909,6 +1123,22 @@ ErrorOr<void> ISO2022JPDecoder::process(StringView input, Function<ErrorOr<void>
         if (index < input.length())
             byte = input[index++];
 
+        // NOTE: In the middle of a stream, the bytes of an incomplete sequence are kept for the next chunk instead, which
+        //       then starts out in the current mode again.
+        if (!byte.has_value() && !end_of_stream) {
+            state.mode = to_underlying(output_state);
+            state.flag = iso2022_jp_output;
+            switch (decoder_state) {
+            case ISO2022JPState::TrailByte:
+            case ISO2022JPState::EscapeStart:
+                return 1;
+            case ISO2022JPState::Escape:
+                return 2;
+            default:
+                return 0;
+            }
+        }
+
         // ISO-2022-JP’s decoder’s handler, given ioQueue and byte, runs these steps, switching on ISO-2022-JP decoder state:
         switch (decoder_state) {
         case ISO2022JPState::ASCII:
@@ -928,7 +1158,7 @@ ErrorOr<void> ISO2022JPDecoder::process(StringView input, Function<ErrorOr<void>
 
             // end-of-queue: Return finished.
             if (!byte.has_value())
-                return {};
+                return 0;
 
             // Otherwise: Set ISO-2022-JP output to false and return error.
             iso2022_jp_output = false;
@@ -965,7 +1195,7 @@ ErrorOr<void> ISO2022JPDecoder::process(StringView input, Function<ErrorOr<void>
 
             // end-of-queue: Return finished.
             if (!byte.has_value())
-                return {};
+                return 0;
 
             // Otherwise: Set ISO-2022-JP output to false and return error.
             iso2022_jp_output = false;
@@ -988,7 +1218,7 @@ ErrorOr<void> ISO2022JPDecoder::process(StringView input, Function<ErrorOr<void>
 
             // end-of-queue: Return finished.
             if (!byte.has_value())
-                return {};
+                return 0;
 
             // Otherwise: Set ISO-2022-JP output to false and return error.
             iso2022_jp_output = false;
@@ -1012,7 +1242,7 @@ ErrorOr<void> ISO2022JPDecoder::process(StringView input, Function<ErrorOr<void>
 
             // end-of-queue: Return finished.
             if (!byte.has_value())
-                return {};
+                return 0;
 
             // Otherwise: Set ISO-2022-JP output to false and return error.
             iso2022_jp_output = false;
@@ -1133,8 +1363,21 @@ ErrorOr<void> ISO2022JPDecoder::process(StringView input, Function<ErrorOr<void>
     }
 }
 
+ErrorOr<void> ISO2022JPDecoder::process(StringView input, Function<ErrorOr<void>(u32)> on_code_point)
+{
+    DecoderStreamState state;
+    TRY(decode_iso_2022_jp(state, input, true, [&](u32 code_point) { return on_code_point(code_point); }));
+    return {};
+}
+
+ErrorOr<size_t> ISO2022JPDecoder::decode_bulk(DecoderStreamState& state, StringView input, StringBuilder& output, bool end_of_stream)
+{
+    return decode_iso_2022_jp(state, input, end_of_stream, [&](u32 code_point) { return output.try_append_code_point(code_point); });
+}
+
 // https://encoding.spec.whatwg.org/#shift_jis-decoder
-ErrorOr<void> ShiftJISDecoder::process(StringView input, Function<ErrorOr<void>(u32)> on_code_point)
+template<typename Callback>
+static ErrorOr<size_t> decode_shift_jis(DecoderStreamState&, StringView input, bool end_of_stream, Callback on_code_point)
 {
     // Shift_JIS’s decoder has an associated Shift_JIS lead (initially 0x00).
     u8 shift_jis_lead = 0x00;
@@ -1142,6 +1385,10 @@ ErrorOr<void> ShiftJISDecoder::process(StringView input, Function<ErrorOr<void>(
     // Shift_JIS’s decoder’s handler, given ioQueue and byte, runs these steps:
     size_t index = 0;
     while (true) {
+        // NOTE: In the middle of a stream, a pending lead byte is kept for the next chunk instead.
+        if (index >= input.length() && !end_of_stream && shift_jis_lead != 0x00)
+            return 1;
+
         // 1. If byte is end-of-queue and Shift_JIS lead is not 0x00, set Shift_JIS lead to 0x00 and return error.
         if (index >= input.length() && shift_jis_lead != 0x00) {
             shift_jis_lead = 0x00;
@@ -1151,7 +1398,7 @@ ErrorOr<void> ShiftJISDecoder::process(StringView input, Function<ErrorOr<void>(
 
         // 2. If byte is end-of-queue and Shift_JIS lead is 0x00, return finished.
         if (index >= input.length() && shift_jis_lead == 0x00)
-            return {};
+            return 0;
 
         u8 const byte = input[index++];
 
@@ -1218,8 +1465,21 @@ ErrorOr<void> ShiftJISDecoder::process(StringView input, Function<ErrorOr<void>(
     }
 }
 
+ErrorOr<void> ShiftJISDecoder::process(StringView input, Function<ErrorOr<void>(u32)> on_code_point)
+{
+    DecoderStreamState state;
+    TRY(decode_shift_jis(state, input, true, [&](u32 code_point) { return on_code_point(code_point); }));
+    return {};
+}
+
+ErrorOr<size_t> ShiftJISDecoder::decode_bulk(DecoderStreamState& state, StringView input, StringBuilder& output, bool end_of_stream)
+{
+    return decode_shift_jis(state, input, end_of_stream, [&](u32 code_point) { return output.try_append_code_point(code_point); });
+}
+
 // https://encoding.spec.whatwg.org/#euc-kr-decoder
-ErrorOr<void> EUCKRDecoder::process(StringView input, Function<ErrorOr<void>(u32)> on_code_point)
+template<typename Callback>
+static ErrorOr<size_t> decode_euc_kr(DecoderStreamState&, StringView input, bool end_of_stream, Callback on_code_point)
 {
     // EUC-KR’s decoder has an associated EUC-KR lead (initially 0x00).
     u8 euc_kr_lead = 0x00;
@@ -1227,6 +1487,10 @@ ErrorOr<void> EUCKRDecoder::process(StringView input, Function<ErrorOr<void>(u32
     // EUC-KR’s decoder’s handler, given ioQueue and byte, runs these steps:
     size_t index = 0;
     while (true) {
+        // NOTE: In the middle of a stream, a pending lead byte is kept for the next chunk instead.
+        if (index >= input.length() && !end_of_stream && euc_kr_lead != 0x00)
+            return 1;
+
         // 1. If byte is end-of-queue and EUC-KR lead is not 0x00, set EUC-KR lead to 0x00 and return error.
         if (index >= input.length() && euc_kr_lead != 0x00) {
             euc_kr_lead = 0x00;
@@ -1236,7 +1500,7 @@ ErrorOr<void> EUCKRDecoder::process(StringView input, Function<ErrorOr<void>(u32
 
         // 2. If byte is end-of-queue and EUC-KR lead is 0x00, return finished.
         if (index >= input.length() && euc_kr_lead == 0x00)
-            return {};
+            return 0;
 
         u8 const byte = input[index++];
 
@@ -1285,6 +1549,18 @@ ErrorOr<void> EUCKRDecoder::process(StringView input, Function<ErrorOr<void>(u32
     }
 }
 
+ErrorOr<void> EUCKRDecoder::process(StringView input, Function<ErrorOr<void>(u32)> on_code_point)
+{
+    DecoderStreamState state;
+    TRY(decode_euc_kr(state, input, true, [&](u32 code_point) { return on_code_point(code_point); }));
+    return {};
+}
+
+ErrorOr<size_t> EUCKRDecoder::decode_bulk(DecoderStreamState& state, StringView input, StringBuilder& output, bool end_of_stream)
+{
+    return decode_euc_kr(state, input, end_of_stream, [&](u32 code_point) { return output.try_append_code_point(code_point); });
+}
+
 // https://encoding.spec.whatwg.org/#replacement-decoder
 ErrorOr<void> ReplacementDecoder::process(StringView input, Function<ErrorOr<void>(u32)> on_code_point)
 {
@@ -1299,4 +1575,14 @@ ErrorOr<void> ReplacementDecoder::process(StringView input, Function<ErrorOr<voi
     return {};
 }
 
+ErrorOr<size_t> ReplacementDecoder::decode_bulk(DecoderStreamState& state, StringView input, StringBuilder& output, bool)
+{
+    // NOTE: The replacement error returned flag is kept in the state, so that a stream only produces a single error.
+    if (!input.is_empty() && !state.flag) {
+        state.flag = true;
+        TRY(output.try_append_code_point(replacement_code_point));
+    }
+    return 0;
+}
+
 }
@@ -12,18 +12,39 @@
 #include <AK/Function.h>
 #include <AK/Optional.h>
 #include <AK/String.h>
+#include <AK/Vector.h>
 #include <LibTextCodec/Forward.h>
 
 namespace TextCodec {
 
+// The state of a decoder in between the chunks of a stream. Decoders themselves are stateless and shared.
+struct DecoderStreamState {
+    // The bytes of a sequence that was still incomplete at the end of the previous chunk.
+    Vector<u8, 4> pending_bytes;
+
+    // Encoding specific state that outlives a single sequence, e.g. the current ISO-2022-JP mode.
+    u8 mode { 0 };
+    bool flag { false };
+};
+
 class TEXTCODEC_API Decoder {
 public:
     virtual bool validate(StringView);
     virtual ErrorOr<String> to_utf8(StringView);
 
+    // Decodes the input in bulk and appends it to the output, which may be in either UTF-8 or UTF-16 mode.
+    ErrorOr<void> decode_into(StringView input, StringBuilder& output);
+
+    // Like decode_into(), but for one chunk of a stream. A sequence left incomplete at the end of the chunk is kept in
+    // the state and completed by the next one; it is only reported as an error once end_of_stream is set.
+    ErrorOr<void> decode_chunk_into(DecoderStreamState&, StringView input, StringBuilder& output, bool end_of_stream);
+
 protected:
     virtual ~Decoder() = default;
     virtual ErrorOr<void> process(StringView, Function<ErrorOr<void>(u32)> on_code_point) = 0;
+
+    // Returns the number of bytes at the end of the input that were left undecoded because end_of_stream is not set.
+    virtual ErrorOr<size_t> decode_bulk(DecoderStreamState&, StringView input, StringBuilder& output, bool end_of_stream);
 };
 
 class TEXTCODEC_API UTF8Decoder final : public Decoder {
@@ -31,6 +52,9 @@ public:
     virtual ErrorOr<void> process(StringView, Function<ErrorOr<void>(u32)> on_code_point) override;
     virtual bool validate(StringView) override;
     virtual ErrorOr<String> to_utf8(StringView) override;
+
+protected:
+    virtual ErrorOr<size_t> decode_bulk(DecoderStreamState&, StringView, StringBuilder&, bool end_of_stream) override;
 };
 
 class TEXTCODEC_API UTF16BEDecoder final : public Decoder {
@@ -40,6 +64,7 @@ public:
 
 private:
     virtual ErrorOr<void> process(StringView, Function<ErrorOr<void>(u32)>) override { VERIFY_NOT_REACHED(); }
+    virtual ErrorOr<size_t> decode_bulk(DecoderStreamState&, StringView, StringBuilder&, bool end_of_stream) override;
 };
 
 class TEXTCODEC_API UTF16LEDecoder final : public Decoder {
@@ -49,6 +74,7 @@ public:
 
 private:
     virtual ErrorOr<void> process(StringView, Function<ErrorOr<void>(u32)>) override { VERIFY_NOT_REACHED(); }
+    virtual ErrorOr<size_t> decode_bulk(DecoderStreamState&, StringView, StringBuilder&, bool end_of_stream) override;
 };
 
 template<Integral ArrayType = u32>
@@ -61,6 +87,9 @@ public:
 
     virtual ErrorOr<void> process(StringView, Function<ErrorOr<void>(u32)> on_code_point) override;
 
+protected:
+    virtual ErrorOr<size_t> decode_bulk(DecoderStreamState&, StringView, StringBuilder&, bool end_of_stream) override;
+
 private:
     Array<ArrayType, 128> m_translation_table;
 };
@@ -69,6 +98,9 @@ class TEXTCODEC_API Latin1Decoder final : public Decoder {
 public:
     virtual ErrorOr<void> process(StringView, Function<ErrorOr<void>(u32)> on_code_point) override;
     virtual bool validate(StringView) override { return true; }
+
+protected:
+    virtual ErrorOr<size_t> decode_bulk(DecoderStreamState&, StringView, StringBuilder&, bool end_of_stream) override;
 };
 
 class TEXTCODEC_API PDFDocEncodingDecoder final : public Decoder {
@@ -81,42 +113,66 @@ class TEXTCODEC_API XUserDefinedDecoder final : public Decoder {
 public:
     virtual ErrorOr<void> process(StringView, Function<ErrorOr<void>(u32)> on_code_point) override;
     virtual bool validate(StringView) override { return true; }
+
+protected:
+    virtual ErrorOr<size_t> decode_bulk(DecoderStreamState&, StringView, StringBuilder&, bool end_of_stream) override;
 };
 
 class TEXTCODEC_API GB18030Decoder final : public Decoder {
 public:
     virtual ErrorOr<void> process(StringView, Function<ErrorOr<void>(u32)> on_code_point) override;
+
+protected:
+    virtual ErrorOr<size_t> decode_bulk(DecoderStreamState&, StringView, StringBuilder&, bool end_of_stream) override;
 };
 
 class TEXTCODEC_API Big5Decoder final : public Decoder {
 public:
     virtual ErrorOr<void> process(StringView, Function<ErrorOr<void>(u32)> on_code_point) override;
+
+protected:
+    virtual ErrorOr<size_t> decode_bulk(DecoderStreamState&, StringView, StringBuilder&, bool end_of_stream) override;
 };
 
 class TEXTCODEC_API EUCJPDecoder final : public Decoder {
 public:
     virtual ErrorOr<void> process(StringView, Function<ErrorOr<void>(u32)> on_code_point) override;
+
+protected:
+    virtual ErrorOr<size_t> decode_bulk(DecoderStreamState&, StringView, StringBuilder&, bool end_of_stream) override;
 };
 
 class TEXTCODEC_API ISO2022JPDecoder final : public Decoder {
 public:
     virtual ErrorOr<void> process(StringView, Function<ErrorOr<void>(u32)> on_code_point) override;
+
+protected:
+    virtual ErrorOr<size_t> decode_bulk(DecoderStreamState&, StringView, StringBuilder&, bool end_of_stream) override;
 };
 
 class TEXTCODEC_API ShiftJISDecoder final : public Decoder {
 public:
     virtual ErrorOr<void> process(StringView, Function<ErrorOr<void>(u32)> on_code_point) override;
+
+protected:
+    virtual ErrorOr<size_t> decode_bulk(DecoderStreamState&, StringView, StringBuilder&, bool end_of_stream) override;
 };
 
 class TEXTCODEC_API EUCKRDecoder final : public Decoder {
 public:
     virtual ErrorOr<void> process(StringView, Function<ErrorOr<void>(u32)> on_code_point) override;
+
+protected:
+    virtual ErrorOr<size_t> decode_bulk(DecoderStreamState&, StringView, StringBuilder&, bool end_of_stream) override;
 };
 
 class TEXTCODEC_API ReplacementDecoder final : public Decoder {
 public:
     virtual ErrorOr<void> process(StringView, Function<ErrorOr<void>(u32)> on_code_point) override;
     virtual bool validate(StringView input) override { return input.is_empty(); }
+
+protected:
+    virtual ErrorOr<size_t> decode_bulk(DecoderStreamState&, StringView, StringBuilder&, bool end_of_stream) override;
 };
 
 // This will return a decoder for the exact name specified, skipping get_standardized_encoding.
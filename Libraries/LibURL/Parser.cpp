@@ -718,11 +718,133 @@ static String remove_ascii_tab_or_newline(StringView input)
     return MUST(output.to_string());
 }
 
+// OPTIMIZATION: Most URLs we are asked to parse are absolute URLs with a special scheme that are already in their
+//               serialized form, e.g. "https://example.com/script.js?v=2". Running those through the state machine a
+//               code point at a time only reproduces the input, so instead we check in a single pass that the input
+//               would serialize to itself. If it does, each component is copied straight out of the input. Anything
+//               we're not sure about is left to the full parser.
+Optional<URL> Parser::parse_canonical_ascii_url(StringView input)
+{
+    auto is_canonical_character = [](char character, StringView percent_encoded_characters) {
+        return character > ' ' && character < 0x7F && !percent_encoded_characters.contains(character);
+    };
+
+    // The scheme must be lowercase and special, followed by "//". File URLs are excluded, as their hosts and paths
+    // have quirks of their own.
+    auto colon = input.find(':');
+    if (!colon.has_value())
+        return {};
+    auto scheme = input.substring_view(0, *colon);
+    if (!scheme.is_one_of("http"sv, "https"sv, "ws"sv, "wss"sv, "ftp"sv))
+        return {};
+    if (!input.substring_view(*colon + 1).starts_with("//"sv))
+        return {};
+
+    // The host must be a lowercase ASCII domain that domain to ASCII leaves as-is, i.e. without any "xn--" labels,
+    // and that doesn't end in a number (which would make it an IPv4 address). Credentials and IPv6 addresses are not
+    // handled here.
+    size_t position = *colon + 3;
+    size_t host_start = position;
+    for (; position < input.length() && !"/?#:"sv.contains(input[position]); ++position) {
+        auto character = input[position];
+        if (!is_ascii_lower_alpha(character) && !is_ascii_digit(character) && character != '-' && character != '.')
+            return {};
+    }
+    auto host = input.substring_view(host_start, position - host_start);
+    if (host.is_empty() || host.ends_with('.'))
+        return {};
+    if (host.starts_with("xn--"sv) || host.contains(".xn--"sv))
+        return {};
+    auto last_label_start = host.find_last('.').map([](auto index) { return index + 1; }).value_or(0);
+    if (is_ascii_digit(host[last_label_start]))
+        return {};
+
+    // Empty ports, ports with leading zeroes, and default ports are all serialized differently than they're written.
+    Optional<u16> port;
+    if (position < input.length() && input[position] == ':') {
+        size_t port_start = ++position;
+        while (position < input.length() && is_ascii_digit(input[position]))
+            ++position;
+        auto port_string = input.substring_view(port_start, position - port_start);
+        if (port_string.is_empty() || port_string.length() > 5 || (port_string.length() > 1 && port_string[0] == '0'))
+            return {};
+        auto port_number = port_string.to_number<u32>();
+        if (!port_number.has_value() || *port_number > NumericLimits<u16>::max())
+            return {};
+        if (default_port_for_scheme(scheme) == static_cast<u16>(*port_number))
+            return {};
+        port = static_cast<u16>(*port_number);
+    }
+
+    size_t path_start = position;
+    if (position < input.length() && input[position] != '/' && input[position] != '?' && input[position] != '#')
+        return {};
+    for (; position < input.length() && input[position] != '?' && input[position] != '#'; ++position) {
+        if (!is_canonical_character(input[position], "\"<>\\^`{}"sv))
+            return {};
+    }
+    size_t path_end = position;
+
+    Optional<size_t> query_start;
+    if (position < input.length() && input[position] == '?') {
+        query_start = ++position;
+        for (; position < input.length() && input[position] != '#'; ++position) {
+            if (!is_canonical_character(input[position], "\"<>'"sv))
+                return {};
+        }
+    }
+    size_t query_end = position;
+
+    Optional<size_t> fragment_start;
+    if (position < input.length() && input[position] == '#') {
+        fragment_start = ++position;
+        for (; position < input.length(); ++position) {
+            if (!is_canonical_character(input[position], "\"<>`"sv))
+                return {};
+        }
+    }
+
+    auto slice = [&](size_t start, size_t length) {
+        return String::from_utf8_without_validation(input.substring_view(start, length).bytes());
+    };
+
+    URL url;
+    url.m_data->scheme = slice(0, scheme.length());
+    url.m_data->host = Host { slice(host_start, host.length()) };
+    url.m_data->port = port;
+
+    // NOTE: A missing path serializes as "/", i.e. a single empty segment.
+    auto path = input.substring_view(path_start, path_end - path_start);
+    if (path.is_empty())
+        url.m_data->paths.append(String {});
+    for (size_t segment_start = 1, i = 1; i <= path.length(); ++i) {
+        if (i != path.length() && path[i] != '/')
+            continue;
+        auto segment = path.substring_view(segment_start, i - segment_start);
+        if (is_single_dot_path_segment(segment) || is_double_dot_path_segment(segment))
+            return {};
+        url.m_data->paths.append(slice(path_start + segment_start, segment.length()));
+        segment_start = i + 1;
+    }
+
+    if (query_start.has_value())
+        url.m_data->query = slice(*query_start, query_end - *query_start);
+    if (fragment_start.has_value())
+        url.m_data->fragment = slice(*fragment_start, input.length() - *fragment_start);
+
+    return url;
+}
+
 // https://url.spec.whatwg.org/#concept-basic-url-parser
 Optional<URL> Parser::basic_parse(StringView raw_input, Optional<URL const&> base_url, URL* url, Optional<State> state_override, Optional<StringView> encoding)
 {
     dbgln_if(URL_PARSER_DEBUG, "URL::Parser::basic_parse: Parsing '{}'", raw_input);
 
+    if (!url && !state_override.has_value()) {
+        if (auto canonical_url = parse_canonical_ascii_url(raw_input); canonical_url.has_value())
+            return canonical_url;
+    }
+
     size_t start_index = 0;
     size_t end_index = raw_input.length();
 
@@ -125,6 +125,11 @@ WebIDL::ExceptionOr<Vector<GC::Ref<Animation>>> Animatable::get_animations_inter
     return relevant_animations;
 }
 
+bool Animatable::has_associated_animations() const
+{
+    return m_impl && !m_impl->associated_animations.is_empty();
+}
+
 void Animatable::associate_with_animation(GC::Ref<Animation> animation)
 {
     auto& impl = ensure_impl();
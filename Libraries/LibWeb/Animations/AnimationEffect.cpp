@@ -666,11 +666,13 @@ AnimationUpdateContext::~AnimationUpdateContext()
             continue;
 
         // Traversal of the subtree is necessary to update the animated properties inherited from the target element.
+        bool did_invalidate_descendants = false;
         target->for_each_in_subtree_of_type<DOM::Element>([&](auto& element) {
             auto element_invalidation = element.recompute_inherited_style();
             if (element_invalidation.is_none())
                 return TraversalDecision::SkipChildrenAndContinue;
             invalidation |= element_invalidation;
+            did_invalidate_descendants = true;
             return TraversalDecision::Continue;
         });
 
@@ -694,7 +696,15 @@ AnimationUpdateContext::~AnimationUpdateContext()
             }
         }
         if (invalidation.repaint) {
-            element.document().set_needs_display();
+            // NOTE: If nothing but how the target itself is painted has changed, which is the case for most animations
+            //       of e.g. opacity and transforms, only the commands recorded for it have to be recorded again.
+            auto* paintable = target->paintable();
+            if (paintable && !element.pseudo_element().has_value() && !did_invalidate_descendants && !invalidation.relayout && !invalidation.rebuild_layout_tree && !invalidation.rebuild_stacking_context_tree) {
+                element.document().invalidate_display_list_for(*paintable);
+                element.document().set_needs_display(InvalidateDisplayList::No);
+            } else {
+                element.document().set_needs_display();
+            }
             element.document().set_needs_to_resolve_paint_only_properties();
         }
         if (invalidation.rebuild_stacking_context_tree)
@@ -50,6 +50,233 @@ ComputedProperties::ComputedProperties() = default;
 
 ComputedProperties::~ComputedProperties() = default;
 
+GC::Ref<ComputedProperties> ComputedProperties::clone() const
+{
+    auto clone = heap().allocate<ComputedProperties>();
+    clone->m_animation_name_source = m_animation_name_source;
+    clone->m_transition_property_source = m_transition_property_source;
+    clone->m_property_groups = m_property_groups;
+    clone->m_property_important = m_property_important;
+    clone->m_property_inherited = m_property_inherited;
+    clone->m_animated_property_inherited = m_animated_property_inherited;
+    clone->m_animated_property_values = m_animated_property_values;
+    clone->m_math_depth = m_math_depth;
+    clone->m_font_list = m_font_list;
+    clone->m_first_available_computed_font = m_first_available_computed_font;
+    clone->m_line_height = m_line_height;
+    clone->m_attempted_pseudo_class_matches = m_attempted_pseudo_class_matches;
+    return clone;
+}
+
+enum class PropertyCategory : u8 {
+    Font,
+    Text,
+    Box,
+    FlexAndGrid,
+    Background,
+    Border,
+    Effects,
+    Animation,
+    SVG,
+    Other,
+};
+static_assert(to_underlying(PropertyCategory::Other) + 1 == ComputedProperties::number_of_property_categories);
+
+struct PropertyCategoryName {
+    StringView name;
+    PropertyCategory category;
+};
+
+// NOTE: A name here covers the property of that name and every property whose name starts with it and a dash.
+//       The first matching name wins, and anything that matches none of them ends up in PropertyCategory::Other.
+static constexpr PropertyCategoryName property_category_names[] = {
+    { "font"sv, PropertyCategory::Font },
+    { "line-height"sv, PropertyCategory::Font },
+    { "letter-spacing"sv, PropertyCategory::Font },
+    { "word-spacing"sv, PropertyCategory::Font },
+    { "math"sv, PropertyCategory::Font },
+    { "color"sv, PropertyCategory::Text },
+    { "text"sv, PropertyCategory::Text },
+    { "white-space"sv, PropertyCategory::Text },
+    { "word"sv, PropertyCategory::Text },
+    { "overflow-wrap"sv, PropertyCategory::Text },
+    { "hyphens"sv, PropertyCategory::Text },
+    { "tab-size"sv, PropertyCategory::Text },
+    { "direction"sv, PropertyCategory::Text },
+    { "writing-mode"sv, PropertyCategory::Text },
+    { "unicode-bidi"sv, PropertyCategory::Text },
+    { "list-style"sv, PropertyCategory::Text },
+    { "quotes"sv, PropertyCategory::Text },
+    { "display"sv, PropertyCategory::Box },
+    { "position"sv, PropertyCategory::Box },
+    { "float"sv, PropertyCategory::Box },
+    { "clear"sv, PropertyCategory::Box },
+    { "margin"sv, PropertyCategory::Box },
+    { "padding"sv, PropertyCategory::Box },
+    { "width"sv, PropertyCategory::Box },
+    { "height"sv, PropertyCategory::Box },
+    { "min"sv, PropertyCategory::Box },
+    { "max"sv, PropertyCategory::Box },
+    { "block-size"sv, PropertyCategory::Box },
+    { "inline-size"sv, PropertyCategory::Box },
+    { "aspect-ratio"sv, PropertyCategory::Box },
+    { "box-sizing"sv, PropertyCategory::Box },
+    { "inset"sv, PropertyCategory::Box },
+    { "top"sv, PropertyCategory::Box },
+    { "right"sv, PropertyCategory::Box },
+    { "bottom"sv, PropertyCategory::Box },
+    { "left"sv, PropertyCategory::Box },
+    { "overflow"sv, PropertyCategory::Box },
+    { "z-index"sv, PropertyCategory::Box },
+    { "flex"sv, PropertyCategory::FlexAndGrid },
+    { "grid"sv, PropertyCategory::FlexAndGrid },
+    { "align"sv, PropertyCategory::FlexAndGrid },
+    { "justify"sv, PropertyCategory::FlexAndGrid },
+    { "order"sv, PropertyCategory::FlexAndGrid },
+    { "row-gap"sv, PropertyCategory::FlexAndGrid },
+    { "column-gap"sv, PropertyCategory::FlexAndGrid },
+    { "background"sv, PropertyCategory::Background },
+    { "border"sv, PropertyCategory::Border },
+    { "outline"sv, PropertyCategory::Border },
+    { "box-shadow"sv, PropertyCategory::Border },
+    { "opacity"sv, PropertyCategory::Effects },
+    { "transform"sv, PropertyCategory::Effects },
+    { "filter"sv, PropertyCategory::Effects },
+    { "mask"sv, PropertyCategory::Effects },
+    { "clip"sv, PropertyCategory::Effects },
+    { "animation"sv, PropertyCategory::Animation },
+    { "transition"sv, PropertyCategory::Animation },
+    { "fill"sv, PropertyCategory::SVG },
+    { "stroke"sv, PropertyCategory::SVG },
+};
+
+static PropertyCategory property_category(PropertyID property_id)
+{
+    auto name = string_from_property_id(property_id).bytes_as_string_view();
+    for (auto const& entry : property_category_names) {
+        if (name == entry.name || (name.starts_with(entry.name) && name.length() > entry.name.length() && name[entry.name.length()] == '-'))
+            return entry.category;
+    }
+    return PropertyCategory::Other;
+}
+
+struct PropertyGroupLocation {
+    u16 group { 0 };
+    u16 index { 0 };
+};
+
+struct PropertyGroupLayout {
+    Array<PropertyGroupLocation, number_of_longhand_properties> locations;
+    Array<u16, ComputedProperties::number_of_property_groups> group_sizes {};
+};
+
+// Each category gets two groups: one for its inherited properties followed by one for its non-inherited properties.
+static PropertyGroupLayout const& property_group_layout()
+{
+    static auto const layout = [] {
+        PropertyGroupLayout layout;
+        for (auto i = to_underlying(first_longhand_property_id); i <= to_underlying(last_longhand_property_id); ++i) {
+            auto property_id = static_cast<PropertyID>(i);
+            auto group = to_underlying(property_category(property_id)) * 2 + (is_inherited_property(property_id) ? 0 : 1);
+            layout.locations[i - to_underlying(first_longhand_property_id)] = { static_cast<u16>(group), layout.group_sizes[group]++ };
+        }
+        return layout;
+    }();
+    return layout;
+}
+
+static PropertyGroupLocation property_group_location(PropertyID property_id)
+{
+    return property_group_layout().locations[to_underlying(property_id) - to_underlying(first_longhand_property_id)];
+}
+
+NonnullRefPtr<ComputedProperties::PropertyGroup> ComputedProperties::create_property_group(size_t group_index)
+{
+    auto group = make_ref_counted<PropertyGroup>();
+    group->values.resize(property_group_layout().group_sizes[group_index]);
+    return group;
+}
+
+ComputedProperties::PropertyGroups const& ComputedProperties::initial_property_groups()
+{
+    static auto const groups = [] {
+        PropertyGroups groups;
+        for (auto i = to_underlying(first_longhand_property_id); i <= to_underlying(last_longhand_property_id); ++i) {
+            auto property_id = static_cast<PropertyID>(i);
+            auto location = property_group_location(property_id);
+            auto& group = groups[location.group];
+            if (!group)
+                group = create_property_group(location.group);
+            group->values[location.index] = property_initial_value(property_id);
+        }
+        return groups;
+    }();
+    return groups;
+}
+
+RefPtr<StyleValue const> const& ComputedProperties::stored_value(PropertyID property_id) const
+{
+    static RefPtr<StyleValue const> const no_value;
+    auto location = property_group_location(property_id);
+    auto const& group = m_property_groups[location.group];
+    if (!group)
+        return no_value;
+    return group->values[location.index];
+}
+
+RefPtr<StyleValue const>& ComputedProperties::mutable_stored_value(PropertyID property_id)
+{
+    auto location = property_group_location(property_id);
+    auto& group = m_property_groups[location.group];
+    if (!group) {
+        group = create_property_group(location.group);
+    } else if (group->ref_count() > 1) {
+        // Copy on write: someone else is looking at this group, so make our own copy before modifying it.
+        auto copy = make_ref_counted<PropertyGroup>();
+        copy->values = group->values;
+        group = move(copy);
+    }
+    return group->values[location.index];
+}
+
+void ComputedProperties::share_identical_property_groups(ComputedProperties const* parent_style)
+{
+    auto groups_are_equal = [](PropertyGroup const& group, PropertyGroup const& other_group) {
+        // Values are mostly inherited or initial values, which are the very same StyleValue objects, so checking the
+        // pointers alone usually settles it without comparing the values themselves.
+        if (group.values == other_group.values)
+            return true;
+
+        for (size_t i = 0; i < group.values.size(); ++i) {
+            auto const& value = group.values[i];
+            auto const& other_value = other_group.values[i];
+            if (value == other_value)
+                continue;
+            if (!value || !other_value || *value != *other_value)
+                return false;
+        }
+        return true;
+    };
+
+    auto const& initial_groups = initial_property_groups();
+    for (size_t i = 0; i < number_of_property_groups; ++i) {
+        auto& group = m_property_groups[i];
+        if (!group)
+            continue;
+        if (parent_style) {
+            auto const& parent_group = parent_style->m_property_groups[i];
+            if (parent_group == group)
+                continue;
+            if (parent_group && groups_are_equal(*group, *parent_group)) {
+                group = parent_group;
+                continue;
+            }
+        }
+        if (initial_groups[i] && initial_groups[i] != group && groups_are_equal(*group, *initial_groups[i]))
+            group = initial_groups[i];
+    }
+}
+
 void ComputedProperties::visit_edges(Visitor& visitor)
 {
     Base::visit_edges(visitor);
@@ -118,7 +345,7 @@ void ComputedProperties::set_property(PropertyID id, NonnullRefPtr<StyleValue co
 {
     VERIFY(id >= first_longhand_property_id && id <= last_longhand_property_id);
 
-    m_property_values[to_underlying(id) - to_underlying(first_longhand_property_id)] = move(value);
+    mutable_stored_value(id) = move(value);
     set_property_important(id, important);
     set_property_inherited(id, inherited);
 }
@@ -127,7 +354,7 @@ void ComputedProperties::revert_property(PropertyID id, ComputedProperties const
 {
     VERIFY(id >= first_longhand_property_id && id <= last_longhand_property_id);
 
-    m_property_values[to_underlying(id) - to_underlying(first_longhand_property_id)] = style_for_revert.m_property_values[to_underlying(id) - to_underlying(first_longhand_property_id)];
+    mutable_stored_value(id) = style_for_revert.stored_value(id);
     set_property_important(id, style_for_revert.is_property_important(id) ? Important::Yes : Important::No);
     set_property_inherited(id, style_for_revert.is_property_inherited(id) ? Inherited::Yes : Inherited::No);
 }
@@ -158,7 +385,7 @@ StyleValue const& ComputedProperties::property(PropertyID property_id, WithAnima
     }
 
     // By the time we call this method, all properties have values assigned.
-    return *m_property_values[to_underlying(property_id) - to_underlying(first_longhand_property_id)];
+    return *stored_value(property_id);
 }
 
 Variant<LengthPercentage, NormalGap> ComputedProperties::gap_value(PropertyID id) const
@@ -810,9 +1037,9 @@ Positioning ComputedProperties::position() const
 
 bool ComputedProperties::operator==(ComputedProperties const& other) const
 {
-    for (size_t i = 0; i < m_property_values.size(); ++i) {
-        auto const& my_style = m_property_values[i];
-        auto const& other_style = other.m_property_values[i];
+    for (auto i = to_underlying(first_longhand_property_id); i <= to_underlying(last_longhand_property_id); ++i) {
+        auto const& my_style = stored_value(static_cast<PropertyID>(i));
+        auto const& other_style = other.stored_value(static_cast<PropertyID>(i));
         if (!my_style) {
             if (other_style)
                 return false;
@@ -9,6 +9,7 @@
 
 #include <AK/HashMap.h>
 #include <AK/NonnullRefPtr.h>
+#include <AK/RefCounted.h>
 #include <LibGC/CellAllocator.h>
 #include <LibGC/Ptr.h>
 #include <LibGfx/Font/Font.h>
@@ -32,17 +33,31 @@ class WEB_API ComputedProperties final : public JS::Cell {
 public:
     static constexpr double normal_line_height_scale = 1.15;
 
+    // Longhands are grouped by what they style (fonts, text, box geometry, backgrounds, ...), since that's roughly what
+    // tends to be set together, and each category is split into its inherited and non-inherited properties.
+    static constexpr size_t number_of_property_categories = 10;
+    static constexpr size_t number_of_property_groups = number_of_property_categories * 2;
+
     virtual ~ComputedProperties() override;
 
+    // Returns a copy that can be mutated (e.g. by animations) without affecting this object.
+    // NOTE: Property groups are shared copy-on-write, so this is cheap.
+    [[nodiscard]] GC::Ref<ComputedProperties> clone() const;
+
     template<typename Callback>
     inline void for_each_property(Callback callback) const
     {
-        for (size_t i = 0; i < m_property_values.size(); ++i) {
-            if (m_property_values[i])
-                callback(static_cast<PropertyID>(i + to_underlying(first_longhand_property_id)), *m_property_values[i]);
+        for (auto i = to_underlying(first_longhand_property_id); i <= to_underlying(last_longhand_property_id); ++i) {
+            auto property_id = static_cast<PropertyID>(i);
+            if (auto const& value = stored_value(property_id))
+                callback(property_id, *value);
         }
     }
 
+    // Makes this object reference the parent's (or the initial values') property groups wherever ours hold equal values,
+    // so that the storage for identical groups is only kept once.
+    void share_identical_property_groups(ComputedProperties const* parent_style);
+
     enum class Inherited {
         No,
         Yes
@@ -259,6 +274,8 @@ public:
         return m_attempted_pseudo_class_matches.get(pseudo_class);
     }
 
+    PseudoClassBitmap const& attempted_pseudo_class_matches() const { return m_attempted_pseudo_class_matches; }
+
     void set_attempted_pseudo_class_matches(PseudoClassBitmap const& results)
     {
         m_attempted_pseudo_class_matches = results;
@@ -275,7 +292,22 @@ private:
     GC::Ptr<CSSStyleDeclaration const> m_animation_name_source;
     GC::Ptr<CSSStyleDeclaration const> m_transition_property_source;
 
-    Array<RefPtr<StyleValue const>, number_of_longhand_properties> m_property_values;
+    // Longhand values are stored in small refcounted groups that are shared copy-on-write between ComputedProperties
+    // objects. Inherited and non-inherited properties never share a group, so a child whose inherited values all came
+    // from its parent can point at the parent's groups, and groups holding only initial values can be shared by every
+    // element.
+    struct PropertyGroup : public RefCounted<PropertyGroup> {
+        Vector<RefPtr<StyleValue const>> values;
+    };
+    using PropertyGroups = Array<RefPtr<PropertyGroup>, number_of_property_groups>;
+
+    static PropertyGroups const& initial_property_groups();
+    static NonnullRefPtr<PropertyGroup> create_property_group(size_t group_index);
+
+    RefPtr<StyleValue const> const& stored_value(PropertyID) const;
+    RefPtr<StyleValue const>& mutable_stored_value(PropertyID);
+
+    PropertyGroups m_property_groups;
     Array<u8, ceil_div(number_of_longhand_properties, 8uz)> m_property_important {};
     Array<u8, ceil_div(number_of_longhand_properties, 8uz)> m_property_inherited {};
     Array<u8, ceil_div(number_of_longhand_properties, 8uz)> m_animated_property_inherited {};
@@ -7,6 +7,7 @@
 
 #include "Selector.h"
 #include <AK/GenericShorthands.h>
+#include <AK/InsertionSort.h>
 #include <LibWeb/CSS/Parser/ErrorReporter.h>
 #include <LibWeb/CSS/Serialize.h>
 
@@ -133,6 +134,60 @@ Selector::Selector(Vector<CompoundSelector>&& compound_selectors)
     collect_ancestor_hashes();
 
     m_can_use_fast_matches = can_selector_use_fast_matches(*this);
+    if (m_can_use_fast_matches)
+        compile_fast_match_program();
+}
+
+void Selector::compile_fast_match_program()
+{
+    using CheckType = FastMatchCheck::Type;
+
+    for (ssize_t compound_selector_index = static_cast<ssize_t>(m_compound_selectors.size()) - 1; compound_selector_index >= 0; --compound_selector_index) {
+        auto const& compound_selector = m_compound_selectors[compound_selector_index];
+        auto first_check = m_fast_match_program.checks.size();
+
+        for (auto const& simple_selector : compound_selector.simple_selectors) {
+            switch (simple_selector.type) {
+            case SimpleSelector::Type::Id:
+                m_fast_match_program.checks.append({ .type = CheckType::Id, .name = simple_selector.name() });
+                break;
+            case SimpleSelector::Type::Class:
+                m_fast_match_program.checks.append({ .type = CheckType::Class, .name = simple_selector.name() });
+                break;
+            case SimpleSelector::Type::TagName: {
+                auto const& qualified_name = simple_selector.qualified_name();
+                m_fast_match_program.checks.append({ .type = CheckType::TagName, .name = qualified_name.name.name, .lowercase_name = qualified_name.name.lowercase_name });
+                if (qualified_name.namespace_type != SimpleSelector::QualifiedName::NamespaceType::Any)
+                    m_fast_match_program.checks.append({ .type = CheckType::Namespace, .simple_selector = &simple_selector });
+                break;
+            }
+            case SimpleSelector::Type::Universal:
+                // `*|*` matches everything, so it doesn't need a check at all.
+                if (simple_selector.qualified_name().namespace_type != SimpleSelector::QualifiedName::NamespaceType::Any)
+                    m_fast_match_program.checks.append({ .type = CheckType::Namespace, .simple_selector = &simple_selector });
+                break;
+            case SimpleSelector::Type::Attribute:
+                m_fast_match_program.checks.append({ .type = CheckType::Attribute, .simple_selector = &simple_selector });
+                break;
+            case SimpleSelector::Type::PseudoClass:
+                m_fast_match_program.checks.append({ .type = CheckType::PseudoClass, .simple_selector = &simple_selector });
+                break;
+            default:
+                VERIFY_NOT_REACHED();
+            }
+        }
+
+        // All checks in a compound have to pass, so run the cheap and selective ones first.
+        // NOTE: The sort is stable, which keeps pseudo-classes in source order.
+        auto checks = m_fast_match_program.checks.span().slice(first_check);
+        insertion_sort(checks, [](auto const& a, auto const& b) { return a.type < b.type; });
+
+        m_fast_match_program.compounds.append({
+            .combinator = compound_selector.combinator,
+            .first_check = first_check,
+            .check_count = m_fast_match_program.checks.size() - first_check,
+        });
+    }
 }
 
 void Selector::collect_ancestor_hashes()
@@ -204,6 +204,36 @@ public:
         Optional<CompoundSelector> absolutized(SimpleSelector const& selector_for_nesting) const;
     };
 
+    // Selectors that can use SelectorEngine's fast path are lowered once into a flat program, which lists the
+    // compound selectors right-to-left and orders the checks within each compound from cheapest to most expensive.
+    struct FastMatchCheck {
+        enum class Type : u8 {
+            Id,
+            Class,
+            TagName,
+            Namespace,
+            Attribute,
+            PseudoClass,
+        };
+
+        Type type;
+        FlyString name {};
+        FlyString lowercase_name {};
+        SimpleSelector const* simple_selector { nullptr };
+    };
+
+    struct FastMatchCompound {
+        // The combinator between this compound and the next one in the program (i.e. the one to its left).
+        Combinator combinator { Combinator::None };
+        size_t first_check { 0 };
+        size_t check_count { 0 };
+    };
+
+    struct FastMatchProgram {
+        Vector<FastMatchCheck> checks;
+        Vector<FastMatchCompound> compounds;
+    };
+
     static NonnullRefPtr<Selector> create(Vector<CompoundSelector>&& compound_selectors)
     {
         return adopt_ref(*new Selector(move(compound_selectors)));
@@ -224,6 +254,7 @@ public:
     auto const& ancestor_hashes() const { return m_ancestor_hashes; }
 
     bool can_use_fast_matches() const { return m_can_use_fast_matches; }
+    FastMatchProgram const& fast_match_program() const { return m_fast_match_program; }
     bool can_use_ancestor_filter() const { return m_can_use_ancestor_filter; }
 
     size_t sibling_invalidation_distance() const;
@@ -244,8 +275,10 @@ private:
     PseudoClassBitmap m_contained_pseudo_classes;
 
     void collect_ancestor_hashes();
+    void compile_fast_match_program();
 
     Array<u32, 8> m_ancestor_hashes;
+    FastMatchProgram m_fast_match_program;
 };
 
 String serialize_a_group_of_selectors(SelectorList const& selectors);
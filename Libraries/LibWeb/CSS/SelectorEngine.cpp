@@ -181,6 +181,7 @@ static inline bool matches_relative_selector(CSS::Selector const& selector, size
     }
     case CSS::Selector::Combinator::NextSibling: {
         if (context.collect_per_element_selector_involvement_metadata) {
+            context.did_collect_selector_involvement_metadata = true;
             const_cast<DOM::Element&>(*anchor).set_affected_by_has_pseudo_class_with_relative_selector_that_has_sibling_combinator(true);
         }
         auto* sibling = element.next_element_sibling();
@@ -192,6 +193,7 @@ static inline bool matches_relative_selector(CSS::Selector const& selector, size
     }
     case CSS::Selector::Combinator::SubsequentSibling: {
         if (context.collect_per_element_selector_involvement_metadata) {
+            context.did_collect_selector_involvement_metadata = true;
             const_cast<DOM::Element&>(*anchor).set_affected_by_has_pseudo_class_with_relative_selector_that_has_sibling_combinator(true);
         }
         for (auto const* sibling = element.next_element_sibling(); sibling; sibling = sibling->next_element_sibling()) {
@@ -211,7 +213,33 @@ static inline bool matches_relative_selector(CSS::Selector const& selector, size
 // https://drafts.csswg.org/selectors-4/#relational
 static inline bool matches_has_pseudo_class(CSS::Selector const& selector, DOM::Element const& anchor, GC::Ptr<DOM::Element const> shadow_host, MatchContext& context)
 {
-    return matches_relative_selector(selector, 0, anchor, shadow_host, context, anchor);
+    if (!context.cache)
+        return matches_relative_selector(selector, 0, anchor, shadow_host, context, anchor);
+
+    // NOTE: The same :has() argument is typically evaluated against the same anchor for many elements and rules
+    //       (e.g. `.row:has(.selected) td`), so remember the result along with the pseudo-classes it looked at.
+    MatchCache::HasKey key {
+        .selector = selector,
+        .anchor = anchor.unique_id(),
+        .shadow_host = shadow_host ? Optional<UniqueNodeID> { shadow_host->unique_id() } : OptionalNone {},
+    };
+    if (auto cached_result = context.cache->has_result(anchor.document(), key); cached_result.has_value()) {
+        context.attempted_pseudo_class_matches |= cached_result->attempted_pseudo_class_matches;
+        return cached_result->matches;
+    }
+
+    auto outer_attempted_pseudo_class_matches = exchange(context.attempted_pseudo_class_matches, {});
+    auto outer_did_collect_selector_involvement_metadata = exchange(context.did_collect_selector_involvement_metadata, false);
+    auto result = matches_relative_selector(selector, 0, anchor, shadow_host, context, anchor);
+
+    // NOTE: Matching may have flagged elements for invalidation (sibling combinators, :nth-child() and the like). A cached
+    //       result would skip that the next time around, so only results that didn't flag anything are cached.
+    if (!context.did_collect_selector_involvement_metadata)
+        context.cache->set_has_result(key, { result, context.attempted_pseudo_class_matches });
+
+    context.attempted_pseudo_class_matches |= outer_attempted_pseudo_class_matches;
+    context.did_collect_selector_involvement_metadata |= outer_did_collect_selector_involvement_metadata;
+    return result;
 }
 
 static bool matches_hover_pseudo_class(DOM::Element const& element)
@@ -557,16 +585,19 @@ static inline bool matches_pseudo_class(CSS::Selector::SimpleSelector::PseudoCla
     }
     case CSS::PseudoClass::FirstChild:
         if (context.collect_per_element_selector_involvement_metadata) {
+            context.did_collect_selector_involvement_metadata = true;
             const_cast<DOM::Element&>(element).set_affected_by_sibling_position_or_count_pseudo_class(true);
         }
         return !element.previous_element_sibling();
     case CSS::PseudoClass::LastChild:
         if (context.collect_per_element_selector_involvement_metadata) {
+            context.did_collect_selector_involvement_metadata = true;
             const_cast<DOM::Element&>(element).set_affected_by_sibling_position_or_count_pseudo_class(true);
         }
         return !element.next_element_sibling();
     case CSS::PseudoClass::OnlyChild:
         if (context.collect_per_element_selector_involvement_metadata) {
+            context.did_collect_selector_involvement_metadata = true;
             const_cast<DOM::Element&>(element).set_affected_by_sibling_position_or_count_pseudo_class(true);
         }
         return !(element.previous_element_sibling() || element.next_element_sibling());
@@ -595,16 +626,19 @@ static inline bool matches_pseudo_class(CSS::Selector::SimpleSelector::PseudoCla
         return scope ? &element == scope : is<HTML::HTMLHtmlElement>(element);
     case CSS::PseudoClass::FirstOfType:
         if (context.collect_per_element_selector_involvement_metadata) {
+            context.did_collect_selector_involvement_metadata = true;
             const_cast<DOM::Element&>(element).set_affected_by_sibling_position_or_count_pseudo_class(true);
         }
         return !previous_sibling_with_same_tag_name(element);
     case CSS::PseudoClass::LastOfType:
         if (context.collect_per_element_selector_involvement_metadata) {
+            context.did_collect_selector_involvement_metadata = true;
             const_cast<DOM::Element&>(element).set_affected_by_sibling_position_or_count_pseudo_class(true);
         }
         return !next_sibling_with_same_tag_name(element);
     case CSS::PseudoClass::OnlyOfType:
         if (context.collect_per_element_selector_involvement_metadata) {
+            context.did_collect_selector_involvement_metadata = true;
             const_cast<DOM::Element&>(element).set_affected_by_sibling_position_or_count_pseudo_class(true);
         }
         return !previous_sibling_with_same_tag_name(element) && !next_sibling_with_same_tag_name(element);
@@ -641,6 +675,7 @@ static inline bool matches_pseudo_class(CSS::Selector::SimpleSelector::PseudoCla
         if (selector_kind == SelectorKind::Relative)
             return false;
         if (context.collect_per_element_selector_involvement_metadata) {
+            context.did_collect_selector_involvement_metadata = true;
             if (&element == context.subject) {
                 const_cast<DOM::Element&>(element).set_affected_by_has_pseudo_class_in_subject_position(true);
             } else {
@@ -675,6 +710,8 @@ static inline bool matches_pseudo_class(CSS::Selector::SimpleSelector::PseudoCla
             return false;
 
         if (context.collect_per_element_selector_involvement_metadata) {
+
+            context.did_collect_selector_involvement_metadata = true;
             const_cast<DOM::Element&>(element).set_affected_by_nth_child_pseudo_class(true);
         }
 
@@ -690,6 +727,29 @@ static inline bool matches_pseudo_class(CSS::Selector::SimpleSelector::PseudoCla
         };
 
         int index = 1;
+
+        // Without an "of S" selector list, the index only depends on the DOM structure and can come from the cache.
+        if (context.cache && pseudo_class.argument_selector_list.is_empty()) {
+            auto const& indices = context.cache->sibling_indices(element);
+            switch (pseudo_class.type) {
+            case CSS::PseudoClass::NthChild:
+                index = indices.child_index;
+                break;
+            case CSS::PseudoClass::NthLastChild:
+                index = indices.child_index_from_end;
+                break;
+            case CSS::PseudoClass::NthOfType:
+                index = indices.type_index;
+                break;
+            case CSS::PseudoClass::NthLastOfType:
+                index = indices.type_index_from_end;
+                break;
+            default:
+                VERIFY_NOT_REACHED();
+            }
+            return pseudo_class.an_plus_b_pattern.matches(index);
+        }
+
         switch (pseudo_class.type) {
         case CSS::PseudoClass::__Count:
             VERIFY_NOT_REACHED();
@@ -1192,6 +1252,7 @@ bool matches(CSS::Selector const& selector, int component_list_index, DOM::Eleme
     }
     case CSS::Selector::Combinator::NextSibling:
         if (context.collect_per_element_selector_involvement_metadata) {
+            context.did_collect_selector_involvement_metadata = true;
             const_cast<DOM::Element&>(element).set_affected_by_direct_sibling_combinator(true);
             auto new_sibling_invalidation_distance = max(selector.sibling_invalidation_distance(), element.sibling_invalidation_distance());
             const_cast<DOM::Element&>(element).set_sibling_invalidation_distance(new_sibling_invalidation_distance);
@@ -1202,6 +1263,7 @@ bool matches(CSS::Selector const& selector, int component_list_index, DOM::Eleme
         return false;
     case CSS::Selector::Combinator::SubsequentSibling:
         if (context.collect_per_element_selector_involvement_metadata) {
+            context.did_collect_selector_involvement_metadata = true;
             const_cast<DOM::Element&>(element).set_affected_by_indirect_sibling_combinator(true);
         }
         VERIFY(component_list_index != 0);
@@ -1231,48 +1293,51 @@ bool matches(CSS::Selector const& selector, DOM::Element const& element, GC::Ptr
     return matches(selector, selector.compound_selectors().size() - 1, element, shadow_host, context, scope, selector_kind, anchor);
 }
 
-static bool fast_matches_simple_selector(CSS::Selector::SimpleSelector const& simple_selector, DOM::Element const& element, GC::Ptr<DOM::Element const> shadow_host, MatchContext& context)
+struct FastMatchState {
+    GC::Ptr<DOM::Element const> shadow_host;
+    MatchContext& context;
+    bool is_html_document { false };
+    CaseSensitivity class_case_sensitivity { CaseSensitivity::CaseSensitive };
+};
+
+static ALWAYS_INLINE bool fast_matches_check(CSS::Selector::FastMatchCheck const& check, DOM::Element const& element, FastMatchState& state)
 {
-    if (should_block_shadow_host_matching(simple_selector, shadow_host, element))
-        return false;
+    using CheckType = CSS::Selector::FastMatchCheck::Type;
 
-    switch (simple_selector.type) {
-    case CSS::Selector::SimpleSelector::Type::Universal:
-        return matches_namespace(simple_selector.qualified_name(), element, context.style_sheet_for_rule);
-    case CSS::Selector::SimpleSelector::Type::TagName:
+    switch (check.type) {
+    case CheckType::Id:
+        return check.name == element.id();
+    case CheckType::Class:
+        // Class selectors are matched case insensitively in quirks mode.
+        // See: https://drafts.csswg.org/selectors-4/#class-html
+        return element.has_class(check.name, state.class_case_sensitivity);
+    case CheckType::TagName:
         // https://html.spec.whatwg.org/multipage/semantics-other.html#case-sensitivity-of-selectors
         // When comparing a CSS element type selector to the names of HTML elements in HTML documents, the CSS element type selector must first be converted to ASCII lowercase. The
         // same selector when compared to other elements must be compared according to its original case. In both cases, to match the values must be identical to each other (and therefore
         // the comparison is case sensitive).
-        if (element.namespace_uri() == Namespace::HTML && element.document().document_type() == DOM::Document::Type::HTML) {
-            if (simple_selector.qualified_name().name.lowercase_name != element.local_name())
-                return false;
-        } else if (simple_selector.qualified_name().name.name != element.local_name()) {
-            // NOTE: Any other elements are either SVG, XHTML or MathML, all of which are case-sensitive.
-            return false;
-        }
-        return matches_namespace(simple_selector.qualified_name(), element, context.style_sheet_for_rule);
-    case CSS::Selector::SimpleSelector::Type::Class: {
-        // Class selectors are matched case insensitively in quirks mode.
-        // See: https://drafts.csswg.org/selectors-4/#class-html
-        auto case_sensitivity = element.document().in_quirks_mode() ? CaseSensitivity::CaseInsensitive : CaseSensitivity::CaseSensitive;
-        return element.has_class(simple_selector.name(), case_sensitivity);
-    }
-    case CSS::Selector::SimpleSelector::Type::Id:
-        return simple_selector.name() == element.id();
-    case CSS::Selector::SimpleSelector::Type::Attribute:
-        return matches_attribute(simple_selector.attribute(), context.style_sheet_for_rule, element);
-    case CSS::Selector::SimpleSelector::Type::PseudoClass:
-        return matches_pseudo_class(simple_selector.pseudo_class(), element, shadow_host, context, nullptr, SelectorKind::Normal);
-    default:
-        VERIFY_NOT_REACHED();
+        if (state.is_html_document && element.namespace_uri() == Namespace::HTML)
+            return check.lowercase_name == element.local_name();
+        // NOTE: Any other elements are either SVG, XHTML or MathML, all of which are case-sensitive.
+        return check.name == element.local_name();
+    case CheckType::Namespace:
+        return matches_namespace(check.simple_selector->qualified_name(), element, state.context.style_sheet_for_rule);
+    case CheckType::Attribute:
+        return matches_attribute(check.simple_selector->attribute(), state.context.style_sheet_for_rule, element);
+    case CheckType::PseudoClass:
+        return matches_pseudo_class(check.simple_selector->pseudo_class(), element, state.shadow_host, state.context, nullptr, SelectorKind::Normal);
     }
+    VERIFY_NOT_REACHED();
 }
 
-static bool fast_matches_compound_selector(CSS::Selector::CompoundSelector const& compound_selector, DOM::Element const& element, GC::Ptr<DOM::Element const> shadow_host, MatchContext& context)
+static bool fast_matches_compound_selector(CSS::Selector::FastMatchProgram const& program, CSS::Selector::FastMatchCompound const& compound, DOM::Element const& element, FastMatchState& state)
 {
-    for (auto const& simple_selector : compound_selector.simple_selectors) {
-        if (!fast_matches_simple_selector(simple_selector, element, shadow_host, context))
+    // From within a shadow tree, only :host and friends can match the shadow host, and none of those take the fast path.
+    if (state.shadow_host && &element == state.shadow_host.ptr())
+        return false;
+
+    for (auto const& check : program.checks.span().slice(compound.first_check, compound.check_count)) {
+        if (!fast_matches_check(check, element, state))
             return false;
     }
     return true;
@@ -1280,48 +1345,58 @@ static bool fast_matches_compound_selector(CSS::Selector::CompoundSelector const
 
 bool fast_matches(CSS::Selector const& selector, DOM::Element const& element_to_match, GC::Ptr<DOM::Element const> shadow_host, MatchContext& context)
 {
+    auto const& program = selector.fast_match_program();
+    auto const& document = element_to_match.document();
+
+    FastMatchState state {
+        .shadow_host = shadow_host,
+        .context = context,
+        .is_html_document = document.document_type() == DOM::Document::Type::HTML,
+        .class_case_sensitivity = document.in_quirks_mode() ? CaseSensitivity::CaseInsensitive : CaseSensitivity::CaseSensitive,
+    };
+
     DOM::Element const* current = &element_to_match;
 
-    ssize_t compound_selector_index = selector.compound_selectors().size() - 1;
+    size_t compound_index = 0;
 
-    if (!fast_matches_compound_selector(selector.compound_selectors().last(), *current, shadow_host, context))
+    if (!fast_matches_compound_selector(program, program.compounds.first(), *current, state))
         return false;
 
     // NOTE: If we fail after following a child combinator, we may need to backtrack
     //       to the last matched descendant. We store the state here.
     struct {
         GC::Ptr<DOM::Element const> element;
-        ssize_t compound_selector_index = 0;
+        size_t compound_index = 0;
     } backtrack_state;
 
     for (;;) {
         // NOTE: There should always be a leftmost compound selector without combinator that kicks us out of this loop.
-        VERIFY(compound_selector_index >= 0);
+        VERIFY(compound_index < program.compounds.size());
 
-        auto const* compound_selector = &selector.compound_selectors()[compound_selector_index];
+        auto const* compound = &program.compounds[compound_index];
 
-        switch (compound_selector->combinator) {
+        switch (compound->combinator) {
         case CSS::Selector::Combinator::None:
             return true;
         case CSS::Selector::Combinator::Descendant:
-            backtrack_state = { current->parent_element(), compound_selector_index };
-            compound_selector = &selector.compound_selectors()[--compound_selector_index];
+            backtrack_state = { current->parent_element(), compound_index };
+            compound = &program.compounds[++compound_index];
             for (current = current->parent_element(); current; current = current->parent_element()) {
-                if (fast_matches_compound_selector(*compound_selector, *current, shadow_host, context))
+                if (fast_matches_compound_selector(program, *compound, *current, state))
                     break;
             }
             if (!current)
                 return false;
             break;
         case CSS::Selector::Combinator::ImmediateChild:
-            compound_selector = &selector.compound_selectors()[--compound_selector_index];
+            compound = &program.compounds[++compound_index];
             current = current->parent_element();
             if (!current)
                 return false;
-            if (!fast_matches_compound_selector(*compound_selector, *current, shadow_host, context)) {
+            if (!fast_matches_compound_selector(program, *compound, *current, state)) {
                 if (backtrack_state.element) {
                     current = backtrack_state.element;
-                    compound_selector_index = backtrack_state.compound_selector_index;
+                    compound_index = backtrack_state.compound_index;
                     continue;
                 }
                 return false;
@@ -1333,4 +1408,71 @@ bool fast_matches(CSS::Selector const& selector, DOM::Element const& element_to_
     }
 }
 
+bool pseudo_classes_match_equivalently(CSS::PseudoClassBitmap const& pseudo_classes, DOM::Element const& element, DOM::Element const& other_element)
+{
+    MatchContext context;
+    for (size_t i = 0; i < to_underlying(CSS::PseudoClass::__Count); ++i) {
+        auto pseudo_class = static_cast<CSS::PseudoClass>(i);
+        if (!pseudo_classes.get(pseudo_class))
+            continue;
+        if (CSS::pseudo_class_metadata(pseudo_class).parameter_type != CSS::PseudoClassMetadata::ParameterType::None)
+            return false;
+        CSS::Selector::SimpleSelector::PseudoClassSelector pseudo_class_selector { .type = pseudo_class };
+        if (matches_pseudo_class(pseudo_class_selector, element, nullptr, context, nullptr, SelectorKind::Normal) != matches_pseudo_class(pseudo_class_selector, other_element, nullptr, context, nullptr, SelectorKind::Normal))
+            return false;
+    }
+    return true;
+}
+
+void MatchCache::invalidate_if_dom_tree_changed(DOM::Document const& document)
+{
+    if (m_dom_tree_version == document.dom_tree_version())
+        return;
+    m_dom_tree_version = document.dom_tree_version();
+    m_sibling_indices.clear();
+    m_has_results.clear();
+}
+
+MatchCache::SiblingIndices const& MatchCache::sibling_indices(DOM::Element const& element)
+{
+    invalidate_if_dom_tree_changed(element.document());
+
+    if (auto it = m_sibling_indices.find(element.unique_id()); it != m_sibling_indices.end())
+        return it->value;
+
+    auto const* parent = element.parent();
+    VERIFY(parent);
+
+    // Index all element children of the parent in one pass, so that the remaining siblings are O(1) lookups.
+    HashMap<FlyString, size_t> type_counts;
+    size_t child_count = 0;
+    for (auto const* child = parent->first_child_of_type<DOM::Element>(); child; child = child->next_element_sibling()) {
+        auto& type_count = type_counts.ensure(child->tag_name(), [] { return 0; });
+        m_sibling_indices.set(child->unique_id(), { .child_index = ++child_count, .type_index = ++type_count });
+    }
+    for (auto const* child = parent->first_child_of_type<DOM::Element>(); child; child = child->next_element_sibling()) {
+        auto& indices = m_sibling_indices.find(child->unique_id())->value;
+        indices.child_index_from_end = child_count - indices.child_index + 1;
+        indices.type_index_from_end = type_counts.get(child->tag_name()).value() - indices.type_index + 1;
+    }
+
+    return m_sibling_indices.find(element.unique_id())->value;
+}
+
+Optional<MatchCache::HasResult> MatchCache::has_result(DOM::Document const& document, HasKey const& key)
+{
+    invalidate_if_dom_tree_changed(document);
+    return m_has_results.get(key);
+}
+
+void MatchCache::set_has_result(HasKey const& key, HasResult result)
+{
+    m_has_results.set(key, result);
+}
+
+void MatchCache::begin_style_update()
+{
+    m_has_results.clear();
+}
+
 }
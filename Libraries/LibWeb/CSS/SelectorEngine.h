@@ -6,6 +6,8 @@
 
 #pragma once
 
+#include <AK/HashMap.h>
+#include <LibWeb/CSS/PseudoClassBitmap.h>
 #include <LibWeb/CSS/Selector.h>
 #include <LibWeb/DOM/Element.h>
 
@@ -16,14 +18,76 @@ enum class SelectorKind {
     Relative,
 };
 
+// Memoizes structural lookups that are expensive to repeat for every element/rule pair during style computation.
+// Sibling indices stay valid until the DOM tree changes, while :has() results also depend on element state (hover,
+// focus, etc.) and must be discarded at the start of every style update.
+class MatchCache {
+public:
+    struct SiblingIndices {
+        size_t child_index { 0 };
+        size_t child_index_from_end { 0 };
+        size_t type_index { 0 };
+        size_t type_index_from_end { 0 };
+    };
+
+    struct HasResult {
+        bool matches { false };
+        CSS::PseudoClassBitmap attempted_pseudo_class_matches;
+    };
+
+    // NOTE: Elements are identified by their unique ID rather than their address, which may be reused by a new element
+    //       once the old one has been garbage collected.
+    struct HasKey {
+        NonnullRefPtr<CSS::Selector const> selector;
+        UniqueNodeID anchor;
+        Optional<UniqueNodeID> shadow_host;
+
+        bool operator==(HasKey const&) const = default;
+    };
+
+    // Returns the 1-based indices of an element among its element siblings, computing them for all of its siblings at once.
+    SiblingIndices const& sibling_indices(DOM::Element const&);
+
+    Optional<HasResult> has_result(DOM::Document const&, HasKey const&);
+    void set_has_result(HasKey const&, HasResult);
+
+    void begin_style_update();
+
+private:
+    void invalidate_if_dom_tree_changed(DOM::Document const&);
+
+    u64 m_dom_tree_version { 0 };
+    HashMap<UniqueNodeID, SiblingIndices> m_sibling_indices;
+    HashMap<HasKey, HasResult> m_has_results;
+};
+
 struct MatchContext {
     GC::Ptr<CSS::CSSStyleSheet const> style_sheet_for_rule {};
     GC::Ptr<DOM::Element const> subject {};
     GC::Ptr<DOM::Element const> slotted_element {}; // Only set when matching a ::slotted() pseudo-element
     bool collect_per_element_selector_involvement_metadata { false };
     CSS::PseudoClassBitmap attempted_pseudo_class_matches {};
+    bool did_collect_selector_involvement_metadata { false };
+    MatchCache* cache { nullptr };
 };
 
 bool matches(CSS::Selector const&, DOM::Element const&, GC::Ptr<DOM::Element const> shadow_host, MatchContext& context, Optional<CSS::PseudoElement> = {}, GC::Ptr<DOM::ParentNode const> scope = {}, SelectorKind selector_kind = SelectorKind::Normal, GC::Ptr<DOM::Element const> anchor = nullptr);
 
+// Returns true if every pseudo-class in the bitmap matches both elements in the same way. Pseudo-classes that take
+// arguments can't be evaluated outside of their selector, so their presence makes this conservatively return false.
+bool pseudo_classes_match_equivalently(CSS::PseudoClassBitmap const&, DOM::Element const&, DOM::Element const&);
+
+}
+
+namespace AK {
+
+template<>
+struct Traits<Web::SelectorEngine::MatchCache::HasKey> : public DefaultTraits<Web::SelectorEngine::MatchCache::HasKey> {
+    static unsigned hash(Web::SelectorEngine::MatchCache::HasKey const& key)
+    {
+        auto shadow_host_hash = key.shadow_host.has_value() ? u64_hash(key.shadow_host->value()) : 0;
+        return pair_int_hash(pair_int_hash(ptr_hash(key.selector.ptr()), u64_hash(key.anchor.value())), shadow_host_hash);
+    }
+};
+
 }
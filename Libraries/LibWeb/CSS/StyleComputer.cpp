@@ -77,6 +77,7 @@
 #include <LibWeb/DOM/Attr.h>
 #include <LibWeb/DOM/Document.h>
 #include <LibWeb/DOM/Element.h>
+#include <LibWeb/DOM/NamedNodeMap.h>
 #include <LibWeb/DOM/ShadowRoot.h>
 #include <LibWeb/Fetch/Infrastructure/FetchController.h>
 #include <LibWeb/Fetch/Response.h>
@@ -188,6 +189,7 @@ StyleComputer::StyleComputer(DOM::Document& document)
     , m_root_element_font_metrics(m_default_font_metrics)
 {
     m_ancestor_filter = make<CountingBloomFilter<u8, 14>>();
+    m_selector_match_cache = make<SelectorEngine::MatchCache>();
     m_qualified_layer_names_in_order.append({});
 }
 
@@ -199,6 +201,7 @@ void StyleComputer::visit_edges(Visitor& visitor)
     visitor.visit(m_document);
     visitor.visit(m_loaded_fonts);
     visitor.visit(m_user_style_sheet);
+    visitor.visit(m_style_sharing_candidates);
 }
 
 FontLoader::FontLoader(StyleComputer& style_computer, GC::Ptr<CSSStyleSheet> parent_style_sheet, FlyString family_name, Vector<Gfx::UnicodeRange> unicode_ranges, Vector<URL> urls, Function<void(RefPtr<Gfx::Typeface const>)> on_load)
@@ -610,6 +613,7 @@ Vector<MatchingRule const*> StyleComputer::collect_matching_rules(DOM::AbstractE
             .style_sheet_for_rule = *rule_to_run.sheet,
             .subject = abstract_element.element(),
             .collect_per_element_selector_involvement_metadata = true,
+            .cache = m_selector_match_cache.ptr(),
         };
         ScopeGuard guard = [&] {
             attempted_pseudo_class_matches |= context.attempted_pseudo_class_matches;
@@ -2383,6 +2387,12 @@ GC::Ptr<ComputedProperties> StyleComputer::compute_style_impl(DOM::AbstractEleme
 
     ScopeGuard guard { [&abstract_element]() { abstract_element.element().set_needs_style_update(false); } };
 
+    bool const can_share_style = m_style_sharing_enabled && mode == ComputeStyleMode::Normal && !abstract_element.pseudo_element().has_value();
+    if (can_share_style) {
+        if (auto shared_style = share_style_with_sibling_if_possible(abstract_element.element(), did_change_custom_properties))
+            return shared_style;
+    }
+
     // 1. Perform the cascade. This produces the "specified style"
     bool did_match_any_pseudo_element_rules = false;
     PseudoClassBitmap attempted_pseudo_class_matches;
@@ -2440,9 +2450,110 @@ GC::Ptr<ComputedProperties> StyleComputer::compute_style_impl(DOM::AbstractEleme
         *did_change_custom_properties = true;
     }
 
+    if (can_share_style) {
+        if (m_style_sharing_candidates.size() == max_style_sharing_candidates)
+            m_style_sharing_candidates.take_first();
+        m_style_sharing_candidates.append(abstract_element.element());
+    }
+
     return computed_properties;
 }
 
+static bool can_element_share_style(DOM::Element const& element)
+{
+    if (!element.is_html_element() || !element.parent_element())
+        return false;
+
+    // NOTE: These elements don't customize their computed style in adjust_computed_style(), and are common enough in
+    //       long runs of siblings (lists, tables, paragraphs) to be worth sharing.
+    if (!element.local_name().is_one_of(
+            HTML::TagNames::a, HTML::TagNames::b, HTML::TagNames::dd, HTML::TagNames::div, HTML::TagNames::dt,
+            HTML::TagNames::em, HTML::TagNames::i, HTML::TagNames::li, HTML::TagNames::ol, HTML::TagNames::p,
+            HTML::TagNames::span, HTML::TagNames::strong, HTML::TagNames::td, HTML::TagNames::th, HTML::TagNames::tr,
+            HTML::TagNames::ul))
+        return false;
+
+    // NOTE: The directionality of dir=auto depends on the element's text content.
+    if (element.id().has_value() || element.inline_style() || element.has_attribute(HTML::AttributeNames::dir))
+        return false;
+
+    if (element.is_shadow_host() || element.assigned_slot_internal() || element.use_pseudo_element().has_value())
+        return false;
+
+    return true;
+}
+
+static bool have_identical_attributes(DOM::Element const& element, DOM::Element const& other_element)
+{
+    if (element.attribute_list_size() != other_element.attribute_list_size())
+        return false;
+    if (element.attribute_list_size() == 0)
+        return true;
+
+    auto const& attributes = *element.attributes();
+    auto const& other_attributes = *other_element.attributes();
+    for (u32 i = 0; i < attributes.length(); ++i) {
+        auto const& attribute = *attributes.item(i);
+        auto const& other_attribute = *other_attributes.item(i);
+        if (attribute.name() != other_attribute.name() || attribute.namespace_uri() != other_attribute.namespace_uri() || attribute.value() != other_attribute.value())
+            return false;
+    }
+    return true;
+}
+
+// Style sharing: if a previously styled sibling has the same tag, attributes and relevant element state, and none of
+// the rules that were considered for it depended on its position among its siblings, then the cascade would produce
+// the exact same result for this element, so we can copy its computed style instead.
+GC::Ptr<ComputedProperties> StyleComputer::share_style_with_sibling_if_possible(DOM::Element& element, Optional<bool&> did_change_custom_properties) const
+{
+    if (m_style_sharing_candidates.is_empty() || !can_element_share_style(element))
+        return {};
+
+    // Animations and transitions are tracked per element, so we can't hand this element another element's style.
+    if (element.has_associated_animations() || element.cached_animation_name_source({}))
+        return {};
+    if (auto previous_style = element.computed_properties(); previous_style && (previous_style->animation_name_source() || previous_style->transition_property_source()))
+        return {};
+
+    for (auto const& candidate : m_style_sharing_candidates.in_reverse()) {
+        if (candidate.ptr() == &element || candidate->parent() != element.parent())
+            continue;
+        auto candidate_style = candidate->computed_properties();
+        if (!candidate_style || candidate->needs_style_update())
+            continue;
+        if (candidate->local_name() != element.local_name() || !can_element_share_style(*candidate))
+            continue;
+        if (candidate->style_affected_by_structural_changes()
+            || candidate->affected_by_has_pseudo_class_in_subject_position()
+            || candidate->affected_by_has_pseudo_class_in_non_subject_position()
+            || candidate->affected_by_has_pseudo_class_with_relative_selector_that_has_sibling_combinator())
+            continue;
+        if (candidate_style->animation_name_source() || candidate_style->transition_property_source() || candidate->has_associated_animations())
+            continue;
+        if (!have_identical_attributes(element, *candidate))
+            continue;
+        if (!SelectorEngine::pseudo_classes_match_equivalently(candidate_style->attempted_pseudo_class_matches(), element, *candidate))
+            continue;
+
+        auto old_custom_properties = element.custom_properties({});
+        element.set_custom_properties({}, candidate->custom_properties({}));
+        element.set_cascaded_properties({}, candidate->cascaded_properties({}));
+        if (candidate->style_uses_attr_css_function())
+            element.set_style_uses_attr_css_function();
+        if (candidate->style_uses_var_css_function())
+            element.set_style_uses_var_css_function();
+
+        if (did_change_custom_properties.has_value() && element.custom_properties({}) != old_custom_properties)
+            *did_change_custom_properties = true;
+
+        // NOTE: We hand out a copy rather than the candidate's own object, since animations and transitions started
+        //       later on mutate computed properties in place.
+        return candidate_style->clone();
+    }
+
+    return {};
+}
+
 static bool is_monospace(StyleValue const& value)
 {
     if (value.to_keyword() == Keyword::Monospace)
@@ -2683,6 +2794,12 @@ GC::Ref<ComputedProperties> StyleComputer::compute_properties(DOM::AbstractEleme
         start_needed_transitions(*previous_style, computed_style, abstract_element);
     }
 
+    // 9. Share storage with our parent's style (or the initial values) for property groups that ended up identical.
+    if (auto parent_element = abstract_element.element_to_inherit_style_from(); parent_element.has_value())
+        computed_style->share_identical_property_groups(parent_element->computed_properties());
+    else
+        computed_style->share_identical_property_groups(nullptr);
+
     return computed_style;
 }
 
@@ -3528,6 +3645,19 @@ void StyleComputer::reset_ancestor_filter()
     m_ancestor_filter->clear();
 }
 
+void StyleComputer::begin_style_update()
+{
+    m_selector_match_cache->begin_style_update();
+    m_style_sharing_candidates.clear();
+    m_style_sharing_enabled = true;
+}
+
+void StyleComputer::end_style_update()
+{
+    m_style_sharing_candidates.clear();
+    m_style_sharing_enabled = false;
+}
+
 void StyleComputer::push_ancestor(DOM::Element const& element)
 {
     for_each_element_hash(element, [&](u32 hash) {
@@ -75,6 +75,17 @@ static Vector<Bindings::KeyUsage> usage_intersection(ReadonlySpan<Bindings::KeyU
     return result;
 }
 
+// Wraps steps that produce the bytes of an ArrayBuffer in a ParallelOperation, turning their failure into an
+// OperationError with the given message.
+static OwnPtr<ParallelOperation<GC::Ref<JS::ArrayBuffer>>> create_array_buffer_operation(JS::Realm& realm, Function<ErrorOr<ByteBuffer>()> parallel_steps, Utf16String error_message)
+{
+    return create_parallel_operation<GC::Ref<JS::ArrayBuffer>, ByteBuffer>(realm, move(parallel_steps), [realm = GC::Ref { realm }, error_message = move(error_message)](ErrorOr<ByteBuffer> result) -> WebIDL::ExceptionOr<GC::Ref<JS::ArrayBuffer>> {
+        if (result.is_error())
+            return WebIDL::OperationError::create(realm, error_message);
+        return JS::ArrayBuffer::create(realm, result.release_value());
+    });
+}
+
 // Out of line to ensure this class has a key function
 AlgorithmMethods::~AlgorithmMethods() = default;
 
@@ -697,7 +708,7 @@ WebIDL::ExceptionOr<GC::Ref<JS::ArrayBuffer>> RSAOAEP::decrypt(AlgorithmParams c
 }
 
 // https://w3c.github.io/webcrypto/#rsa-oaep-operations
-WebIDL::ExceptionOr<Variant<GC::Ref<CryptoKey>, GC::Ref<CryptoKeyPair>>> RSAOAEP::generate_key(AlgorithmParams const& params, bool extractable, Vector<Bindings::KeyUsage> const& key_usages)
+WebIDL::ExceptionOr<OwnPtr<ParallelOperation<Variant<GC::Ref<CryptoKey>, GC::Ref<CryptoKeyPair>>>>> RSAOAEP::generate_key_in_parallel(AlgorithmParams const& params, bool extractable, Vector<Bindings::KeyUsage> const& key_usages)
 {
     // 1. If usages contains an entry which is not "encrypt", "decrypt", "wrapKey" or "unwrapKey", then throw a SyntaxError.
     for (auto const& usage : key_usages) {
@@ -706,16 +717,9 @@ WebIDL::ExceptionOr<Variant<GC::Ref<CryptoKey>, GC::Ref<CryptoKeyPair>>> RSAOAEP
         }
     }
 
-    // 2. Generate an RSA key pair, as defined in [RFC3447], with RSA modulus length equal to the modulusLength member of normalizedAlgorithm
-    //    and RSA public exponent equal to the publicExponent member of normalizedAlgorithm.
-    // 3. If performing the operation results in an error, then throw an OperationError.
     auto const& normalized_algorithm = static_cast<RsaHashedKeyGenParams const&>(params);
-    auto maybe_key_pair = ::Crypto::PK::RSA::generate_key_pair(normalized_algorithm.modulus_length, normalized_algorithm.public_exponent);
-    if (maybe_key_pair.is_error())
-        return WebIDL::OperationError::create(m_realm, "Failed generating RSA key pair"_utf16);
-
-    auto key_pair = maybe_key_pair.release_value();
 
+    // NOTE: Steps 4 to 8 don't depend on the generated key pair, so they are performed before generating it.
     // 4. Let algorithm be a new RsaHashedKeyAlgorithm object.
     auto algorithm = RsaHashedKeyAlgorithm::create(m_realm);
 
@@ -731,41 +735,54 @@ WebIDL::ExceptionOr<Variant<GC::Ref<CryptoKey>, GC::Ref<CryptoKeyPair>>> RSAOAEP
     // 8. Set the hash attribute of algorithm to equal the hash member of normalizedAlgorithm.
     algorithm->set_hash(normalized_algorithm.hash);
 
-    // 9. Let publicKey be a new CryptoKey representing the public key of the generated key pair.
-    auto public_key = CryptoKey::create(m_realm, CryptoKey::InternalKeyData { key_pair.public_key });
+    // 2. Generate an RSA key pair, as defined in [RFC3447], with RSA modulus length equal to the modulusLength member of normalizedAlgorithm
+    //    and RSA public exponent equal to the publicExponent member of normalizedAlgorithm.
+    // 3. If performing the operation results in an error, then throw an OperationError.
+    return create_parallel_operation<Variant<GC::Ref<CryptoKey>, GC::Ref<CryptoKeyPair>>, ::Crypto::PK::RSA::KeyPairType>(m_realm, [modulus_length = normalized_algorithm.modulus_length, public_exponent = normalized_algorithm.public_exponent] {
+        return ::Crypto::PK::RSA::generate_key_pair(modulus_length, public_exponent);
+    },
+        [realm = m_realm, algorithm, extractable, key_usages](ErrorOr<::Crypto::PK::RSA::KeyPairType> maybe_key_pair) -> WebIDL::ExceptionOr<Variant<GC::Ref<CryptoKey>, GC::Ref<CryptoKeyPair>>> {
+            if (maybe_key_pair.is_error())
+                return WebIDL::OperationError::create(realm, "Failed generating RSA key pair"_utf16);
 
-    // 10. Set the [[type]] internal slot of publicKey to "public"
-    public_key->set_type(Bindings::KeyType::Public);
+            auto key_pair = maybe_key_pair.release_value();
 
-    // 11. Set the [[algorithm]] internal slot of publicKey to algorithm.
-    public_key->set_algorithm(algorithm);
+            // 9. Let publicKey be a new CryptoKey representing the public key of the generated key pair.
+            auto public_key = CryptoKey::create(realm, CryptoKey::InternalKeyData { key_pair.public_key });
 
-    // 12. Set the [[extractable]] internal slot of publicKey to true.
-    public_key->set_extractable(true);
+            // 10. Set the [[type]] internal slot of publicKey to "public"
+            public_key->set_type(Bindings::KeyType::Public);
 
-    // 13. Set the [[usages]] internal slot of publicKey to be the usage intersection of usages and [ "encrypt", "wrapKey" ].
-    public_key->set_usages(usage_intersection(key_usages, { { Bindings::KeyUsage::Encrypt, Bindings::KeyUsage::Wrapkey } }));
+            // 11. Set the [[algorithm]] internal slot of publicKey to algorithm.
+            public_key->set_algorithm(algorithm);
 
-    // 14. Let privateKey be a new CryptoKey representing the private key of the generated key pair.
-    auto private_key = CryptoKey::create(m_realm, CryptoKey::InternalKeyData { key_pair.private_key });
+            // 12. Set the [[extractable]] internal slot of publicKey to true.
+            public_key->set_extractable(true);
 
-    // 15. Set the [[type]] internal slot of privateKey to "private"
-    private_key->set_type(Bindings::KeyType::Private);
+            // 13. Set the [[usages]] internal slot of publicKey to be the usage intersection of usages and [ "encrypt", "wrapKey" ].
+            public_key->set_usages(usage_intersection(key_usages, { { Bindings::KeyUsage::Encrypt, Bindings::KeyUsage::Wrapkey } }));
 
-    // 16. Set the [[algorithm]] internal slot of privateKey to algorithm.
-    private_key->set_algorithm(algorithm);
+            // 14. Let privateKey be a new CryptoKey representing the private key of the generated key pair.
+            auto private_key = CryptoKey::create(realm, CryptoKey::InternalKeyData { key_pair.private_key });
 
-    // 17. Set the [[extractable]] internal slot of privateKey to extractable.
-    private_key->set_extractable(extractable);
+            // 15. Set the [[type]] internal slot of privateKey to "private"
+            private_key->set_type(Bindings::KeyType::Private);
 
-    // 18. Set the [[usages]] internal slot of privateKey to be the usage intersection of usages and [ "decrypt", "unwrapKey" ].
-    private_key->set_usages(usage_intersection(key_usages, { { Bindings::KeyUsage::Decrypt, Bindings::KeyUsage::Unwrapkey } }));
+            // 16. Set the [[algorithm]] internal slot of privateKey to algorithm.
+            private_key->set_algorithm(algorithm);
 
-    // 19. Let result be a new CryptoKeyPair dictionary.
-    // 20. Set the publicKey attribute of result to be publicKey.
-    // 21. Set the privateKey attribute of result to be privateKey.
-    // 22. Return the result of converting result to an ECMAScript Object, as defined by [WebIDL].
-    return Variant<GC::Ref<CryptoKey>, GC::Ref<CryptoKeyPair>> { CryptoKeyPair::create(m_realm, public_key, private_key) };
+            // 17. Set the [[extractable]] internal slot of privateKey to extractable.
+            private_key->set_extractable(extractable);
+
+            // 18. Set the [[usages]] internal slot of privateKey to be the usage intersection of usages and [ "decrypt", "unwrapKey" ].
+            private_key->set_usages(usage_intersection(key_usages, { { Bindings::KeyUsage::Decrypt, Bindings::KeyUsage::Unwrapkey } }));
+
+            // 19. Let result be a new CryptoKeyPair dictionary.
+            // 20. Set the publicKey attribute of result to be publicKey.
+            // 21. Set the privateKey attribute of result to be privateKey.
+            // 22. Return the result of converting result to an ECMAScript Object, as defined by [WebIDL].
+            return Variant<GC::Ref<CryptoKey>, GC::Ref<CryptoKeyPair>> { CryptoKeyPair::create(realm, public_key, private_key) };
+        });
 }
 
 // https://w3c.github.io/webcrypto/#rsa-oaep-operations
@@ -1194,7 +1211,7 @@ WebIDL::ExceptionOr<GC::Ref<JS::Object>> RSAOAEP::export_key(Bindings::KeyFormat
 }
 
 // https://w3c.github.io/webcrypto/#rsa-pss-operations
-WebIDL::ExceptionOr<Variant<GC::Ref<CryptoKey>, GC::Ref<CryptoKeyPair>>> RSAPSS::generate_key(AlgorithmParams const& params, bool extractable, Vector<Bindings::KeyUsage> const& key_usages)
+WebIDL::ExceptionOr<OwnPtr<ParallelOperation<Variant<GC::Ref<CryptoKey>, GC::Ref<CryptoKeyPair>>>>> RSAPSS::generate_key_in_parallel(AlgorithmParams const& params, bool extractable, Vector<Bindings::KeyUsage> const& key_usages)
 {
     // 1. If usages contains a value which is not one of "sign" or "verify", then throw a SyntaxError.
     for (auto const& usage : key_usages) {
@@ -1203,16 +1220,9 @@ WebIDL::ExceptionOr<Variant<GC::Ref<CryptoKey>, GC::Ref<CryptoKeyPair>>> RSAPSS:
         }
     }
 
-    // 2. Generate an RSA key pair, as defined in [RFC3447], with RSA modulus length equal to the modulusLength member of normalizedAlgorithm
-    //    and RSA public exponent equal to the publicExponent member of normalizedAlgorithm.
-    // 3. If performing the operation results in an error, then throw an OperationError.
     auto const& normalized_algorithm = static_cast<RsaHashedKeyGenParams const&>(params);
-    auto maybe_key_pair = ::Crypto::PK::RSA::generate_key_pair(normalized_algorithm.modulus_length, normalized_algorithm.public_exponent);
-    if (maybe_key_pair.is_error())
-        return WebIDL::OperationError::create(m_realm, "Failed to generate RSA key pair"_utf16);
-
-    auto key_pair = maybe_key_pair.release_value();
 
+    // NOTE: Steps 4 to 8 don't depend on the generated key pair, so they are performed before generating it.
     // 4. Let algorithm be a new RsaHashedKeyAlgorithm object.
     auto algorithm = RsaHashedKeyAlgorithm::create(m_realm);
 
@@ -1228,41 +1238,54 @@ WebIDL::ExceptionOr<Variant<GC::Ref<CryptoKey>, GC::Ref<CryptoKeyPair>>> RSAPSS:
     // 8. Set the hash attribute of algorithm to equal the hash member of normalizedAlgorithm.
     algorithm->set_hash(normalized_algorithm.hash);
 
-    // 9. Let publicKey be a new CryptoKey representing the public key of the generated key pair.
-    auto public_key = CryptoKey::create(m_realm, CryptoKey::InternalKeyData { key_pair.public_key });
+    // 2. Generate an RSA key pair, as defined in [RFC3447], with RSA modulus length equal to the modulusLength member of normalizedAlgorithm
+    //    and RSA public exponent equal to the publicExponent member of normalizedAlgorithm.
+    // 3. If performing the operation results in an error, then throw an OperationError.
+    return create_parallel_operation<Variant<GC::Ref<CryptoKey>, GC::Ref<CryptoKeyPair>>, ::Crypto::PK::RSA::KeyPairType>(m_realm, [modulus_length = normalized_algorithm.modulus_length, public_exponent = normalized_algorithm.public_exponent] {
+        return ::Crypto::PK::RSA::generate_key_pair(modulus_length, public_exponent);
+    },
+        [realm = m_realm, algorithm, extractable, key_usages](ErrorOr<::Crypto::PK::RSA::KeyPairType> maybe_key_pair) -> WebIDL::ExceptionOr<Variant<GC::Ref<CryptoKey>, GC::Ref<CryptoKeyPair>>> {
+            if (maybe_key_pair.is_error())
+                return WebIDL::OperationError::create(realm, "Failed to generate RSA key pair"_utf16);
 
-    // 10. Set the [[type]] internal slot of publicKey to "public"
-    public_key->set_type(Bindings::KeyType::Public);
+            auto key_pair = maybe_key_pair.release_value();
 
-    // 11. Set the [[algorithm]] internal slot of publicKey to algorithm.
-    public_key->set_algorithm(algorithm);
+            // 9. Let publicKey be a new CryptoKey representing the public key of the generated key pair.
+            auto public_key = CryptoKey::create(realm, CryptoKey::InternalKeyData { key_pair.public_key });
 
-    // 12. Set the [[extractable]] internal slot of publicKey to true.
-    public_key->set_extractable(true);
+            // 10. Set the [[type]] internal slot of publicKey to "public"
+            public_key->set_type(Bindings::KeyType::Public);
 
-    // 13. Set the [[usages]] internal slot of publicKey to be the usage intersection of usages and [ "verify" ].
-    public_key->set_usages(usage_intersection(key_usages, { { Bindings::KeyUsage::Verify } }));
+            // 11. Set the [[algorithm]] internal slot of publicKey to algorithm.
+            public_key->set_algorithm(algorithm);
 
-    // 14. Let privateKey be a new CryptoKey representing the private key of the generated key pair.
-    auto private_key = CryptoKey::create(m_realm, CryptoKey::InternalKeyData { key_pair.private_key });
+            // 12. Set the [[extractable]] internal slot of publicKey to true.
+            public_key->set_extractable(true);
 
-    // 15. Set the [[type]] internal slot of privateKey to "private"
-    private_key->set_type(Bindings::KeyType::Private);
+            // 13. Set the [[usages]] internal slot of publicKey to be the usage intersection of usages and [ "verify" ].
+            public_key->set_usages(usage_intersection(key_usages, { { Bindings::KeyUsage::Verify } }));
 
-    // 16. Set the [[algorithm]] internal slot of privateKey to algorithm.
-    private_key->set_algorithm(algorithm);
+            // 14. Let privateKey be a new CryptoKey representing the private key of the generated key pair.
+            auto private_key = CryptoKey::create(realm, CryptoKey::InternalKeyData { key_pair.private_key });
 
-    // 17. Set the [[extractable]] internal slot of privateKey to extractable.
-    private_key->set_extractable(extractable);
+            // 15. Set the [[type]] internal slot of privateKey to "private"
+            private_key->set_type(Bindings::KeyType::Private);
 
-    // 18. Set the [[usages]] internal slot of privateKey to be the usage intersection of usages and [ "sign" ].
-    private_key->set_usages(usage_intersection(key_usages, { { Bindings::KeyUsage::Sign } }));
+            // 16. Set the [[algorithm]] internal slot of privateKey to algorithm.
+            private_key->set_algorithm(algorithm);
 
-    // 19. Let result be a new CryptoKeyPair dictionary.
-    // 20. Set the publicKey attribute of result to be publicKey.
-    // 21. Set the privateKey attribute of result to be privateKey.
-    // 22. Return result.
-    return Variant<GC::Ref<CryptoKey>, GC::Ref<CryptoKeyPair>> { CryptoKeyPair::create(m_realm, public_key, private_key) };
+            // 17. Set the [[extractable]] internal slot of privateKey to extractable.
+            private_key->set_extractable(extractable);
+
+            // 18. Set the [[usages]] internal slot of privateKey to be the usage intersection of usages and [ "sign" ].
+            private_key->set_usages(usage_intersection(key_usages, { { Bindings::KeyUsage::Sign } }));
+
+            // 19. Let result be a new CryptoKeyPair dictionary.
+            // 20. Set the publicKey attribute of result to be publicKey.
+            // 21. Set the privateKey attribute of result to be privateKey.
+            // 22. Return result.
+            return Variant<GC::Ref<CryptoKey>, GC::Ref<CryptoKeyPair>> { CryptoKeyPair::create(realm, public_key, private_key) };
+        });
 }
 
 // https://w3c.github.io/webcrypto/#rsa-pss-operations
@@ -1777,7 +1800,7 @@ WebIDL::ExceptionOr<GC::Ref<JS::Object>> RSAPSS::export_key(Bindings::KeyFormat
 }
 
 // https://w3c.github.io/webcrypto/#rsassa-pkcs1-operations
-WebIDL::ExceptionOr<Variant<GC::Ref<CryptoKey>, GC::Ref<CryptoKeyPair>>> RSASSAPKCS1::generate_key(AlgorithmParams const& params, bool extractable, Vector<Bindings::KeyUsage> const& key_usages)
+WebIDL::ExceptionOr<OwnPtr<ParallelOperation<Variant<GC::Ref<CryptoKey>, GC::Ref<CryptoKeyPair>>>>> RSASSAPKCS1::generate_key_in_parallel(AlgorithmParams const& params, bool extractable, Vector<Bindings::KeyUsage> const& key_usages)
 {
     // 1. If usages contains a value which is not one of "sign" or "verify", then throw a SyntaxError.
     for (auto const& usage : key_usages) {
@@ -1786,16 +1809,9 @@ WebIDL::ExceptionOr<Variant<GC::Ref<CryptoKey>, GC::Ref<CryptoKeyPair>>> RSASSAP
         }
     }
 
-    // 2. Generate an RSA key pair, as defined in [RFC3447], with RSA modulus length equal to the modulusLength member of normalizedAlgorithm
-    //    and RSA public exponent equal to the publicExponent member of normalizedAlgorithm.
-    // 3. If performing the operation results in an error, then throw an OperationError.
     auto const& normalized_algorithm = static_cast<RsaHashedKeyGenParams const&>(params);
-    auto maybe_key_pair = ::Crypto::PK::RSA::generate_key_pair(normalized_algorithm.modulus_length, normalized_algorithm.public_exponent);
-    if (maybe_key_pair.is_error())
-        return WebIDL::OperationError::create(m_realm, "Failed to generate RSA key pair"_utf16);
-
-    auto key_pair = maybe_key_pair.release_value();
 
+    // NOTE: Steps 4 to 8 don't depend on the generated key pair, so they are performed before generating it.
     // 4. Let algorithm be a new RsaHashedKeyAlgorithm object.
     auto algorithm = RsaHashedKeyAlgorithm::create(m_realm);
 
@@ -1811,41 +1827,54 @@ WebIDL::ExceptionOr<Variant<GC::Ref<CryptoKey>, GC::Ref<CryptoKeyPair>>> RSASSAP
     // 8. Set the hash attribute of algorithm to equal the hash member of normalizedAlgorithm.
     algorithm->set_hash(normalized_algorithm.hash);
 
-    // 9. Let publicKey be a new CryptoKey representing the public key of the generated key pair.
-    auto public_key = CryptoKey::create(m_realm, CryptoKey::InternalKeyData { key_pair.public_key });
+    // 2. Generate an RSA key pair, as defined in [RFC3447], with RSA modulus length equal to the modulusLength member of normalizedAlgorithm
+    //    and RSA public exponent equal to the publicExponent member of normalizedAlgorithm.
+    // 3. If performing the operation results in an error, then throw an OperationError.
+    return create_parallel_operation<Variant<GC::Ref<CryptoKey>, GC::Ref<CryptoKeyPair>>, ::Crypto::PK::RSA::KeyPairType>(m_realm, [modulus_length = normalized_algorithm.modulus_length, public_exponent = normalized_algorithm.public_exponent] {
+        return ::Crypto::PK::RSA::generate_key_pair(modulus_length, public_exponent);
+    },
+        [realm = m_realm, algorithm, extractable, key_usages](ErrorOr<::Crypto::PK::RSA::KeyPairType> maybe_key_pair) -> WebIDL::ExceptionOr<Variant<GC::Ref<CryptoKey>, GC::Ref<CryptoKeyPair>>> {
+            if (maybe_key_pair.is_error())
+                return WebIDL::OperationError::create(realm, "Failed to generate RSA key pair"_utf16);
 
-    // 10. Set the [[type]] internal slot of publicKey to "public"
-    public_key->set_type(Bindings::KeyType::Public);
+            auto key_pair = maybe_key_pair.release_value();
 
-    // 11. Set the [[algorithm]] internal slot of publicKey to algorithm.
-    public_key->set_algorithm(algorithm);
+            // 9. Let publicKey be a new CryptoKey representing the public key of the generated key pair.
+            auto public_key = CryptoKey::create(realm, CryptoKey::InternalKeyData { key_pair.public_key });
 
-    // 12. Set the [[extractable]] internal slot of publicKey to true.
-    public_key->set_extractable(true);
+            // 10. Set the [[type]] internal slot of publicKey to "public"
+            public_key->set_type(Bindings::KeyType::Public);
 
-    // 13. Set the [[usages]] internal slot of publicKey to be the usage intersection of usages and [ "verify" ].
-    public_key->set_usages(usage_intersection(key_usages, { { Bindings::KeyUsage::Verify } }));
+            // 11. Set the [[algorithm]] internal slot of publicKey to algorithm.
+            public_key->set_algorithm(algorithm);
 
-    // 14. Let privateKey be a new CryptoKey representing the private key of the generated key pair.
-    auto private_key = CryptoKey::create(m_realm, CryptoKey::InternalKeyData { key_pair.private_key });
+            // 12. Set the [[extractable]] internal slot of publicKey to true.
+            public_key->set_extractable(true);
 
-    // 15. Set the [[type]] internal slot of privateKey to "private"
-    private_key->set_type(Bindings::KeyType::Private);
+            // 13. Set the [[usages]] internal slot of publicKey to be the usage intersection of usages and [ "verify" ].
+            public_key->set_usages(usage_intersection(key_usages, { { Bindings::KeyUsage::Verify } }));
 
-    // 16. Set the [[algorithm]] internal slot of privateKey to algorithm.
-    private_key->set_algorithm(algorithm);
+            // 14. Let privateKey be a new CryptoKey representing the private key of the generated key pair.
+            auto private_key = CryptoKey::create(realm, CryptoKey::InternalKeyData { key_pair.private_key });
 
-    // 17. Set the [[extractable]] internal slot of privateKey to extractable.
-    private_key->set_extractable(extractable);
+            // 15. Set the [[type]] internal slot of privateKey to "private"
+            private_key->set_type(Bindings::KeyType::Private);
 
-    // 18. Set the [[usages]] internal slot of privateKey to be the usage intersection of usages and [ "sign" ].
-    private_key->set_usages(usage_intersection(key_usages, { { Bindings::KeyUsage::Sign } }));
+            // 16. Set the [[algorithm]] internal slot of privateKey to algorithm.
+            private_key->set_algorithm(algorithm);
 
-    // 19. Let result be a new CryptoKeyPair dictionary.
-    // 20. Set the publicKey attribute of result to be publicKey.
-    // 21. Set the privateKey attribute of result to be privateKey.
-    // 22. Return result.
-    return Variant<GC::Ref<CryptoKey>, GC::Ref<CryptoKeyPair>> { CryptoKeyPair::create(m_realm, public_key, private_key) };
+            // 17. Set the [[extractable]] internal slot of privateKey to extractable.
+            private_key->set_extractable(extractable);
+
+            // 18. Set the [[usages]] internal slot of privateKey to be the usage intersection of usages and [ "sign" ].
+            private_key->set_usages(usage_intersection(key_usages, { { Bindings::KeyUsage::Sign } }));
+
+            // 19. Let result be a new CryptoKeyPair dictionary.
+            // 20. Set the publicKey attribute of result to be publicKey.
+            // 21. Set the privateKey attribute of result to be privateKey.
+            // 22. Return result.
+            return Variant<GC::Ref<CryptoKey>, GC::Ref<CryptoKeyPair>> { CryptoKeyPair::create(realm, public_key, private_key) };
+        });
 }
 
 // https://w3c.github.io/webcrypto/#rsassa-pkcs1-operations
@@ -2354,7 +2383,7 @@ WebIDL::ExceptionOr<GC::Ref<JS::Object>> RSASSAPKCS1::export_key(Bindings::KeyFo
 }
 
 // https://w3c.github.io/webcrypto/#aes-cbc-operations
-WebIDL::ExceptionOr<GC::Ref<JS::ArrayBuffer>> AesCbc::encrypt(AlgorithmParams const& params, GC::Ref<CryptoKey> key, ByteBuffer const& plaintext)
+WebIDL::ExceptionOr<OwnPtr<ParallelOperation<GC::Ref<JS::ArrayBuffer>>>> AesCbc::encrypt_in_parallel(AlgorithmParams const& params, GC::Ref<CryptoKey> key, ByteBuffer const& plaintext)
 {
     auto const& normalized_algorithm = static_cast<AesCbcParams const&>(params);
 
@@ -2364,19 +2393,16 @@ WebIDL::ExceptionOr<GC::Ref<JS::ArrayBuffer>> AesCbc::encrypt(AlgorithmParams co
 
     // 2. Let paddedPlaintext be the result of adding padding octets to the contents of plaintext according to the procedure defined in Section 10.3 of [RFC2315], step 2, with a value of k of 16.
     // 3. Let ciphertext be the result of performing the CBC Encryption operation described in Section 6.2 of [NIST-SP800-38A] using AES as the block cipher, the contents of the iv member of normalizedAlgorithm as the IV input parameter and paddedPlaintext as the input plaintext.
-    auto key_bytes = key->handle().get<ByteBuffer>();
-
-    ::Crypto::Cipher::AESCBCCipher cipher(key_bytes);
-    auto maybe_ciphertext = cipher.encrypt(plaintext, normalized_algorithm.iv);
-    if (maybe_ciphertext.is_error())
-        return WebIDL::OperationError::create(m_realm, "Failed to encrypt"_utf16);
-
     // 4. Return the result of creating an ArrayBuffer containing ciphertext.
-    return JS::ArrayBuffer::create(m_realm, maybe_ciphertext.release_value());
+    return create_array_buffer_operation(m_realm, [key_bytes = key->handle().get<ByteBuffer>(), iv = normalized_algorithm.iv, plaintext]() -> ErrorOr<ByteBuffer> {
+        ::Crypto::Cipher::AESCBCCipher cipher(key_bytes);
+        return cipher.encrypt(plaintext, iv);
+    },
+        "Failed to encrypt"_utf16);
 }
 
 // https://w3c.github.io/webcrypto/#aes-cbc-operations-decrypt
-WebIDL::ExceptionOr<GC::Ref<JS::ArrayBuffer>> AesCbc::decrypt(AlgorithmParams const& params, GC::Ref<CryptoKey> key, ByteBuffer const& ciphertext)
+WebIDL::ExceptionOr<OwnPtr<ParallelOperation<GC::Ref<JS::ArrayBuffer>>>> AesCbc::decrypt_in_parallel(AlgorithmParams const& params, GC::Ref<CryptoKey> key, ByteBuffer const& ciphertext)
 {
     auto const& normalized_algorithm = static_cast<AesCbcParams const&>(params);
 
@@ -2392,13 +2418,12 @@ WebIDL::ExceptionOr<GC::Ref<JS::ArrayBuffer>> AesCbc::decrypt(AlgorithmParams co
     // 4. Let p be the value of the last octet of paddedPlaintext.
     // 5. If p is zero or greater than 16, or if any of the last p octets of paddedPlaintext have a value which is not p, then throw an OperationError.
     // 6. Let plaintext be the result of removing p octets from the end of paddedPlaintext.
-    ::Crypto::Cipher::AESCBCCipher cipher(key->handle().get<ByteBuffer>());
-    auto maybe_plaintext = cipher.decrypt(ciphertext, normalized_algorithm.iv);
-    if (maybe_plaintext.is_error())
-        return WebIDL::OperationError::create(m_realm, "Failed to decrypt"_utf16);
-
     // 7. Return plaintext.
-    return JS::ArrayBuffer::create(m_realm, maybe_plaintext.release_value());
+    return create_array_buffer_operation(m_realm, [key_bytes = key->handle().get<ByteBuffer>(), iv = normalized_algorithm.iv, ciphertext]() -> ErrorOr<ByteBuffer> {
+        ::Crypto::Cipher::AESCBCCipher cipher(key_bytes);
+        return cipher.decrypt(ciphertext, iv);
+    },
+        "Failed to decrypt"_utf16);
 }
 
 // https://w3c.github.io/webcrypto/#aes-cbc-operations
@@ -2888,7 +2913,7 @@ WebIDL::ExceptionOr<Variant<GC::Ref<CryptoKey>, GC::Ref<CryptoKeyPair>>> AesCtr:
     return { key };
 }
 
-WebIDL::ExceptionOr<GC::Ref<JS::ArrayBuffer>> AesCtr::encrypt(AlgorithmParams const& params, GC::Ref<CryptoKey> key, ByteBuffer const& plaintext)
+WebIDL::ExceptionOr<OwnPtr<ParallelOperation<GC::Ref<JS::ArrayBuffer>>>> AesCtr::encrypt_in_parallel(AlgorithmParams const& params, GC::Ref<CryptoKey> key, ByteBuffer const& plaintext)
 {
     // 1. If the counter member of normalizedAlgorithm does not have length 16 bytes, then throw an OperationError.
     auto const& normalized_algorithm = static_cast<AesCtrParams const&>(params);
@@ -2906,16 +2931,15 @@ WebIDL::ExceptionOr<GC::Ref<JS::ArrayBuffer>> AesCtr::encrypt(AlgorithmParams co
     //    the contents of the counter member of normalizedAlgorithm as the initial value of the counter block,
     //    the length member of normalizedAlgorithm as the input parameter m to the standard counter block incrementing function defined in Appendix B.1 of [NIST-SP800-38A]
     //    and the contents of plaintext as the input plaintext.
-    ::Crypto::Cipher::AESCTRCipher cipher(key->handle().get<ByteBuffer>());
-    auto maybe_ciphertext = cipher.encrypt(plaintext, counter);
-    if (maybe_ciphertext.is_error())
-        return WebIDL::OperationError::create(m_realm, "Encryption failed"_utf16);
-
     // 4. Return the result of creating an ArrayBuffer containing plaintext.
-    return JS::ArrayBuffer::create(m_realm, maybe_ciphertext.release_value());
+    return create_array_buffer_operation(m_realm, [key_bytes = key->handle().get<ByteBuffer>(), counter, plaintext]() -> ErrorOr<ByteBuffer> {
+        ::Crypto::Cipher::AESCTRCipher cipher(key_bytes);
+        return cipher.encrypt(plaintext, counter);
+    },
+        "Encryption failed"_utf16);
 }
 
-WebIDL::ExceptionOr<GC::Ref<JS::ArrayBuffer>> AesCtr::decrypt(AlgorithmParams const& params, GC::Ref<CryptoKey> key, ByteBuffer const& ciphertext)
+WebIDL::ExceptionOr<OwnPtr<ParallelOperation<GC::Ref<JS::ArrayBuffer>>>> AesCtr::decrypt_in_parallel(AlgorithmParams const& params, GC::Ref<CryptoKey> key, ByteBuffer const& ciphertext)
 {
     // 1. If the counter member of normalizedAlgorithm does not have length 16 bytes, then throw an OperationError.
     auto const& normalized_algorithm = static_cast<AesCtrParams const&>(params);
@@ -2933,13 +2957,12 @@ WebIDL::ExceptionOr<GC::Ref<JS::ArrayBuffer>> AesCtr::decrypt(AlgorithmParams co
     //    the contents of the counter member of normalizedAlgorithm as the initial value of the counter block,
     //    the length member of normalizedAlgorithm as the input parameter m to the standard counter block incrementing function defined in Appendix B.1 of [NIST-SP800-38A]
     //    and the contents of ciphertext as the input ciphertext.
-    ::Crypto::Cipher::AESCTRCipher cipher(key->handle().get<ByteBuffer>());
-    auto maybe_plaintext = cipher.decrypt(ciphertext, counter);
-    if (maybe_plaintext.is_error())
-        return WebIDL::OperationError::create(m_realm, "Decryption failed"_utf16);
-
     // 4. Return the result of creating an ArrayBuffer containing plaintext.
-    return JS::ArrayBuffer::create(m_realm, maybe_plaintext.release_value());
+    return create_array_buffer_operation(m_realm, [key_bytes = key->handle().get<ByteBuffer>(), counter, ciphertext]() -> ErrorOr<ByteBuffer> {
+        ::Crypto::Cipher::AESCTRCipher cipher(key_bytes);
+        return cipher.decrypt(ciphertext, counter);
+    },
+        "Decryption failed"_utf16);
 }
 
 WebIDL::ExceptionOr<JS::Value> AesGcm::get_key_length(AlgorithmParams const& params)
@@ -3140,7 +3163,7 @@ WebIDL::ExceptionOr<GC::Ref<JS::Object>> AesGcm::export_key(Bindings::KeyFormat
     return GC::Ref { *result };
 }
 
-WebIDL::ExceptionOr<GC::Ref<JS::ArrayBuffer>> AesGcm::encrypt(AlgorithmParams const& params, GC::Ref<CryptoKey> key, ByteBuffer const& plaintext)
+WebIDL::ExceptionOr<OwnPtr<ParallelOperation<GC::Ref<JS::ArrayBuffer>>>> AesGcm::encrypt_in_parallel(AlgorithmParams const& params, GC::Ref<CryptoKey> key, ByteBuffer const& plaintext)
 {
     auto const& normalized_algorithm = static_cast<AesGcmParams const&>(params);
 
@@ -3177,22 +3200,18 @@ WebIDL::ExceptionOr<GC::Ref<JS::ArrayBuffer>> AesGcm::encrypt(AlgorithmParams co
     //    the contents of additionalData as the A input parameter,
     //    tagLength as the t pre-requisite
     //    and the contents of plaintext as the input plaintext.
-    ::Crypto::Cipher::AESGCMCipher cipher(key->handle().get<ByteBuffer>());
-    auto maybe_encrypted = cipher.encrypt(plaintext, normalized_algorithm.iv, additional_data, tag_length / 8);
-    if (maybe_encrypted.is_error()) {
-        return WebIDL::OperationError::create(m_realm, "Encryption failed"_utf16);
-    }
-
-    auto [ciphertext, tag] = maybe_encrypted.release_value();
-
     // 7. Let ciphertext be equal to C | T, where '|' denotes concatenation.
-    TRY_OR_THROW_OOM(m_realm->vm(), ciphertext.try_append(tag));
-
     // 8. Return the result of creating an ArrayBuffer containing ciphertext.
-    return JS::ArrayBuffer::create(m_realm, ciphertext);
+    return create_array_buffer_operation(m_realm, [key_bytes = key->handle().get<ByteBuffer>(), iv = normalized_algorithm.iv, additional_data = move(additional_data), tag_length, plaintext]() -> ErrorOr<ByteBuffer> {
+        ::Crypto::Cipher::AESGCMCipher cipher(key_bytes);
+        auto [ciphertext, tag] = TRY(cipher.encrypt(plaintext, iv, additional_data, tag_length / 8));
+        TRY(ciphertext.try_append(tag));
+        return ciphertext;
+    },
+        "Encryption failed"_utf16);
 }
 
-WebIDL::ExceptionOr<GC::Ref<JS::ArrayBuffer>> AesGcm::decrypt(AlgorithmParams const& params, GC::Ref<CryptoKey> key, ByteBuffer const& ciphertext)
+WebIDL::ExceptionOr<OwnPtr<ParallelOperation<GC::Ref<JS::ArrayBuffer>>>> AesGcm::decrypt_in_parallel(AlgorithmParams const& params, GC::Ref<CryptoKey> key, ByteBuffer const& ciphertext)
 {
     auto const& normalized_algorithm = static_cast<AesGcmParams const&>(params);
 
@@ -3238,16 +3257,13 @@ WebIDL::ExceptionOr<GC::Ref<JS::ArrayBuffer>> AesGcm::decrypt(AlgorithmParams co
     //    the contents of actualCiphertext as the input ciphertext, C
     //    and the contents of tag as the authentication tag, T.
     // If the result of the algorithm is the indication of inauthenticity, "FAIL": throw an OperationError
-    ::Crypto::Cipher::AESGCMCipher cipher(key->handle().get<ByteBuffer>());
-    auto maybe_plaintext = cipher.decrypt(actual_ciphertext.bytes(), normalized_algorithm.iv, additional_data, tag);
-    if (maybe_plaintext.is_error()) {
-        dbgln("FAILED: {}", maybe_plaintext.error());
-        return WebIDL::OperationError::create(m_realm, "Decryption failed"_utf16);
-    }
-
     // Otherwise: Let plaintext be the output P of the Authenticated Decryption Function.
     // 9. Return the result of creating an ArrayBuffer containing plaintext.
-    return JS::ArrayBuffer::create(m_realm, maybe_plaintext.release_value());
+    return create_array_buffer_operation(m_realm, [key_bytes = key->handle().get<ByteBuffer>(), iv = normalized_algorithm.iv, additional_data = move(additional_data), actual_ciphertext = move(actual_ciphertext), tag = move(tag)]() -> ErrorOr<ByteBuffer> {
+        ::Crypto::Cipher::AESGCMCipher cipher(key_bytes);
+        return cipher.decrypt(actual_ciphertext.bytes(), iv, additional_data, tag);
+    },
+        "Decryption failed"_utf16);
 }
 
 WebIDL::ExceptionOr<Variant<GC::Ref<CryptoKey>, GC::Ref<CryptoKeyPair>>> AesGcm::generate_key(AlgorithmParams const& params, bool extractable, Vector<Bindings::KeyUsage> const& key_usages)
@@ -3626,7 +3642,7 @@ WebIDL::ExceptionOr<GC::Ref<CryptoKey>> HKDF::import_key(AlgorithmParams const&,
     return key;
 }
 
-WebIDL::ExceptionOr<GC::Ref<JS::ArrayBuffer>> SHA::digest(AlgorithmParams const& algorithm, ByteBuffer const& data)
+WebIDL::ExceptionOr<OwnPtr<ParallelOperation<GC::Ref<JS::ArrayBuffer>>>> SHA::digest_in_parallel(AlgorithmParams const& algorithm, ByteBuffer const& data)
 {
     auto& algorithm_name = algorithm.name;
 
@@ -3643,15 +3659,14 @@ WebIDL::ExceptionOr<GC::Ref<JS::ArrayBuffer>> SHA::digest(AlgorithmParams const&
         return WebIDL::NotSupportedError::create(m_realm, Utf16String::formatted("Invalid hash function '{}'", algorithm_name));
     }
 
-    ::Crypto::Hash::Manager hash { hash_kind };
-    hash.update(data);
-
-    auto digest = hash.digest();
-    auto result_buffer = ByteBuffer::copy(digest.immutable_data(), hash.digest_size());
-    if (result_buffer.is_error())
-        return WebIDL::OperationError::create(m_realm, "Failed to create result buffer"_utf16);
+    return create_array_buffer_operation(m_realm, [hash_kind, data]() -> ErrorOr<ByteBuffer> {
+        ::Crypto::Hash::Manager hash { hash_kind };
+        hash.update(data);
 
-    return JS::ArrayBuffer::create(m_realm, result_buffer.release_value());
+        auto digest = hash.digest();
+        return ByteBuffer::copy(digest.immutable_data(), hash.digest_size());
+    },
+        "Failed to create result buffer"_utf16);
 }
 
 // https://w3c.github.io/webcrypto/#ecdsa-operations
@@ -6742,7 +6757,7 @@ WebIDL::ExceptionOr<JS::Value> HKDF::get_key_length(AlgorithmParams const&)
 }
 
 // https://w3c.github.io/webcrypto/#pbkdf2-operations
-WebIDL::ExceptionOr<GC::Ref<JS::ArrayBuffer>> PBKDF2::derive_bits(AlgorithmParams const& params, GC::Ref<CryptoKey> key, Optional<u32> length_optional)
+WebIDL::ExceptionOr<OwnPtr<ParallelOperation<GC::Ref<JS::ArrayBuffer>>>> PBKDF2::derive_bits_in_parallel(AlgorithmParams const& params, GC::Ref<CryptoKey> key, Optional<u32> length_optional)
 {
     auto& realm = *m_realm;
     auto const& normalized_algorithm = static_cast<PBKDF2Params const&>(params);
@@ -6781,15 +6796,13 @@ WebIDL::ExceptionOr<GC::Ref<JS::ArrayBuffer>> PBKDF2::derive_bits(AlgorithmParam
         return WebIDL::NotSupportedError::create(m_realm, Utf16String::formatted("Invalid hash function '{}'", hash_algorithm));
     }());
 
-    ::Crypto::Hash::PBKDF2 pbkdf2(hash_kind);
-    auto maybe_result = pbkdf2.derive_key(password, salt, iterations, derived_key_length_bytes);
-
     // 5. If the key derivation operation fails, then throw an OperationError.
-    if (maybe_result.is_error())
-        return WebIDL::OperationError::create(realm, "Failed to derive key"_utf16);
-
     // 6. Return result
-    return JS::ArrayBuffer::create(realm, maybe_result.release_value());
+    return create_array_buffer_operation(realm, [hash_kind, password = move(password), salt = move(salt), iterations, derived_key_length_bytes]() -> ErrorOr<ByteBuffer> {
+        ::Crypto::Hash::PBKDF2 pbkdf2(hash_kind);
+        return pbkdf2.derive_key(password, salt, iterations, derived_key_length_bytes);
+    },
+        "Failed to derive key"_utf16);
 }
 
 // https://w3c.github.io/webcrypto/#pbkdf2-operations
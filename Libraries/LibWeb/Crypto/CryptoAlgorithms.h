@@ -16,6 +16,7 @@
 #include <LibWeb/Bindings/SubtleCryptoPrototype.h>
 #include <LibWeb/Crypto/CryptoBindings.h>
 #include <LibWeb/Crypto/CryptoKey.h>
+#include <LibWeb/Crypto/ParallelOperation.h>
 #include <LibWeb/WebIDL/Buffers.h>
 #include <LibWeb/WebIDL/ExceptionOr.h>
 #include <LibWeb/WebIDL/Types.h>
@@ -301,13 +302,45 @@ class AlgorithmMethods {
 public:
     virtual ~AlgorithmMethods();
 
-    virtual WebIDL::ExceptionOr<GC::Ref<JS::ArrayBuffer>> encrypt(AlgorithmParams const&, GC::Ref<CryptoKey>, ByteBuffer const&)
+    // Algorithms whose operations spend a long time crunching bytes implement them through these instead, performing
+    // all but the expensive part of the operation up front, and returning the rest as a ParallelOperation. SubtleCrypto
+    // then performs that off the event loop. A null operation means the algorithm doesn't do this.
+    virtual WebIDL::ExceptionOr<OwnPtr<ParallelOperation<GC::Ref<JS::ArrayBuffer>>>> encrypt_in_parallel(AlgorithmParams const&, GC::Ref<CryptoKey>, ByteBuffer const&)
     {
+        return OwnPtr<ParallelOperation<GC::Ref<JS::ArrayBuffer>>> {};
+    }
+
+    virtual WebIDL::ExceptionOr<OwnPtr<ParallelOperation<GC::Ref<JS::ArrayBuffer>>>> decrypt_in_parallel(AlgorithmParams const&, GC::Ref<CryptoKey>, ByteBuffer const&)
+    {
+        return OwnPtr<ParallelOperation<GC::Ref<JS::ArrayBuffer>>> {};
+    }
+
+    virtual WebIDL::ExceptionOr<OwnPtr<ParallelOperation<GC::Ref<JS::ArrayBuffer>>>> digest_in_parallel(AlgorithmParams const&, ByteBuffer const&)
+    {
+        return OwnPtr<ParallelOperation<GC::Ref<JS::ArrayBuffer>>> {};
+    }
+
+    virtual WebIDL::ExceptionOr<OwnPtr<ParallelOperation<GC::Ref<JS::ArrayBuffer>>>> derive_bits_in_parallel(AlgorithmParams const&, GC::Ref<CryptoKey>, Optional<u32>)
+    {
+        return OwnPtr<ParallelOperation<GC::Ref<JS::ArrayBuffer>>> {};
+    }
+
+    virtual WebIDL::ExceptionOr<OwnPtr<ParallelOperation<Variant<GC::Ref<CryptoKey>, GC::Ref<CryptoKeyPair>>>>> generate_key_in_parallel(AlgorithmParams const&, bool, Vector<Bindings::KeyUsage> const&)
+    {
+        return OwnPtr<ParallelOperation<Variant<GC::Ref<CryptoKey>, GC::Ref<CryptoKeyPair>>>> {};
+    }
+
+    virtual WebIDL::ExceptionOr<GC::Ref<JS::ArrayBuffer>> encrypt(AlgorithmParams const& params, GC::Ref<CryptoKey> key, ByteBuffer const& plaintext)
+    {
+        if (auto operation = TRY(encrypt_in_parallel(params, key, plaintext)))
+            return operation->perform_synchronously();
         return WebIDL::NotSupportedError::create(m_realm, "encrypt is not supported"_utf16);
     }
 
-    virtual WebIDL::ExceptionOr<GC::Ref<JS::ArrayBuffer>> decrypt(AlgorithmParams const&, GC::Ref<CryptoKey>, ByteBuffer const&)
+    virtual WebIDL::ExceptionOr<GC::Ref<JS::ArrayBuffer>> decrypt(AlgorithmParams const& params, GC::Ref<CryptoKey> key, ByteBuffer const& ciphertext)
     {
+        if (auto operation = TRY(decrypt_in_parallel(params, key, ciphertext)))
+            return operation->perform_synchronously();
         return WebIDL::NotSupportedError::create(m_realm, "decrypt is not supported"_utf16);
     }
 
@@ -321,13 +354,17 @@ public:
         return WebIDL::NotSupportedError::create(m_realm, "verify is not supported"_utf16);
     }
 
-    virtual WebIDL::ExceptionOr<GC::Ref<JS::ArrayBuffer>> digest(AlgorithmParams const&, ByteBuffer const&)
+    virtual WebIDL::ExceptionOr<GC::Ref<JS::ArrayBuffer>> digest(AlgorithmParams const& params, ByteBuffer const& data)
     {
+        if (auto operation = TRY(digest_in_parallel(params, data)))
+            return operation->perform_synchronously();
         return WebIDL::NotSupportedError::create(m_realm, "digest is not supported"_utf16);
     }
 
-    virtual WebIDL::ExceptionOr<GC::Ref<JS::ArrayBuffer>> derive_bits(AlgorithmParams const&, GC::Ref<CryptoKey>, Optional<u32>)
+    virtual WebIDL::ExceptionOr<GC::Ref<JS::ArrayBuffer>> derive_bits(AlgorithmParams const& params, GC::Ref<CryptoKey> key, Optional<u32> length)
     {
+        if (auto operation = TRY(derive_bits_in_parallel(params, key, length)))
+            return operation->perform_synchronously();
         return WebIDL::NotSupportedError::create(m_realm, "deriveBits is not supported"_utf16);
     }
 
@@ -336,8 +373,10 @@ public:
         return WebIDL::NotSupportedError::create(m_realm, "importKey is not supported"_utf16);
     }
 
-    virtual WebIDL::ExceptionOr<Variant<GC::Ref<CryptoKey>, GC::Ref<CryptoKeyPair>>> generate_key(AlgorithmParams const&, bool, Vector<Bindings::KeyUsage> const&)
+    virtual WebIDL::ExceptionOr<Variant<GC::Ref<CryptoKey>, GC::Ref<CryptoKeyPair>>> generate_key(AlgorithmParams const& params, bool extractable, Vector<Bindings::KeyUsage> const& key_usages)
     {
+        if (auto operation = TRY(generate_key_in_parallel(params, extractable, key_usages)))
+            return operation->perform_synchronously();
         return WebIDL::NotSupportedError::create(m_realm, "generateKey is not supported"_utf16);
     }
 
@@ -377,7 +416,7 @@ public:
     virtual WebIDL::ExceptionOr<GC::Ref<JS::ArrayBuffer>> encrypt(AlgorithmParams const&, GC::Ref<CryptoKey>, ByteBuffer const&) override;
     virtual WebIDL::ExceptionOr<GC::Ref<JS::ArrayBuffer>> decrypt(AlgorithmParams const&, GC::Ref<CryptoKey>, ByteBuffer const&) override;
 
-    virtual WebIDL::ExceptionOr<Variant<GC::Ref<CryptoKey>, GC::Ref<CryptoKeyPair>>> generate_key(AlgorithmParams const&, bool, Vector<Bindings::KeyUsage> const&) override;
+    virtual WebIDL::ExceptionOr<OwnPtr<ParallelOperation<Variant<GC::Ref<CryptoKey>, GC::Ref<CryptoKeyPair>>>>> generate_key_in_parallel(AlgorithmParams const&, bool, Vector<Bindings::KeyUsage> const&) override;
 
     virtual WebIDL::ExceptionOr<GC::Ref<CryptoKey>> import_key(AlgorithmParams const&, Bindings::KeyFormat, CryptoKey::InternalKeyData, bool, Vector<Bindings::KeyUsage> const&) override;
     virtual WebIDL::ExceptionOr<GC::Ref<JS::Object>> export_key(Bindings::KeyFormat, GC::Ref<CryptoKey>) override;
@@ -396,7 +435,7 @@ public:
     virtual WebIDL::ExceptionOr<GC::Ref<JS::ArrayBuffer>> sign(AlgorithmParams const&, GC::Ref<CryptoKey>, ByteBuffer const&) override;
     virtual WebIDL::ExceptionOr<JS::Value> verify(AlgorithmParams const&, GC::Ref<CryptoKey>, ByteBuffer const&, ByteBuffer const&) override;
 
-    virtual WebIDL::ExceptionOr<Variant<GC::Ref<CryptoKey>, GC::Ref<CryptoKeyPair>>> generate_key(AlgorithmParams const&, bool, Vector<Bindings::KeyUsage> const&) override;
+    virtual WebIDL::ExceptionOr<OwnPtr<ParallelOperation<Variant<GC::Ref<CryptoKey>, GC::Ref<CryptoKeyPair>>>>> generate_key_in_parallel(AlgorithmParams const&, bool, Vector<Bindings::KeyUsage> const&) override;
 
     virtual WebIDL::ExceptionOr<GC::Ref<CryptoKey>> import_key(AlgorithmParams const&, Bindings::KeyFormat, CryptoKey::InternalKeyData, bool, Vector<Bindings::KeyUsage> const&) override;
     virtual WebIDL::ExceptionOr<GC::Ref<JS::Object>> export_key(Bindings::KeyFormat, GC::Ref<CryptoKey>) override;
@@ -415,7 +454,7 @@ public:
     virtual WebIDL::ExceptionOr<GC::Ref<JS::ArrayBuffer>> sign(AlgorithmParams const&, GC::Ref<CryptoKey>, ByteBuffer const&) override;
     virtual WebIDL::ExceptionOr<JS::Value> verify(AlgorithmParams const&, GC::Ref<CryptoKey>, ByteBuffer const&, ByteBuffer const&) override;
 
-    virtual WebIDL::ExceptionOr<Variant<GC::Ref<CryptoKey>, GC::Ref<CryptoKeyPair>>> generate_key(AlgorithmParams const&, bool, Vector<Bindings::KeyUsage> const&) override;
+    virtual WebIDL::ExceptionOr<OwnPtr<ParallelOperation<Variant<GC::Ref<CryptoKey>, GC::Ref<CryptoKeyPair>>>>> generate_key_in_parallel(AlgorithmParams const&, bool, Vector<Bindings::KeyUsage> const&) override;
 
     virtual WebIDL::ExceptionOr<GC::Ref<CryptoKey>> import_key(AlgorithmParams const&, Bindings::KeyFormat, CryptoKey::InternalKeyData, bool, Vector<Bindings::KeyUsage> const&) override;
     virtual WebIDL::ExceptionOr<GC::Ref<JS::Object>> export_key(Bindings::KeyFormat, GC::Ref<CryptoKey>) override;
@@ -431,8 +470,8 @@ private:
 
 class AesCbc : public AlgorithmMethods {
 public:
-    virtual WebIDL::ExceptionOr<GC::Ref<JS::ArrayBuffer>> encrypt(AlgorithmParams const&, GC::Ref<CryptoKey>, ByteBuffer const&) override;
-    virtual WebIDL::ExceptionOr<GC::Ref<JS::ArrayBuffer>> decrypt(AlgorithmParams const&, GC::Ref<CryptoKey>, ByteBuffer const&) override;
+    virtual WebIDL::ExceptionOr<OwnPtr<ParallelOperation<GC::Ref<JS::ArrayBuffer>>>> encrypt_in_parallel(AlgorithmParams const&, GC::Ref<CryptoKey>, ByteBuffer const&) override;
+    virtual WebIDL::ExceptionOr<OwnPtr<ParallelOperation<GC::Ref<JS::ArrayBuffer>>>> decrypt_in_parallel(AlgorithmParams const&, GC::Ref<CryptoKey>, ByteBuffer const&) override;
     virtual WebIDL::ExceptionOr<GC::Ref<CryptoKey>> import_key(AlgorithmParams const&, Bindings::KeyFormat, CryptoKey::InternalKeyData, bool, Vector<Bindings::KeyUsage> const&) override;
     virtual WebIDL::ExceptionOr<Variant<GC::Ref<CryptoKey>, GC::Ref<CryptoKeyPair>>> generate_key(AlgorithmParams const&, bool, Vector<Bindings::KeyUsage> const&) override;
     virtual WebIDL::ExceptionOr<GC::Ref<JS::Object>> export_key(Bindings::KeyFormat, GC::Ref<CryptoKey>) override;
@@ -453,8 +492,8 @@ public:
     virtual WebIDL::ExceptionOr<GC::Ref<JS::Object>> export_key(Bindings::KeyFormat, GC::Ref<CryptoKey>) override;
     virtual WebIDL::ExceptionOr<JS::Value> get_key_length(AlgorithmParams const&) override;
     virtual WebIDL::ExceptionOr<Variant<GC::Ref<CryptoKey>, GC::Ref<CryptoKeyPair>>> generate_key(AlgorithmParams const&, bool, Vector<Bindings::KeyUsage> const&) override;
-    virtual WebIDL::ExceptionOr<GC::Ref<JS::ArrayBuffer>> encrypt(AlgorithmParams const&, GC::Ref<CryptoKey>, ByteBuffer const&) override;
-    virtual WebIDL::ExceptionOr<GC::Ref<JS::ArrayBuffer>> decrypt(AlgorithmParams const&, GC::Ref<CryptoKey>, ByteBuffer const&) override;
+    virtual WebIDL::ExceptionOr<OwnPtr<ParallelOperation<GC::Ref<JS::ArrayBuffer>>>> encrypt_in_parallel(AlgorithmParams const&, GC::Ref<CryptoKey>, ByteBuffer const&) override;
+    virtual WebIDL::ExceptionOr<OwnPtr<ParallelOperation<GC::Ref<JS::ArrayBuffer>>>> decrypt_in_parallel(AlgorithmParams const&, GC::Ref<CryptoKey>, ByteBuffer const&) override;
 
     static NonnullOwnPtr<AlgorithmMethods> create(JS::Realm& realm) { return adopt_own(*new AesCtr(realm)); }
 
@@ -470,8 +509,8 @@ public:
     virtual WebIDL::ExceptionOr<JS::Value> get_key_length(AlgorithmParams const&) override;
     virtual WebIDL::ExceptionOr<GC::Ref<CryptoKey>> import_key(AlgorithmParams const&, Bindings::KeyFormat, CryptoKey::InternalKeyData, bool, Vector<Bindings::KeyUsage> const&) override;
     virtual WebIDL::ExceptionOr<GC::Ref<JS::Object>> export_key(Bindings::KeyFormat, GC::Ref<CryptoKey>) override;
-    virtual WebIDL::ExceptionOr<GC::Ref<JS::ArrayBuffer>> encrypt(AlgorithmParams const&, GC::Ref<CryptoKey>, ByteBuffer const&) override;
-    virtual WebIDL::ExceptionOr<GC::Ref<JS::ArrayBuffer>> decrypt(AlgorithmParams const&, GC::Ref<CryptoKey>, ByteBuffer const&) override;
+    virtual WebIDL::ExceptionOr<OwnPtr<ParallelOperation<GC::Ref<JS::ArrayBuffer>>>> encrypt_in_parallel(AlgorithmParams const&, GC::Ref<CryptoKey>, ByteBuffer const&) override;
+    virtual WebIDL::ExceptionOr<OwnPtr<ParallelOperation<GC::Ref<JS::ArrayBuffer>>>> decrypt_in_parallel(AlgorithmParams const&, GC::Ref<CryptoKey>, ByteBuffer const&) override;
     virtual WebIDL::ExceptionOr<Variant<GC::Ref<CryptoKey>, GC::Ref<CryptoKeyPair>>> generate_key(AlgorithmParams const&, bool, Vector<Bindings::KeyUsage> const&) override;
 
     static NonnullOwnPtr<AlgorithmMethods> create(JS::Realm& realm) { return adopt_own(*new AesGcm(realm)); }
@@ -519,7 +558,7 @@ private:
 class PBKDF2 : public AlgorithmMethods {
 public:
     virtual WebIDL::ExceptionOr<GC::Ref<CryptoKey>> import_key(AlgorithmParams const&, Bindings::KeyFormat, CryptoKey::InternalKeyData, bool, Vector<Bindings::KeyUsage> const&) override;
-    virtual WebIDL::ExceptionOr<GC::Ref<JS::ArrayBuffer>> derive_bits(AlgorithmParams const&, GC::Ref<CryptoKey>, Optional<u32>) override;
+    virtual WebIDL::ExceptionOr<OwnPtr<ParallelOperation<GC::Ref<JS::ArrayBuffer>>>> derive_bits_in_parallel(AlgorithmParams const&, GC::Ref<CryptoKey>, Optional<u32>) override;
     virtual WebIDL::ExceptionOr<JS::Value> get_key_length(AlgorithmParams const&) override;
 
     static NonnullOwnPtr<AlgorithmMethods> create(JS::Realm& realm) { return adopt_own(*new PBKDF2(realm)); }
@@ -533,7 +572,7 @@ private:
 
 class SHA : public AlgorithmMethods {
 public:
-    virtual WebIDL::ExceptionOr<GC::Ref<JS::ArrayBuffer>> digest(AlgorithmParams const&, ByteBuffer const&) override;
+    virtual WebIDL::ExceptionOr<OwnPtr<ParallelOperation<GC::Ref<JS::ArrayBuffer>>>> digest_in_parallel(AlgorithmParams const&, ByteBuffer const&) override;
 
     static NonnullOwnPtr<AlgorithmMethods> create(JS::Realm& realm) { return adopt_own(*new SHA(realm)); }
 
@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/HashMap.h>
+#include <AK/Queue.h>
+#include <LibCore/EventLoop.h>
+#include <LibCore/System.h>
+#include <LibThreading/ConditionVariable.h>
+#include <LibThreading/Mutex.h>
+#include <LibThreading/Thread.h>
+#include <LibWeb/Crypto/ParallelOperation.h>
+
+namespace Web::Crypto {
+
+// Worker threads that only run the parallel steps of WebCrypto operations. Unlike LibThreading's single BackgroundAction
+// thread, several operations can run at once, and they neither wait behind nor hold up unrelated background work.
+class WorkerPool {
+public:
+    // NOTE: The pool is never destroyed, so that its workers stay around for as long as the process does.
+    static WorkerPool& the()
+    {
+        static WorkerPool* s_the = new WorkerPool(clamp(Core::System::hardware_concurrency(), 2u, 4u) - 1);
+        return *s_the;
+    }
+
+    void enqueue(Function<void()> work)
+    {
+        Threading::MutexLocker locker(m_mutex);
+        m_work.enqueue(move(work));
+        m_condition.signal();
+    }
+
+private:
+    explicit WorkerPool(size_t worker_count)
+    {
+        for (size_t i = 0; i < worker_count; ++i) {
+            auto thread = Threading::Thread::construct([this] { return run_worker(); }, "WebCrypto"sv);
+            thread->start();
+            thread->detach();
+        }
+    }
+
+    intptr_t run_worker()
+    {
+        while (true) {
+            Function<void()> work;
+            {
+                Threading::MutexLocker locker(m_mutex);
+                m_condition.wait_while([&] { return m_work.is_empty(); });
+                work = m_work.dequeue();
+            }
+            work();
+        }
+    }
+
+    Threading::Mutex m_mutex;
+    Threading::ConditionVariable m_condition { m_mutex };
+    Queue<Function<void()>> m_work;
+};
+
+struct PendingCompletion {
+    Function<void()> completion_steps;
+    bool parallel_steps_are_done { false };
+};
+
+// NOTE: These are only ever touched by the thread whose event loop started the operations, so the completion steps and
+//       the GC roots they hold are created, run and destroyed on that thread only.
+static thread_local HashMap<u64, PendingCompletion> s_pending_completions;
+static thread_local u64 s_next_operation_id { 0 };
+static thread_local u64 s_next_operation_id_to_complete { 0 };
+
+static void run_completion_steps_that_are_ready()
+{
+    while (true) {
+        auto it = s_pending_completions.find(s_next_operation_id_to_complete);
+        if (it == s_pending_completions.end() || !it->value.parallel_steps_are_done)
+            return;
+        auto completion_steps = move(it->value.completion_steps);
+        s_pending_completions.remove(it);
+        ++s_next_operation_id_to_complete;
+        completion_steps();
+    }
+}
+
+void perform_on_worker_thread(Function<void()> parallel_steps, Function<void()> completion_steps)
+{
+    auto operation_id = s_next_operation_id++;
+    s_pending_completions.set(operation_id, { move(completion_steps) });
+
+    WorkerPool::the().enqueue([parallel_steps = move(parallel_steps), operation_id, origin_event_loop = &Core::EventLoop::current()] {
+        parallel_steps();
+
+        origin_event_loop->deferred_invoke([operation_id] {
+            if (auto it = s_pending_completions.find(operation_id); it != s_pending_completions.end())
+                it->value.parallel_steps_are_done = true;
+            run_completion_steps_that_are_ready();
+        });
+        origin_event_loop->wake();
+    });
+}
+
+}
@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/AtomicRefCounted.h>
+#include <AK/Function.h>
+#include <AK/NonnullOwnPtr.h>
+#include <LibGC/Function.h>
+#include <LibGC/Root.h>
+#include <LibJS/Runtime/Realm.h>
+#include <LibWeb/HTML/EventLoop/EventLoop.h>
+#include <LibWeb/HTML/Scripting/TemporaryExecutionContext.h>
+#include <LibWeb/WebIDL/ExceptionOr.h>
+
+namespace Web::Crypto {
+
+// Runs parallel_steps on one of the worker threads dedicated to WebCrypto, then runs completion_steps on the calling
+// thread's event loop. completion_steps is kept on the calling thread throughout, so it may hold on to GC roots.
+// NOTE: Completion steps run in the order their operations were started, as they would if the operations didn't run
+//       in parallel at all.
+void perform_on_worker_thread(Function<void()> parallel_steps, Function<void()> completion_steps);
+
+// The expensive part of an operation, e.g. key derivation, key pair generation or bulk encryption, split off from its
+// other steps so that it can be performed on a background thread instead of blocking the event loop.
+template<typename T>
+class ParallelOperation {
+public:
+    using OnComplete = GC::Function<void(WebIDL::ExceptionOr<T>)>;
+
+    virtual ~ParallelOperation() = default;
+
+    // Performs the whole operation right away.
+    virtual WebIDL::ExceptionOr<T> perform_synchronously() = 0;
+
+    // Performs the parallel steps on a background thread, then queues a global task on the crypto task source to
+    // perform the completion steps and call on_complete with the result of the operation.
+    virtual void perform_in_parallel(JS::Realm&, GC::Ref<OnComplete> on_complete) = 0;
+};
+
+// The parallel steps must only work with data copied out of GC-allocated objects, and must not allocate any. Their
+// result is turned into the result of the operation by the completion steps, which always run on the event loop.
+template<typename T, typename Intermediate>
+class ParallelOperationImpl final : public ParallelOperation<T> {
+public:
+    using ParallelSteps = AK::Function<ErrorOr<Intermediate>()>;
+    using CompletionSteps = GC::Function<WebIDL::ExceptionOr<T>(ErrorOr<Intermediate>)>;
+    using OnComplete = typename ParallelOperation<T>::OnComplete;
+
+    ParallelOperationImpl(ParallelSteps parallel_steps, GC::Ref<CompletionSteps> completion_steps)
+        : m_parallel_steps(move(parallel_steps))
+        , m_completion_steps(*completion_steps)
+    {
+    }
+
+    virtual WebIDL::ExceptionOr<T> perform_synchronously() override
+    {
+        return m_completion_steps->function()(m_parallel_steps());
+    }
+
+    virtual void perform_in_parallel(JS::Realm& realm, GC::Ref<OnComplete> on_complete) override
+    {
+        // NOTE: This is shared by the worker thread, which stores the result of the parallel steps in it, and the
+        //       completion steps, which pick it up on the event loop afterwards.
+        struct ParallelResult : public AtomicRefCounted<ParallelResult> {
+            Optional<ErrorOr<Intermediate>> value;
+        };
+        auto parallel_result = adopt_ref(*new ParallelResult);
+
+        perform_on_worker_thread(
+            [parallel_steps = move(m_parallel_steps), parallel_result] {
+                parallel_result->value = parallel_steps();
+            },
+            [realm = GC::Root { realm }, completion_steps = move(m_completion_steps), on_complete = GC::Root { on_complete }, parallel_result] {
+                HTML::queue_global_task(HTML::Task::Source::Crypto, realm->global_object(), GC::create_function(realm->heap(), [realm = GC::Ref { *realm }, completion_steps = GC::Ref { *completion_steps }, on_complete = GC::Ref { *on_complete }, result = parallel_result->value.release_value()]() mutable {
+                    HTML::TemporaryExecutionContext context(*realm, HTML::TemporaryExecutionContext::CallbacksEnabled::Yes);
+                    on_complete->function()(completion_steps->function()(move(result)));
+                }));
+            });
+    }
+
+private:
+    ParallelSteps m_parallel_steps;
+    GC::Root<CompletionSteps> m_completion_steps;
+};
+
+template<typename T, typename Intermediate, typename Callable>
+OwnPtr<ParallelOperation<T>> create_parallel_operation(JS::Realm& realm, AK::Function<ErrorOr<Intermediate>()> parallel_steps, Callable&& completion_steps)
+{
+    using Operation = ParallelOperationImpl<T, Intermediate>;
+    auto steps = Operation::CompletionSteps::create(realm.heap(), forward<Callable>(completion_steps));
+    return make<Operation>(move(parallel_steps), steps);
+}
+
+}
@@ -16,6 +16,7 @@
 #include <LibWeb/Bindings/Intrinsics.h>
 #include <LibWeb/Bindings/SubtleCryptoPrototype.h>
 #include <LibWeb/Crypto/KeyAlgorithms.h>
+#include <LibWeb/Crypto/ParallelOperation.h>
 #include <LibWeb/Crypto/SubtleCrypto.h>
 #include <LibWeb/HTML/Scripting/TemporaryExecutionContext.h>
 #include <LibWeb/Platform/EventLoopPlugin.h>
@@ -30,6 +31,32 @@ static void normalize_key_usages(Vector<Bindings::KeyUsage>& key_usages)
 {
     quick_sort(key_usages);
 }
+
+// If the algorithm performs an operation in parallel, this starts doing so and returns true; on_complete is later called
+// with its result from a task on the crypto task source. Otherwise, the operation has to be performed synchronously.
+template<typename T>
+static bool perform_in_parallel_if_supported(JS::Realm& realm, WebIDL::ExceptionOr<OwnPtr<ParallelOperation<T>>> operation, GC::Ref<GC::Function<void(WebIDL::ExceptionOr<T>)>> on_complete)
+{
+    if (operation.is_error()) {
+        on_complete->function()(operation.release_error());
+        return true;
+    }
+    if (!operation.value())
+        return false;
+    operation.value()->perform_in_parallel(realm, on_complete);
+    return true;
+}
+
+static GC::Ref<GC::Function<void(WebIDL::ExceptionOr<GC::Ref<JS::ArrayBuffer>>)>> create_promise_settler(JS::Realm& realm, GC::Ref<WebIDL::Promise> promise)
+{
+    return GC::create_function(realm.heap(), [&realm, promise](WebIDL::ExceptionOr<GC::Ref<JS::ArrayBuffer>> result) {
+        if (result.is_error()) {
+            WebIDL::reject_promise(realm, promise, Bindings::exception_to_throw_completion(realm.vm(), result.release_error()).release_value());
+            return;
+        }
+        WebIDL::resolve_promise(realm, promise, result.release_value());
+    });
+}
 struct RegisteredAlgorithm {
     NonnullOwnPtr<AlgorithmMethods> (*create_methods)(JS::Realm&) = nullptr;
     JS::ThrowCompletionOr<NonnullOwnPtr<AlgorithmParams>> (*parameter_from_value)(JS::VM&, JS::Value) = nullptr;
@@ -177,14 +204,11 @@ GC::Ref<WebIDL::Promise> SubtleCrypto::encrypt(AlgorithmIdentifier const& algori
         }
 
         // 10. Let ciphertext be the result of performing the encrypt operation specified by normalizedAlgorithm using algorithm and key and with data as plaintext.
-        auto cipher_text = normalized_algorithm.methods->encrypt(*normalized_algorithm.parameter, key, data);
-        if (cipher_text.is_error()) {
-            WebIDL::reject_promise(realm, promise, Bindings::exception_to_throw_completion(realm.vm(), cipher_text.release_error()).release_value());
-            return;
-        }
-
         // 9. Resolve promise with ciphertext.
-        WebIDL::resolve_promise(realm, promise, cipher_text.release_value());
+        auto settle_promise = create_promise_settler(realm, promise);
+        if (perform_in_parallel_if_supported(realm, normalized_algorithm.methods->encrypt_in_parallel(*normalized_algorithm.parameter, key, data), settle_promise))
+            return;
+        settle_promise->function()(normalized_algorithm.methods->encrypt(*normalized_algorithm.parameter, key, data));
     }));
 
     return promise;
@@ -234,14 +258,11 @@ GC::Ref<WebIDL::Promise> SubtleCrypto::decrypt(AlgorithmIdentifier const& algori
         }
 
         // 10. Let plaintext be the result of performing the decrypt operation specified by normalizedAlgorithm using algorithm and key and with data as ciphertext.
-        auto plain_text = normalized_algorithm.methods->decrypt(*normalized_algorithm.parameter, key, data);
-        if (plain_text.is_error()) {
-            WebIDL::reject_promise(realm, promise, Bindings::exception_to_throw_completion(realm.vm(), plain_text.release_error()).release_value());
-            return;
-        }
-
         // 9. Resolve promise with plaintext.
-        WebIDL::resolve_promise(realm, promise, plain_text.release_value());
+        auto settle_promise = create_promise_settler(realm, promise);
+        if (perform_in_parallel_if_supported(realm, normalized_algorithm.methods->decrypt_in_parallel(*normalized_algorithm.parameter, key, data), settle_promise))
+            return;
+        settle_promise->function()(normalized_algorithm.methods->decrypt(*normalized_algorithm.parameter, key, data));
     }));
 
     return promise;
@@ -281,15 +302,11 @@ GC::Ref<WebIDL::Promise> SubtleCrypto::digest(AlgorithmIdentifier const& algorit
         // FIXME: Need spec reference to https://webidl.spec.whatwg.org/#reject
 
         // 8. Let result be the result of performing the digest operation specified by normalizedAlgorithm using algorithm, with data as message.
-        auto result = algorithm_object.methods->digest(*algorithm_object.parameter, data_buffer);
-
-        if (result.is_exception()) {
-            WebIDL::reject_promise(realm, promise, Bindings::exception_to_throw_completion(realm.vm(), result.release_error()).release_value());
-            return;
-        }
-
         // 9. Resolve promise with result.
-        WebIDL::resolve_promise(realm, promise, result.release_value());
+        auto settle_promise = create_promise_settler(realm, promise);
+        if (perform_in_parallel_if_supported(realm, algorithm_object.methods->digest_in_parallel(*algorithm_object.parameter, data_buffer), settle_promise))
+            return;
+        settle_promise->function()(algorithm_object.methods->digest(*algorithm_object.parameter, data_buffer));
     }));
 
     return promise;
@@ -322,34 +339,38 @@ GC::Ref<WebIDL::Promise> SubtleCrypto::generate_key(AlgorithmIdentifier algorith
 
         // 7. Let result be the result of performing the generate key operation specified by normalizedAlgorithm
         //    using algorithm, extractable and usages.
-        auto result_or_error = normalized_algorithm.methods->generate_key(*normalized_algorithm.parameter, extractable, key_usages);
-
-        if (result_or_error.is_error()) {
-            WebIDL::reject_promise(realm, promise, Bindings::exception_to_throw_completion(realm.vm(), result_or_error.release_error()).release_value());
+        auto settle_promise = GC::create_function(realm.heap(), [&realm, promise, key_usages_are_empty = key_usages.is_empty()](WebIDL::ExceptionOr<Variant<GC::Ref<CryptoKey>, GC::Ref<CryptoKeyPair>>> result_or_error) {
+            if (result_or_error.is_error()) {
+                WebIDL::reject_promise(realm, promise, Bindings::exception_to_throw_completion(realm.vm(), result_or_error.release_error()).release_value());
+                return;
+            }
+            auto result = result_or_error.release_value();
+
+            // 8. If result is a CryptoKey object:
+            //      If the [[type]] internal slot of result is "secret" or "private" and usages is empty, then throw a SyntaxError.
+            //    If result is a CryptoKeyPair object:
+            //      If the [[usages]] internal slot of the privateKey attribute of result is the empty sequence, then throw a SyntaxError.
+            // 9. Resolve promise with result.
+            result.visit(
+                [&](GC::Ref<CryptoKey>& key) {
+                    if ((key->type() == Bindings::KeyType::Secret || key->type() == Bindings::KeyType::Private) && key_usages_are_empty) {
+                        WebIDL::reject_promise(realm, promise, WebIDL::SyntaxError::create(realm, "usages must not be empty"_utf16));
+                        return;
+                    }
+                    WebIDL::resolve_promise(realm, promise, key);
+                },
+                [&](GC::Ref<CryptoKeyPair>& key_pair) {
+                    if (key_pair->private_key()->internal_usages().is_empty()) {
+                        WebIDL::reject_promise(realm, promise, WebIDL::SyntaxError::create(realm, "usages must not be empty"_utf16));
+                        return;
+                    }
+                    WebIDL::resolve_promise(realm, promise, key_pair);
+                });
+        });
+
+        if (perform_in_parallel_if_supported(realm, normalized_algorithm.methods->generate_key_in_parallel(*normalized_algorithm.parameter, extractable, key_usages), settle_promise))
             return;
-        }
-        auto result = result_or_error.release_value();
-
-        // 8. If result is a CryptoKey object:
-        //      If the [[type]] internal slot of result is "secret" or "private" and usages is empty, then throw a SyntaxError.
-        //    If result is a CryptoKeyPair object:
-        //      If the [[usages]] internal slot of the privateKey attribute of result is the empty sequence, then throw a SyntaxError.
-        // 9. Resolve promise with result.
-        result.visit(
-            [&](GC::Ref<CryptoKey>& key) {
-                if ((key->type() == Bindings::KeyType::Secret || key->type() == Bindings::KeyType::Private) && key_usages.is_empty()) {
-                    WebIDL::reject_promise(realm, promise, WebIDL::SyntaxError::create(realm, "usages must not be empty"_utf16));
-                    return;
-                }
-                WebIDL::resolve_promise(realm, promise, key);
-            },
-            [&](GC::Ref<CryptoKeyPair>& key_pair) {
-                if (key_pair->private_key()->internal_usages().is_empty()) {
-                    WebIDL::reject_promise(realm, promise, WebIDL::SyntaxError::create(realm, "usages must not be empty"_utf16));
-                    return;
-                }
-                WebIDL::resolve_promise(realm, promise, key_pair);
-            });
+        settle_promise->function()(normalized_algorithm.methods->generate_key(*normalized_algorithm.parameter, extractable, key_usages));
     }));
 
     return promise;
@@ -632,14 +653,11 @@ GC::Ref<WebIDL::Promise> SubtleCrypto::derive_bits(AlgorithmIdentifier algorithm
         }
 
         // 9. Let result be the result of creating an ArrayBuffer containing the result of performing the derive bits operation specified by normalizedAlgorithm using baseKey, algorithm and length.
-        auto result = normalized_algorithm.methods->derive_bits(*normalized_algorithm.parameter, base_key, length_optional);
-        if (result.is_error()) {
-            WebIDL::reject_promise(realm, promise, Bindings::exception_to_throw_completion(realm.vm(), result.release_error()).release_value());
-            return;
-        }
-
         // 10. Resolve promise with result.
-        WebIDL::resolve_promise(realm, promise, result.release_value());
+        auto settle_promise = create_promise_settler(realm, promise);
+        if (perform_in_parallel_if_supported(realm, normalized_algorithm.methods->derive_bits_in_parallel(*normalized_algorithm.parameter, base_key, length_optional), settle_promise))
+            return;
+        settle_promise->function()(normalized_algorithm.methods->derive_bits(*normalized_algorithm.parameter, base_key, length_optional));
     }));
 
     return promise;
@@ -713,35 +731,40 @@ GC::Ref<WebIDL::Promise> SubtleCrypto::derive_key(AlgorithmIdentifier algorithm,
         }
 
         // 14. Let secret be the result of performing the derive bits operation specified by normalizedAlgorithm using key, algorithm and length.
-        auto secret = normalized_algorithm.methods->derive_bits(*normalized_algorithm.parameter, base_key, length);
-        if (secret.is_error()) {
-            WebIDL::reject_promise(realm, promise, Bindings::exception_to_throw_completion(realm.vm(), secret.release_error()).release_value());
-            return;
-        }
+        auto import_derived_key = GC::create_function(realm.heap(), [&realm, promise, normalized_derived_key_algorithm_import = move(normalized_derived_key_algorithm_import), extractable, key_usages = move(key_usages)](WebIDL::ExceptionOr<GC::Ref<JS::ArrayBuffer>> secret) mutable {
+            if (secret.is_error()) {
+                WebIDL::reject_promise(realm, promise, Bindings::exception_to_throw_completion(realm.vm(), secret.release_error()).release_value());
+                return;
+            }
 
-        // 15. Let result be the result of performing the import key operation specified by normalizedDerivedKeyAlgorithmImport using "raw" as format, secret as keyData, derivedKeyType as algorithm and using extractable and usages.
-        auto result_or_error = normalized_derived_key_algorithm_import.methods->import_key(*normalized_derived_key_algorithm_import.parameter, Bindings::KeyFormat::Raw, secret.release_value()->buffer(), extractable, key_usages);
-        if (result_or_error.is_error()) {
-            WebIDL::reject_promise(realm, promise, Bindings::exception_to_throw_completion(realm.vm(), result_or_error.release_error()).release_value());
-            return;
-        }
-        auto result = result_or_error.release_value();
+            // 15. Let result be the result of performing the import key operation specified by normalizedDerivedKeyAlgorithmImport using "raw" as format, secret as keyData, derivedKeyType as algorithm and using extractable and usages.
+            auto result_or_error = normalized_derived_key_algorithm_import.methods->import_key(*normalized_derived_key_algorithm_import.parameter, Bindings::KeyFormat::Raw, secret.release_value()->buffer(), extractable, key_usages);
+            if (result_or_error.is_error()) {
+                WebIDL::reject_promise(realm, promise, Bindings::exception_to_throw_completion(realm.vm(), result_or_error.release_error()).release_value());
+                return;
+            }
+            auto result = result_or_error.release_value();
 
-        // 16. If the [[type]] internal slot of result is "secret" or "private" and usages is empty, then throw a SyntaxError.
-        if ((result->type() == Bindings::KeyType::Secret || result->type() == Bindings::KeyType::Private) && key_usages.is_empty()) {
-            WebIDL::reject_promise(realm, promise, WebIDL::SyntaxError::create(realm, "usages must not be empty"_utf16));
-            return;
-        }
+            // 16. If the [[type]] internal slot of result is "secret" or "private" and usages is empty, then throw a SyntaxError.
+            if ((result->type() == Bindings::KeyType::Secret || result->type() == Bindings::KeyType::Private) && key_usages.is_empty()) {
+                WebIDL::reject_promise(realm, promise, WebIDL::SyntaxError::create(realm, "usages must not be empty"_utf16));
+                return;
+            }
 
-        // 17. Set the [[extractable]] internal slot of result to extractable.
-        result->set_extractable(extractable);
+            // 17. Set the [[extractable]] internal slot of result to extractable.
+            result->set_extractable(extractable);
 
-        // 18. Set the [[usages]] internal slot of result to the normalized value of usages.
-        normalize_key_usages(key_usages);
-        result->set_usages(key_usages);
+            // 18. Set the [[usages]] internal slot of result to the normalized value of usages.
+            normalize_key_usages(key_usages);
+            result->set_usages(key_usages);
 
-        // 19. Resolve promise with result.
-        WebIDL::resolve_promise(realm, promise, result);
+            // 19. Resolve promise with result.
+            WebIDL::resolve_promise(realm, promise, result);
+        });
+
+        if (perform_in_parallel_if_supported(realm, normalized_algorithm.methods->derive_bits_in_parallel(*normalized_algorithm.parameter, base_key, length), import_derived_key))
+            return;
+        import_derived_key->function()(normalized_algorithm.methods->derive_bits(*normalized_algorithm.parameter, base_key, length));
     }));
 
     return promise;
@@ -12,7 +12,7 @@
 namespace Web::DOM {
 
 // https://dom.spec.whatwg.org/#abortcontroller
-class AbortController final : public Bindings::PlatformObject {
+class AbortController : public Bindings::PlatformObject {
     WEB_PLATFORM_OBJECT(AbortController, Bindings::PlatformObject);
     GC_DECLARE_ALLOCATOR(AbortController);
 
@@ -26,12 +26,13 @@ public:
 
     void abort(JS::Value reason);
 
-private:
+protected:
     AbortController(JS::Realm&, GC::Ref<AbortSignal>);
 
     virtual void initialize(JS::Realm&) override;
     virtual void visit_edges(Cell::Visitor&) override;
 
+private:
     // https://dom.spec.whatwg.org/#abortcontroller-signal
     GC::Ref<AbortSignal> m_signal;
 };
@@ -187,23 +187,33 @@ WebIDL::ExceptionOr<GC::Ref<AbortSignal>> AbortSignal::create_dependent_abort_si
     // 1. Let resultSignal be a new object implementing signalInterface using realm.
     auto result_signal = TRY(construct_impl(realm));
 
+    result_signal->make_dependent_on(signals);
+
+    // 5. Return resultSignal
+    return result_signal;
+}
+
+void AbortSignal::make_dependent_on(Vector<GC::Root<AbortSignal>> const& signals)
+{
+    auto& result_signal = *this;
+
     // 2. For each signal of signals: if signal is aborted, then set resultSignal’s abort reason to signal’s abort reason and return resultSignal.
     for (auto const& signal : signals) {
         if (signal->aborted()) {
-            result_signal->set_reason(signal->reason());
-            return result_signal;
+            result_signal.set_reason(signal->reason());
+            return;
         }
     }
 
     // 3. Set resultSignal’s dependent to true.
-    result_signal->set_dependent(true);
+    result_signal.set_dependent(true);
 
     // 4. For each signal of signals:
     for (auto const& signal : signals) {
         // 1. If signal’s dependent is false, then:
         if (!signal->dependent()) {
             // 1. Append signal to resultSignal’s source signals.
-            result_signal->append_source_signal({ signal });
+            result_signal.append_source_signal({ signal });
 
             // 2. Append resultSignal to signal’s dependent signals.
             signal->append_dependent_signal(result_signal);
@@ -217,16 +227,13 @@ WebIDL::ExceptionOr<GC::Ref<AbortSignal>> AbortSignal::create_dependent_abort_si
                 VERIFY(!source_signal->dependent());
 
                 // 2. Append sourceSignal to resultSignal’s source signals.
-                result_signal->append_source_signal(source_signal);
+                result_signal.append_source_signal(source_signal);
 
                 // 3. Append resultSignal to sourceSignal’s dependent signals.
                 source_signal->append_dependent_signal(result_signal);
             }
         }
     }
-
-    // 5. Return resultSignal
-    return result_signal;
 }
 
 }
@@ -18,7 +18,7 @@
 namespace Web::DOM {
 
 // https://dom.spec.whatwg.org/#abortsignal
-class AbortSignal final : public EventTarget {
+class AbortSignal : public EventTarget {
     WEB_PLATFORM_OBJECT(AbortSignal, EventTarget);
     GC_DECLARE_ALLOCATOR(AbortSignal);
 
@@ -52,15 +52,20 @@ public:
 
     static WebIDL::ExceptionOr<GC::Ref<AbortSignal>> create_dependent_abort_signal(JS::Realm&, Vector<GC::Root<AbortSignal>> const&);
 
-private:
+protected:
     explicit AbortSignal(JS::Realm&);
 
     virtual void initialize(JS::Realm&) override;
     virtual void visit_edges(JS::Cell::Visitor&) override;
 
+    // Runs the steps of creating a dependent abort signal that come after the result signal has been created, so that
+    // signals of other interfaces that inherit from AbortSignal can be created from other signals as well.
+    void make_dependent_on(Vector<GC::Root<AbortSignal>> const&);
+
     bool dependent() const { return m_dependent; }
     void set_dependent(bool dependent) { m_dependent = dependent; }
 
+private:
     Vector<GC::Ptr<AbortSignal>> source_signals() const { return m_source_signals; }
 
     void append_source_signal(GC::Ptr<AbortSignal> source_signal) { m_source_signals.append(source_signal); }
@@ -156,6 +156,7 @@
 #include <LibWeb/Namespace.h>
 #include <LibWeb/Page/Page.h>
 #include <LibWeb/Painting/DisplayList.h>
+#include <LibWeb/Painting/StackingContext.h>
 #include <LibWeb/Painting/ViewportPaintable.h>
 #include <LibWeb/PermissionsPolicy/AutoplayAllowlist.h>
 #include <LibWeb/ResizeObserver/ResizeObserver.h>
@@ -557,6 +558,10 @@ void Document::visit_edges(Cell::Visitor& visitor)
     visitor.visit(m_current_script);
     visitor.visit(m_associated_inert_template_document);
     visitor.visit(m_appropriate_template_contents_owner_document);
+    for (auto& [_, elements] : m_elements_by_class_for_query)
+        visitor.visit(elements);
+    for (auto& [_, elements] : m_elements_by_type_for_query)
+        visitor.visit(elements);
     visitor.visit(m_pending_parsing_blocking_script);
     visitor.visit(m_history);
     visitor.visit(m_style_computer);
@@ -594,6 +599,7 @@ void Document::visit_edges(Cell::Visitor& visitor)
 
     visitor.visit(m_associated_animation_timelines);
     visitor.visit(m_list_of_available_images);
+    visitor.visit(m_map_of_preloaded_resources);
 
     for (auto* form_associated_element : m_form_associated_elements_with_form_attribute)
         visitor.visit(form_associated_element->form_associated_element_to_html_element());
@@ -706,7 +712,7 @@ WebIDL::ExceptionOr<void> Document::run_the_document_write_steps(Vector<String>
     }
 
     // 10. Insert string into the input stream just before the insertion point.
-    m_parser->tokenizer().insert_input_at_insertion_point(string.string_view());
+    m_parser->insert_input_at_insertion_point(string.string_view());
 
     // 11. If document's pending parsing-blocking script is null, then have the HTML parser process string, one code
     //     point at a time, processing resulting tokens as they are emitted, and stopping when the tokenizer reaches
@@ -1318,6 +1324,93 @@ static void propagate_overflow_to_viewport(Element& root_element, Layout::Viewpo
     overflow_origin_computed_values.set_overflow_y(CSS::Overflow::Visible);
 }
 
+// A layout boundary is a box whose size does not depend on its contents, and whose contents cannot affect the layout of
+// anything outside of it. Changes inside of one can be laid out again without touching the rest of the tree.
+static bool is_layout_boundary(Layout::Box const& box)
+{
+    if (box.is_anonymous() || !box.paintable_box() || !is<Layout::BlockContainer>(box))
+        return false;
+
+    // Only consider in-flow block-level boxes in block flow, so the parent never looks at the boundary's contents.
+    if (!box.display().is_block_outside() || box.is_out_of_flow())
+        return false;
+    auto const* parent = box.parent();
+    if (!parent || !(parent->display().is_flow_inside() || parent->display().is_flow_root_inside()))
+        return false;
+
+    if (Layout::FormattingContext::formatting_context_type_created_by_box(box) != Layout::FormattingContext::Type::Block)
+        return false;
+
+    // The box's size must not depend on its contents. Size containment in both axes takes care of that, as does a
+    // definite size, as long as the min and max sizes aren't content-based either.
+    auto const& computed_values = box.computed_values();
+    auto is_content_independent_limit = [](CSS::Size const& size) {
+        return size.is_auto() || size.is_none() || size.is_length();
+    };
+    bool const has_definite_size = computed_values.width().is_length()
+        && computed_values.height().is_length()
+        && is_content_independent_limit(computed_values.min_width())
+        && is_content_independent_limit(computed_values.max_width())
+        && is_content_independent_limit(computed_values.min_height())
+        && is_content_independent_limit(computed_values.max_height());
+    if (!box.has_size_containment() && !has_definite_size)
+        return false;
+
+    // NOTE: Its contents must not overflow it either, since the scrollable overflow of its ancestors is not measured
+    //       again after a relayout of its subtree.
+    if (computed_values.overflow_x() == CSS::Overflow::Visible || computed_values.overflow_y() == CSS::Overflow::Visible)
+        return false;
+
+    // Absolutely positioned descendants are laid out by their containing block, so they must not escape the boundary.
+    bool has_escaping_abspos_descendant = false;
+    box.for_each_in_subtree_of_type<Layout::Box>([&](auto const& descendant) {
+        if (!descendant.is_absolutely_positioned())
+            return TraversalDecision::Continue;
+        auto containing_block = descendant.containing_block();
+        if (!containing_block || !box.is_inclusive_ancestor_of(*containing_block)) {
+            has_escaping_abspos_descendant = true;
+            return TraversalDecision::Break;
+        }
+        return TraversalDecision::Continue;
+    });
+    return !has_escaping_abspos_descendant;
+}
+
+// Returns the single layout boundary that contains every node that asked for a layout update, if there is one.
+static GC::Ptr<Layout::Box> find_layout_boundary_for_relayout(Layout::Viewport& viewport)
+{
+    GC::Ptr<Layout::Box> boundary;
+    bool can_relayout_subtree = true;
+
+    viewport.for_each_in_inclusive_subtree([&](Layout::Node& node) {
+        if (!node.needs_layout_update())
+            return TraversalDecision::SkipChildrenAndContinue;
+        if (!node.is_layout_update_origin())
+            return TraversalDecision::Continue;
+
+        GC::Ptr<Layout::Box> nearest_boundary;
+        for (auto* ancestor = node.parent(); ancestor; ancestor = ancestor->parent()) {
+            if (auto* box = as_if<Layout::Box>(*ancestor); box && is_layout_boundary(*box)) {
+                nearest_boundary = box;
+                break;
+            }
+        }
+
+        if (!nearest_boundary || (boundary && boundary != nearest_boundary)) {
+            can_relayout_subtree = false;
+            return TraversalDecision::Break;
+        }
+        boundary = nearest_boundary;
+
+        // Everything below this node is laid out again anyway.
+        return TraversalDecision::SkipChildrenAndContinue;
+    });
+
+    if (!can_relayout_subtree)
+        return nullptr;
+    return boundary;
+}
+
 void Document::update_layout(UpdateLayoutReason reason)
 {
     auto navigable = this->navigable();
@@ -1349,7 +1442,9 @@ void Document::update_layout(UpdateLayoutReason reason)
 
     auto timer = Core::ElapsedTimer::start_new(Core::TimerType::Precise);
 
+    bool did_rebuild_layout_tree = false;
     if (!m_layout_root || needs_layout_tree_update() || child_needs_layout_tree_update() || needs_full_layout_tree_update()) {
+        did_rebuild_layout_tree = true;
         Layout::TreeBuilder tree_builder;
         m_layout_root = as<Layout::Viewport>(*tree_builder.build(*this));
 
@@ -1365,6 +1460,8 @@ void Document::update_layout(UpdateLayoutReason reason)
         }
     }
 
+    m_layout_root->assign_layout_indices(0);
+
     m_layout_root->for_each_in_inclusive_subtree([&](auto& layout_node) {
         layout_node.recompute_containing_block({});
         return TraversalDecision::Continue;
@@ -1398,9 +1495,25 @@ void Document::update_layout(UpdateLayoutReason reason)
         return TraversalDecision::Continue;
     });
 
-    Layout::LayoutState layout_state;
+    // If everything that changed is contained in a layout boundary, only lay out the boundary's subtree again and splice
+    // the result into the existing paintable tree.
+    GC::Ptr<Layout::Box> layout_boundary;
+    if (!did_rebuild_layout_tree && paintable())
+        layout_boundary = find_layout_boundary_for_relayout(*m_layout_root);
 
-    {
+    Layout::LayoutState layout_state(*m_layout_root);
+
+    if (layout_boundary) {
+        auto& boundary_state = layout_state.populate_from_paintable(*layout_boundary);
+        boundary_state.set_has_definite_width(true);
+        boundary_state.set_has_definite_height(true);
+
+        Layout::BlockFormattingContext boundary_formatting_context(layout_state, Layout::LayoutMode::Normal, *layout_boundary, nullptr);
+        boundary_formatting_context.run(
+            Layout::AvailableSpace(
+                Layout::AvailableSize::make_definite(boundary_state.content_width()),
+                Layout::AvailableSize::make_definite(boundary_state.content_height())));
+    } else {
         Layout::BlockFormattingContext root_formatting_context(layout_state, Layout::LayoutMode::Normal, *m_layout_root, nullptr);
 
         auto& viewport = static_cast<Layout::Viewport&>(*m_layout_root);
@@ -1419,7 +1532,17 @@ void Document::update_layout(UpdateLayoutReason reason)
                 Layout::AvailableSize::make_definite(viewport_rect.height())));
     }
 
-    layout_state.commit(*m_layout_root);
+    if (layout_boundary) {
+        layout_state.commit_subtree(*layout_boundary);
+        invalidate_stacking_context_tree();
+    } else {
+        layout_state.commit(*m_layout_root);
+    }
+
+    if constexpr (UPDATE_LAYOUT_DEBUG) {
+        if (layout_boundary)
+            dbgln("LAYOUT scoped to {}", layout_boundary->debug_description());
+    }
 
     // Broadcast the current viewport rect to any new paintables, so they know whether they're visible or not.
     inform_all_viewport_clients_about_the_current_viewport_rect();
@@ -1542,6 +1665,11 @@ void Document::update_style()
     if (!browsing_context())
         return;
 
+    // NOTE: Element state like :hover or :focus may have changed since the last style update, so memoized
+    //       :has() results can't be trusted anymore.
+    style_computer().begin_style_update();
+    ScopeGuard end_style_update = [&] { style_computer().end_style_update(); };
+
     update_animated_style_if_needed();
 
     // Associated with each top-level browsing context is a current transition generation that is incremented on each
@@ -1726,14 +1854,11 @@ void Document::set_highlighted_node(GC::Ptr<Node> node, Optional<CSS::PseudoElem
     if (m_highlighted_node == node && m_highlighted_pseudo_element == pseudo_element)
         return;
 
-    if (auto layout_node = highlighted_layout_node(); layout_node && layout_node->first_paintable())
-        layout_node->first_paintable()->set_needs_display();
-
     m_highlighted_node = node;
     m_highlighted_pseudo_element = pseudo_element;
 
-    if (auto layout_node = highlighted_layout_node(); layout_node && layout_node->first_paintable())
-        layout_node->first_paintable()->set_needs_display();
+    // NOTE: The inspector overlay paints labels outside of the highlighted box, so repaint the whole viewport.
+    set_needs_display();
 }
 
 GC::Ptr<Layout::Node> Document::highlighted_layout_node()
@@ -3083,6 +3208,12 @@ void Document::completely_finish_loading()
     // 2. Set document's completely loaded time to the current time.
     m_completely_loaded_time = AK::UnixDateTime::now();
 
+    // NOTE: Whatever speculative fetches haven't been consumed by now were for elements that never made it into the
+    //       document, or never fetched their resource, so there's no point in holding on to them any longer.
+    m_map_of_preloaded_resources.remove_all_matching([](auto const&, auto const& entry) {
+        return entry->is_speculative;
+    });
+
     // NOTE: See the end of shared_declarative_refresh_steps.
     if (m_active_refresh_timer)
         m_active_refresh_timer->start();
@@ -6437,14 +6568,6 @@ void Document::set_cached_navigable(GC::Ptr<HTML::Navigable> navigable)
 
 void Document::set_needs_display(InvalidateDisplayList should_invalidate_display_list)
 {
-    set_needs_display(viewport_rect(), should_invalidate_display_list);
-}
-
-void Document::set_needs_display(CSSPixelRect const&, InvalidateDisplayList should_invalidate_display_list)
-{
-    // FIXME: Ignore updates outside the visible viewport rect.
-    //        This requires accounting for fixed-position elements in the input rect, which we don't do yet.
-
     if (should_invalidate_display_list == InvalidateDisplayList::Yes) {
         invalidate_display_list();
     }
@@ -6464,19 +6587,72 @@ void Document::set_needs_display(CSSPixelRect const&, InvalidateDisplayList shou
     }
 }
 
+void Document::set_needs_display(CSSPixelRect const& rect, InvalidateDisplayList should_invalidate_display_list)
+{
+    // FIXME: Map damage in nested navigables into the viewport of their container, instead of repainting all of it.
+    auto navigable = this->navigable();
+    if (!navigable || !navigable->is_traversable()) {
+        set_needs_display(should_invalidate_display_list);
+        return;
+    }
+
+    if (should_invalidate_display_list == InvalidateDisplayList::Yes) {
+        m_cached_display_list.clear();
+        invalidate_recorded_stacking_context_commands();
+    }
+
+    auto visible_rect = rect.intersected({ {}, viewport_rect().size() });
+    if (visible_rect.is_empty())
+        return;
+
+    // NOTE: Anti-aliased edges may bleed into the device pixels right around the rect.
+    auto damage_rect = page().enclosing_device_rect(visible_rect).to_type<int>().inflated(2, 2);
+    navigable->traversable_navigable()->set_needs_repaint(damage_rect);
+    Web::HTML::main_thread_event_loop().schedule();
+}
+
+void Document::invalidate_recorded_stacking_context_commands()
+{
+    if (auto* paintable_box = this->paintable_box(); paintable_box && paintable_box->stacking_context())
+        paintable_box->stacking_context()->invalidate_recorded_commands_in_subtree();
+}
+
 void Document::invalidate_display_list()
 {
     m_cached_display_list.clear();
+    invalidate_recorded_stacking_context_commands();
 
     auto navigable = this->navigable();
     if (!navigable)
         return;
 
+    // NOTE: We don't know what has changed, so all of the new display list has to be painted.
+    if (navigable->is_traversable())
+        navigable->traversable_navigable()->damage_entire_viewport();
+
     if (auto container = navigable->container()) {
         container->document().invalidate_display_list();
     }
 }
 
+void Document::invalidate_display_list_for(Painting::Paintable const& paintable)
+{
+    m_cached_display_list.clear();
+    paintable.invalidate_recorded_commands();
+
+    auto navigable = this->navigable();
+    if (!navigable)
+        return;
+
+    // NOTE: Our display list is painted by the paintable of our container, as part of its document's display list.
+    if (auto container = navigable->container()) {
+        if (auto const* container_paintable = container->paintable())
+            container->document().invalidate_display_list_for(*container_paintable);
+        else
+            container->document().invalidate_display_list();
+    }
+}
+
 RefPtr<Painting::DisplayList> Document::cached_display_list() const
 {
     return m_cached_display_list;
@@ -6747,6 +6923,84 @@ ElementByIdMap& Document::element_by_id() const
     return *m_element_by_id;
 }
 
+Optional<CSS::SelectorList> Document::parse_selector_for_query(StringView selector_text) const
+{
+    static constexpr size_t max_parsed_query_selectors = 64;
+
+    auto key = String::from_utf8_without_validation(selector_text.bytes());
+    if (auto cached = m_parsed_query_selectors.take(key); cached.has_value()) {
+        // Move the entry to the back, so that the least recently used one is evicted first.
+        m_parsed_query_selectors.set(key, *cached);
+        return cached.release_value();
+    }
+
+    auto selectors = parse_selector(CSS::Parser::ParsingParams { *this }, selector_text);
+    if (m_parsed_query_selectors.size() >= max_parsed_query_selectors)
+        m_parsed_query_selectors.remove(m_parsed_query_selectors.begin());
+    m_parsed_query_selectors.set(move(key), selectors);
+    return selectors;
+}
+
+// NOTE: Only this many classes and type names are indexed at a time, since a page may query for any number of them.
+static constexpr size_t max_query_element_index_size = 64;
+
+void Document::discard_query_element_indexes_if_stale()
+{
+    if (m_query_element_indexes_dom_tree_version == dom_tree_version())
+        return;
+    m_elements_by_class_for_query.clear();
+    m_elements_by_type_for_query.clear();
+    m_query_element_indexes_dom_tree_version = dom_tree_version();
+}
+
+Vector<GC::Ref<Element>> const& Document::elements_with_class_for_query(FlyString const& class_name)
+{
+    discard_query_element_indexes_if_stale();
+    if (auto it = m_elements_by_class_for_query.find(class_name); it != m_elements_by_class_for_query.end())
+        return it->value;
+
+    // Class selectors are matched case insensitively in quirks mode.
+    // See: https://drafts.csswg.org/selectors-4/#class-html
+    auto case_sensitivity = in_quirks_mode() ? CaseSensitivity::CaseInsensitive : CaseSensitivity::CaseSensitive;
+    Vector<GC::Ref<Element>> elements;
+    for_each_in_subtree_of_type<Element>([&](Element& element) {
+        if (element.has_class(class_name, case_sensitivity))
+            elements.append(element);
+        return TraversalDecision::Continue;
+    });
+
+    if (m_elements_by_class_for_query.size() >= max_query_element_index_size)
+        m_elements_by_class_for_query.clear();
+    m_elements_by_class_for_query.set(class_name, move(elements));
+    return *m_elements_by_class_for_query.get(class_name);
+}
+
+Vector<GC::Ref<Element>> const& Document::elements_with_type_for_query(FlyString const& type_name)
+{
+    discard_query_element_indexes_if_stale();
+    if (auto it = m_elements_by_type_for_query.find(type_name); it != m_elements_by_type_for_query.end())
+        return it->value;
+
+    // NOTE: This matches elements the way SelectorEngine does for a type selector without a namespace prefix.
+    // See https://html.spec.whatwg.org/multipage/semantics-other.html#case-sensitivity-of-selectors
+    auto lowercase_type_name = type_name.to_ascii_lowercase();
+    auto is_html_document = document_type() == Type::HTML;
+    Vector<GC::Ref<Element>> elements;
+    for_each_in_subtree_of_type<Element>([&](Element& element) {
+        auto matches = is_html_document && element.namespace_uri() == Namespace::HTML
+            ? element.local_name() == lowercase_type_name
+            : type_name.equals_ignoring_ascii_case(element.local_name());
+        if (matches)
+            elements.append(element);
+        return TraversalDecision::Continue;
+    });
+
+    if (m_elements_by_type_for_query.size() >= max_query_element_index_size)
+        m_elements_by_type_for_query.clear();
+    m_elements_by_type_for_query.set(type_name, move(elements));
+    return *m_elements_by_type_for_query.get(type_name);
+}
+
 String Document::dump_display_list()
 {
     update_layout(UpdateLayoutReason::DumpDisplayList);
@@ -36,6 +36,7 @@
 #include <LibWeb/HTML/HTMLScriptElement.h>
 #include <LibWeb/HTML/History.h>
 #include <LibWeb/HTML/NavigationType.h>
+#include <LibWeb/HTML/PreloadedResources.h>
 #include <LibWeb/HTML/SandboxingFlagSet.h>
 #include <LibWeb/HTML/Scripting/Environments.h>
 #include <LibWeb/HTML/VisibilityState.h>
@@ -701,6 +702,8 @@ public:
     HTML::ListOfAvailableImages& list_of_available_images();
     HTML::ListOfAvailableImages const& list_of_available_images() const;
 
+    HashMap<HTML::PreloadKey, GC::Ref<HTML::PreloadEntry>>& map_of_preloaded_resources() { return m_map_of_preloaded_resources; }
+
     void register_intersection_observer(Badge<IntersectionObserver::IntersectionObserver>, IntersectionObserver::IntersectionObserver&);
     void unregister_intersection_observer(Badge<IntersectionObserver::IntersectionObserver>, IntersectionObserver::IntersectionObserver&);
 
@@ -839,6 +842,8 @@ public:
     void set_cached_navigable(GC::Ptr<HTML::Navigable>);
 
     void set_needs_display(InvalidateDisplayList = InvalidateDisplayList::Yes);
+
+    // Only repaints the given rect, relative to the viewport. Everything else must look the same as in the last frame.
     void set_needs_display(CSSPixelRect const&, InvalidateDisplayList = InvalidateDisplayList::Yes);
 
     RefPtr<Painting::DisplayList> cached_display_list() const;
@@ -846,6 +851,10 @@ public:
 
     void invalidate_display_list();
 
+    // Like invalidate_display_list(), but only the commands recorded for the given paintable have to be recorded again.
+    // Nothing is repainted, that is up to the caller.
+    void invalidate_display_list_for(Painting::Paintable const&);
+
     Unicode::Segmenter& grapheme_segmenter() const;
     Unicode::Segmenter& word_segmenter() const;
 
@@ -927,6 +936,15 @@ public:
 
     ElementByIdMap& element_by_id() const;
 
+    // Parses selectors for querySelector(), querySelectorAll(), matches() and closest(), reusing recent results.
+    Optional<CSS::SelectorList> parse_selector_for_query(StringView) const;
+
+    // AD-HOC: The elements of this document that have the given class, or that a type selector with the given name
+    //         matches, in tree order. These are collected as querySelector() and friends first need them, and thrown
+    //         away whenever the DOM tree changes.
+    Vector<GC::Ref<Element>> const& elements_with_class_for_query(FlyString const& class_name);
+    Vector<GC::Ref<Element>> const& elements_with_type_for_query(FlyString const& type_name);
+
     auto& script_blocking_style_sheet_set() { return m_script_blocking_style_sheet_set; }
     auto const& script_blocking_style_sheet_set() const { return m_script_blocking_style_sheet_set; }
 
@@ -961,6 +979,8 @@ private:
 
     void evaluate_media_rules();
 
+    void invalidate_recorded_stacking_context_commands();
+
     enum class AddLineFeed {
         Yes,
         No,
@@ -1000,6 +1020,14 @@ private:
     URL::URL m_url;
     mutable OwnPtr<ElementByIdMap> m_element_by_id;
 
+    // Most recently used last. Failed parses are cached too, so repeated invalid selectors stay cheap.
+    mutable OrderedHashMap<String, Optional<CSS::SelectorList>> m_parsed_query_selectors;
+
+    void discard_query_element_indexes_if_stale();
+    HashMap<FlyString, Vector<GC::Ref<Element>>> m_elements_by_class_for_query;
+    HashMap<FlyString, Vector<GC::Ref<Element>>> m_elements_by_type_for_query;
+    u64 m_query_element_indexes_dom_tree_version { 0 };
+
     GC::Ptr<HTML::Window> m_window;
 
     GC::Ptr<Layout::Viewport> m_layout_root;
@@ -1178,6 +1206,9 @@ private:
     // https://html.spec.whatwg.org/multipage/images.html#list-of-available-images
     GC::Ptr<HTML::ListOfAvailableImages> m_list_of_available_images;
 
+    // https://html.spec.whatwg.org/multipage/links.html#map-of-preloaded-resources
+    HashMap<HTML::PreloadKey, GC::Ref<HTML::PreloadEntry>> m_map_of_preloaded_resources;
+
     GC::Ptr<CSS::VisualViewport> m_visual_viewport;
 
     // NOTE: Not in the spec per se, but Document must be able to access all IntersectionObservers whose root is in the document.
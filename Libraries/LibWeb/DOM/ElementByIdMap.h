@@ -17,6 +17,21 @@ public:
     void remove(FlyString const& element_id, Element&);
     GC::Ptr<Element> get(FlyString const& element_id) const;
 
+    // Invokes the callback for every element with the given id, in tree order.
+    template<typename Callback>
+    void for_each_element_with_id(FlyString const& element_id, Callback callback) const
+    {
+        auto it = m_map.find(element_id);
+        if (it == m_map.end())
+            return;
+        for (auto const& element : it->value) {
+            if (!element.has_value())
+                continue;
+            if (callback(*element) == IterationDecision::Break)
+                return;
+        }
+    }
+
 private:
     HashMap<FlyString, Vector<WeakPtr<Element>>> m_map;
 };
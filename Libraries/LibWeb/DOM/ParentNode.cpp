@@ -9,6 +9,7 @@
 #include <LibWeb/CSS/Parser/Parser.h>
 #include <LibWeb/CSS/SelectorEngine.h>
 #include <LibWeb/DOM/Document.h>
+#include <LibWeb/DOM/ElementByIdMap.h>
 #include <LibWeb/DOM/HTMLCollection.h>
 #include <LibWeb/DOM/NodeOperations.h>
 #include <LibWeb/DOM/ParentNode.h>
@@ -47,18 +48,78 @@ enum class ReturnMatches {
     First,
     All,
 };
+
+// A simple selector that every match of a selector list must match, which the candidates for matches can be looked up by.
+struct RequiredSimpleSelector {
+    CSS::Selector::SimpleSelector::Type type;
+    FlyString name;
+
+    // Whether matching this is all it takes to match the selector list.
+    bool is_entire_selector_list { false };
+};
+
+static Optional<RequiredSimpleSelector> simple_selector_required_by_selectors(CSS::SelectorList const& selectors)
+{
+    using Type = CSS::Selector::SimpleSelector::Type;
+    using NamespaceType = CSS::Selector::SimpleSelector::QualifiedName::NamespaceType;
+
+    if (selectors.size() != 1)
+        return {};
+    auto const& compound_selectors = selectors.first()->compound_selectors();
+    auto const& simple_selectors = compound_selectors.last().simple_selectors;
+    auto is_entire_selector_list = compound_selectors.size() == 1 && simple_selectors.size() == 1;
+
+    // NOTE: Ids narrow down the candidates the most, then classes, then types.
+    Optional<RequiredSimpleSelector> required_simple_selector;
+    for (auto const& simple_selector : simple_selectors) {
+        switch (simple_selector.type) {
+        case Type::Id:
+            return RequiredSimpleSelector { Type::Id, simple_selector.name(), is_entire_selector_list };
+        case Type::Class:
+            if (!required_simple_selector.has_value() || required_simple_selector->type != Type::Class)
+                required_simple_selector = RequiredSimpleSelector { Type::Class, simple_selector.name(), is_entire_selector_list };
+            break;
+        case Type::TagName: {
+            auto const& qualified_name = simple_selector.qualified_name();
+            if (required_simple_selector.has_value())
+                break;
+            if (qualified_name.namespace_type != NamespaceType::Default && qualified_name.namespace_type != NamespaceType::Any)
+                break;
+            required_simple_selector = RequiredSimpleSelector { Type::TagName, qualified_name.name.name, is_entire_selector_list };
+            break;
+        }
+        default:
+            break;
+        }
+    }
+    return required_simple_selector;
+}
+
+static ElementByIdMap const* element_by_id_map_for(ParentNode const& node)
+{
+    // The id maps are only maintained for connected trees.
+    if (!node.is_connected())
+        return nullptr;
+    auto const& root = node.root();
+    if (root.is_document())
+        return &static_cast<Document const&>(root).element_by_id();
+    if (root.is_shadow_root())
+        return &static_cast<ShadowRoot const&>(root).element_by_id();
+    return nullptr;
+}
+
 // https://dom.spec.whatwg.org/#scope-match-a-selectors-string
 static WebIDL::ExceptionOr<Variant<GC::Ptr<Element>, GC::Ref<NodeList>>> scope_match_a_selectors_string(ParentNode& node, StringView selector_text, ReturnMatches return_matches)
 {
     // To scope-match a selectors string selectors against a node, run these steps:
     // 1. Let s be the result of parse a selector selectors.
-    auto maybe_selectors = parse_selector(CSS::Parser::ParsingParams { node.document() }, selector_text);
+    auto maybe_selectors = node.document().parse_selector_for_query(selector_text);
 
     // 2. If s is failure, then throw a "SyntaxError" DOMException.
     if (!maybe_selectors.has_value())
         return WebIDL::SyntaxError::create(node.realm(), "Failed to parse selector"_utf16);
 
-    auto selectors = maybe_selectors.value();
+    auto selectors = maybe_selectors.release_value();
 
     // "Note: Support for namespaces within selectors is not planned and will not be added."
     if (contains_named_namespace(selectors))
@@ -67,19 +128,79 @@ static WebIDL::ExceptionOr<Variant<GC::Ptr<Element>, GC::Ref<NodeList>>> scope_m
     // 3. Return the result of match a selector against a tree with s and node’s root using scoping root node.
     GC::Ptr<Element> single_result;
     Vector<GC::Root<Node>> results;
-    // FIXME: This should be shadow-including. https://drafts.csswg.org/selectors-4/#match-a-selector-against-a-tree
-    node.for_each_in_subtree_of_type<Element>([&](auto& element) {
+    auto matches_any_selector = [&](Element const& element) {
         for (auto& selector : selectors) {
             SelectorEngine::MatchContext context;
-            if (SelectorEngine::matches(selector, element, nullptr, context, {}, node)) {
-                if (return_matches == ReturnMatches::First) {
-                    single_result = &element;
-                    return TraversalDecision::Break;
-                }
-                results.append(element);
-                break;
+            if (SelectorEngine::matches(selector, element, nullptr, context, {}, node))
+                return true;
+        }
+        return false;
+    };
+
+    // NOTE: When every match must match a specific id, class or type selector, the candidates can be taken from an index
+    //       of the elements that do (which is kept in tree order) instead of walking the whole subtree.
+    auto required_simple_selector = simple_selector_required_by_selectors(selectors);
+    auto take_matches_from_candidates = [&](auto for_each_candidate) -> Variant<GC::Ptr<Element>, GC::Ref<NodeList>> {
+        for_each_candidate([&](Element& element) {
+            if (!required_simple_selector->is_entire_selector_list && !matches_any_selector(element))
+                return IterationDecision::Continue;
+            if (return_matches == ReturnMatches::First) {
+                single_result = &element;
+                return IterationDecision::Break;
+            }
+            results.append(element);
+            return IterationDecision::Continue;
+        });
+
+        if (return_matches == ReturnMatches::First)
+            return { single_result };
+        return { StaticNodeList::create(node.realm(), move(results)) };
+    };
+
+    if (required_simple_selector.has_value()) {
+        switch (required_simple_selector->type) {
+        case CSS::Selector::SimpleSelector::Type::Id:
+            if (auto const* element_by_id = element_by_id_map_for(node)) {
+                return take_matches_from_candidates([&](auto callback) {
+                    element_by_id->for_each_element_with_id(required_simple_selector->name, [&](Element& element) {
+                        if (!node.is_ancestor_of(element))
+                            return IterationDecision::Continue;
+                        return callback(element);
+                    });
+                });
             }
+            break;
+        case CSS::Selector::SimpleSelector::Type::Class:
+        case CSS::Selector::SimpleSelector::Type::TagName:
+            // NOTE: The class and type indexes only cover the document's own tree, so they're only used when querying
+            //       the document itself. Narrowing them down to a subtree would take longer than walking it.
+            if (is<Document>(node)) {
+                auto& document = static_cast<Document&>(node);
+                auto const& candidates = required_simple_selector->type == CSS::Selector::SimpleSelector::Type::Class
+                    ? document.elements_with_class_for_query(required_simple_selector->name)
+                    : document.elements_with_type_for_query(required_simple_selector->name);
+                return take_matches_from_candidates([&](auto callback) {
+                    for (auto const& element : candidates) {
+                        if (callback(*element) == IterationDecision::Break)
+                            return;
+                    }
+                });
+            }
+            break;
+        default:
+            VERIFY_NOT_REACHED();
+        }
+    }
+
+    // FIXME: This should be shadow-including. https://drafts.csswg.org/selectors-4/#match-a-selector-against-a-tree
+    node.for_each_in_subtree_of_type<Element>([&](auto& element) {
+        if (!matches_any_selector(element))
+            return TraversalDecision::Continue;
+        if (return_matches == ReturnMatches::First) {
+            single_result = &element;
+            return TraversalDecision::Break;
         }
+        results.append(element);
         return TraversalDecision::Continue;
     });
 
@@ -5,7 +5,9 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/ByteBuffer.h>
 #include <AK/FlyString.h>
+#include <AK/StringBuilder.h>
 #include <LibJS/Runtime/TypedArray.h>
 #include <LibWeb/Bindings/Intrinsics.h>
 #include <LibWeb/Bindings/TextDecoderPrototype.h>
@@ -40,7 +42,7 @@ WebIDL::ExceptionOr<GC::Ref<TextDecoder>> TextDecoder::construct_impl(JS::Realm&
     // 5. Set this’s ignore BOM to options["ignoreBOM"].
     auto ignore_bom = options.value_or({}).ignore_bom;
 
-    // NOTE: This should happen in decode(), but we don't support streaming yet and share decoders across calls.
+    // NOTE: Decoders are stateless and shared, decode() keeps the state of a stream in m_stream_state instead.
     auto decoder = TextCodec::decoder_for_exact_name(encoding.value());
     VERIFY(decoder.has_value());
 
@@ -66,20 +68,57 @@ void TextDecoder::initialize(JS::Realm& realm)
 }
 
 // https://encoding.spec.whatwg.org/#dom-textdecoder-decode
-WebIDL::ExceptionOr<String> TextDecoder::decode(Optional<GC::Root<WebIDL::BufferSource>> const& input, Optional<TextDecodeOptions> const&) const
+WebIDL::ExceptionOr<String> TextDecoder::decode(Optional<GC::Root<WebIDL::BufferSource>> const& input, Optional<TextDecodeOptions> const& options)
 {
-    if (!input.has_value())
-        return TRY_OR_THROW_OOM(vm(), m_decoder.to_utf8({}));
-
-    // FIXME: Implement the streaming stuff.
-    auto data_buffer_or_error = WebIDL::get_buffer_source_copy(*input.value()->raw_object());
-    if (data_buffer_or_error.is_error())
-        return WebIDL::OperationError::create(realm(), "Failed to copy bytes from ArrayBuffer"_utf16);
-    auto& data_buffer = data_buffer_or_error.value();
-    auto result = TRY_OR_THROW_OOM(vm(), m_decoder.to_utf8({ data_buffer.data(), data_buffer.size() }));
-    if (this->fatal() && result.contains(0xfffd))
+    // 1. If this’s do not flush is false, then set this’s decoder to a new instance of this’s encoding’s decoder, this’s
+    //    I/O queue to the I/O queue of bytes « end-of-queue », and this’s BOM seen to false.
+    if (!m_do_not_flush) {
+        m_stream_state = {};
+        m_bom_seen = false;
+    }
+
+    // 2. Set this’s do not flush to options["stream"].
+    m_do_not_flush = options.value_or({}).stream;
+
+    // 3. If input is given, then push a copy of input to this’s I/O queue.
+    ByteBuffer data_buffer;
+    if (input.has_value()) {
+        auto data_buffer_or_error = WebIDL::get_buffer_source_copy(*input.value()->raw_object());
+        if (data_buffer_or_error.is_error())
+            return WebIDL::OperationError::create(realm(), "Failed to copy bytes from ArrayBuffer"_utf16);
+        data_buffer = data_buffer_or_error.release_value();
+    }
+
+    // 4. Let output be the I/O queue of scalar values « end-of-queue ».
+    // 5. While true:
+    //    1. Let item be the result of reading from this’s I/O queue.
+    //    2. If item is end-of-queue and this’s do not flush is true, then return the result of running serialize I/O
+    //       queue with this and output.
+    //    3. Otherwise:
+    //       1. Let result be the result of processing an item with item, this’s decoder, this’s I/O queue, output, and
+    //          this’s error mode.
+    //       2. If result is finished, then return the result of running serialize I/O queue with this and output.
+    //       3. Otherwise, if result is error, throw a TypeError.
+    // NOTE: The whole input is decoded in bulk. While do not flush is true, a sequence left incomplete at the end of the
+    //       input stays in m_stream_state until the next call.
+    StringBuilder builder(data_buffer.size());
+    TRY_OR_THROW_OOM(vm(), m_decoder.decode_chunk_into(m_stream_state, StringView { data_buffer.bytes() }, builder, !m_do_not_flush));
+    auto output = builder.string_view();
+    if (this->fatal() && output.contains(static_cast<u32>(0xfffd)))
         return WebIDL::SimpleException { WebIDL::SimpleExceptionType::TypeError, "Decoding failed"sv };
-    return result;
+
+    // https://encoding.spec.whatwg.org/#concept-td-serialize
+    // 3. If encoding is UTF-8, UTF-16BE, or UTF-16LE, and ignore BOM and BOM seen are false, then:
+    if (m_encoding.is_one_of("utf-8"sv, "utf-16be"sv, "utf-16le"sv) && !m_ignore_bom && !m_bom_seen && !output.is_empty()) {
+        // 1. Set BOM seen to true.
+        m_bom_seen = true;
+
+        // 2. If item is U+FEFF BOM, then continue.
+        if (output.starts_with("\xEF\xBB\xBF"sv))
+            return String::from_utf8_without_validation(output.substring_view(3).bytes());
+    }
+
+    return builder.to_string_without_validation();
 }
 
 }
@@ -37,7 +37,7 @@ public:
 
     virtual ~TextDecoder() override;
 
-    WebIDL::ExceptionOr<String> decode(Optional<GC::Root<WebIDL::BufferSource>> const&, Optional<TextDecodeOptions> const& options = {}) const;
+    WebIDL::ExceptionOr<String> decode(Optional<GC::Root<WebIDL::BufferSource>> const&, Optional<TextDecodeOptions> const& options = {});
 
     FlyString const& encoding() const { return m_encoding; }
     bool fatal() const { return m_fatal; }
@@ -52,6 +52,15 @@ private:
     FlyString m_encoding;
     bool m_fatal { false };
     bool m_ignore_bom { false };
+
+    // https://encoding.spec.whatwg.org/#textdecoder-do-not-flush
+    bool m_do_not_flush { false };
+
+    // https://encoding.spec.whatwg.org/#textdecoder-bom-seen
+    bool m_bom_seen { false };
+
+    // NOTE: The decoders are shared, so the state of the current stream is kept here.
+    TextCodec::DecoderStreamState m_stream_state;
 };
 
 }
@@ -38,7 +38,7 @@ bool BodyMixin::is_unusable() const
 {
     // An object including the Body interface mixin is said to be unusable if its body is non-null and its body’s stream is disturbed or locked.
     auto const& body = body_impl();
-    return body && (body->stream()->is_disturbed() || body->stream()->is_locked());
+    return body && (body->is_disturbed() || body->is_locked());
 }
 
 // https://fetch.spec.whatwg.org/#dom-body-body
@@ -54,7 +54,7 @@ bool BodyMixin::body_used() const
 {
     // The bodyUsed getter steps are to return true if this’s body is non-null and this’s body’s stream is disturbed; otherwise false.
     auto const& body = body_impl();
-    return body && body->stream()->is_disturbed();
+    return body && body->is_disturbed();
 }
 
 // https://fetch.spec.whatwg.org/#dom-body-arraybuffer
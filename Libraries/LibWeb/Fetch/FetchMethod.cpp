@@ -177,6 +177,12 @@ void abort_fetch(JS::Realm& realm, WebIDL::Promise const& promise, GC::Ref<Infra
 
     // 5. If response’s body is non-null and is readable, then error response’s body with error.
     if (response->body()) {
+        // NOTE: If the body is still fed by a pipe, its reader (if any) is reading from that instead of a stream.
+        if (auto pipe = response->body()->pipe()) {
+            pipe->error(error);
+            return;
+        }
+
         auto stream = response->body()->stream();
         if (stream->is_readable()) {
             stream->error(error);
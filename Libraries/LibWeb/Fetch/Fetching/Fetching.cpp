@@ -22,7 +22,6 @@
 #include <LibWeb/DOMURL/DOMURL.h>
 #include <LibWeb/Fetch/BodyInit.h>
 #include <LibWeb/Fetch/Fetching/Checks.h>
-#include <LibWeb/Fetch/Fetching/FetchedDataReceiver.h>
 #include <LibWeb/Fetch/Fetching/Fetching.h>
 #include <LibWeb/Fetch/Fetching/PendingResponse.h>
 #include <LibWeb/Fetch/Fetching/RefCountedFlag.h>
@@ -45,6 +44,7 @@
 #include <LibWeb/FileAPI/Blob.h>
 #include <LibWeb/FileAPI/BlobURLStore.h>
 #include <LibWeb/HTML/EventLoop/EventLoop.h>
+#include <LibWeb/HTML/PreloadedResources.h>
 #include <LibWeb/HTML/Scripting/Environments.h>
 #include <LibWeb/HTML/Scripting/TemporaryExecutionContext.h>
 #include <LibWeb/HTML/Window.h>
@@ -154,11 +154,10 @@ WebIDL::ExceptionOr<GC::Ref<Infrastructure::FetchController>> fetch(JS::Realm& r
             fetch_params->set_preloaded_response_candidate(response);
         });
 
-        // FIXME: 3. Let foundPreloadedResource be the result of invoking consume a preloaded resource for request’s
+        // 3. Let foundPreloadedResource be the result of invoking consume a preloaded resource for request’s
         //    window, given request’s URL, request’s destination, request’s mode, request’s credentials mode,
         //    request’s integrity metadata, and onPreloadedResponseAvailable.
-        auto found_preloaded_resource = false;
-        (void)on_preloaded_response_available;
+        auto found_preloaded_resource = HTML::consume_a_preloaded_resource(as<HTML::Window>(request.client()->global_object()), request.url(), request.destination(), request.mode(), request.credentials_mode(), request.integrity_metadata(), on_preloaded_response_available);
 
         // 4. If foundPreloadedResource is true and fetchParams’s preloaded response candidate is null, then set
         //    fetchParams’s preloaded response candidate to "pending".
@@ -369,16 +368,18 @@ WebIDL::ExceptionOr<GC::Ptr<PendingResponse>> main_fetch(JS::Realm& realm, Infra
 
         // -> fetchParams’s preloaded response candidate is not null
         if (!fetch_params.preloaded_response_candidate().has<Empty>()) {
-            // 1. Wait until fetchParams’s preloaded response candidate is not "pending".
-            HTML::main_thread_event_loop().spin_until(GC::create_function(vm.heap(), [&] {
-                return !fetch_params.preloaded_response_candidate().has<Infrastructure::FetchParams::PreloadedResponseCandidatePendingTag>();
-            }));
+            // NOTE: Rather than spinning the event loop until the candidate arrives, we hand back a pending response
+            //       that gets resolved with it. The speculative fetch that produces it may itself need the event loop
+            //       to make progress.
+            auto pending_response = PendingResponse::create(vm, request);
 
-            // 2. Assert: fetchParams’s preloaded response candidate is a response.
-            VERIFY(fetch_params.preloaded_response_candidate().has<GC::Ref<Infrastructure::Response>>());
-
-            // 3. Return fetchParams’s preloaded response candidate.
-            return PendingResponse::create(vm, request, fetch_params.preloaded_response_candidate().get<GC::Ref<Infrastructure::Response>>());
+            // 1. Wait until fetchParams’s preloaded response candidate is not "pending".
+            fetch_params.when_preloaded_response_candidate_is_available([pending_response](GC::Ref<Infrastructure::Response> response) {
+                // 2. Assert: fetchParams’s preloaded response candidate is a response.
+                // 3. Return fetchParams’s preloaded response candidate.
+                pending_response->resolve(response);
+            });
+            return pending_response;
         }
 
         // -> request’s current URL’s origin is same origin with request’s origin, and request’s response tainting is "basic"
@@ -767,6 +768,13 @@ void fetch_response_handover(JS::Realm& realm, Infrastructure::FetchParams const
     if (!internal_response->body()) {
         process_response_end_of_body();
     }
+    // NOTE: As long as nothing has asked for the body's stream, its bytes are carried by a pipe, which runs
+    //       processResponseEndOfBody itself once they have all gone through. That saves piping each of them through an
+    //       identity transform stream.
+    else if (auto pipe = internal_response->body()->pipe()) {
+        HTML::TemporaryExecutionContext const execution_context { realm, HTML::TemporaryExecutionContext::CallbacksEnabled::Yes };
+        pipe->set_end_of_body_steps(GC::create_function(realm.heap(), move(process_response_end_of_body)));
+    }
     // 7. Otherwise:
     else {
         HTML::TemporaryExecutionContext const execution_context { realm, HTML::TemporaryExecutionContext::CallbacksEnabled::Yes };
@@ -2348,33 +2356,12 @@ WebIDL::ExceptionOr<GC::Ref<PendingResponse>> nonstandard_resource_loader_file_o
     if (request->buffer_policy() == Infrastructure::Request::BufferPolicy::DoNotBufferResponse) {
         HTML::TemporaryExecutionContext execution_context { realm, HTML::TemporaryExecutionContext::CallbacksEnabled::Yes };
 
-        // 10. Let stream be a new ReadableStream.
-        auto stream = realm.create<Streams::ReadableStream>(realm);
-        auto fetched_data_receiver = realm.create<FetchedDataReceiver>(fetch_params, stream);
-
-        // 11. Let pullAlgorithm be the following steps:
-        auto pull_algorithm = GC::create_function(realm.heap(), [&realm, fetched_data_receiver]() {
-            // 1. Let promise be a new promise.
-            auto promise = WebIDL::create_promise(realm);
-
-            // 2. Run the following steps in parallel:
-            // NOTE: This is handled by FetchedDataReceiver.
-            fetched_data_receiver->set_pending_promise(promise);
-
-            // 3. Return promise.
-            return promise;
-        });
-
-        // 12. Let cancelAlgorithm be an algorithm that aborts fetchParams’s controller with reason, given reason.
-        auto cancel_algorithm = GC::create_function(realm.heap(), [&realm, &fetch_params](JS::Value reason) {
-            fetch_params.controller()->abort(realm, reason);
-            return WebIDL::create_resolved_promise(realm, JS::js_undefined());
-        });
-
-        // 13. Set up stream with byte reading support with pullAlgorithm set to pullAlgorithm, cancelAlgorithm set to cancelAlgorithm.
-        stream->set_up_with_byte_reading_support(pull_algorithm, cancel_algorithm);
+        // 10-13. Let stream be a new ReadableStream, set up with byte reading support to pull from the transmitted bytes.
+        // NOTE: The stream is only created once something asks for it. Until then, the body pipe hands the bytes to
+        //       whatever reads the body directly. See BodyPipe::create_stream().
+        auto body_pipe = Infrastructure::BodyPipe::create(realm, fetch_params.controller());
 
-        auto on_headers_received = GC::create_function(vm.heap(), [&vm, request, pending_response, stream](HTTP::HeaderMap const& response_headers, Optional<u32> status_code, Optional<String> const& reason_phrase) {
+        auto on_headers_received = GC::create_function(vm.heap(), [&vm, request, pending_response, body_pipe](HTTP::HeaderMap const& response_headers, Optional<u32> status_code, Optional<String> const& reason_phrase) {
             (void)request;
             if (pending_response->is_resolved()) {
                 // RequestServer will send us the response headers twice, the second time being for HTTP trailers. This
@@ -2402,7 +2389,7 @@ WebIDL::ExceptionOr<GC::Ref<PendingResponse>> nonstandard_resource_loader_file_o
             }
 
             // 14. Set response’s body to a new body whose stream is stream.
-            response->set_body(Infrastructure::Body::create(vm, stream));
+            response->set_body(Infrastructure::Body::create(vm, body_pipe));
 
             // 17. Return response.
             // NOTE: Typically response’s body’s stream is still being enqueued to after returning.
@@ -2411,7 +2398,7 @@ WebIDL::ExceptionOr<GC::Ref<PendingResponse>> nonstandard_resource_loader_file_o
 
         // 16. Run these steps in parallel:
         //    FIXME: 1. Run these steps, but abort when fetchParams is canceled:
-        auto on_data_received = GC::create_function(vm.heap(), [fetched_data_receiver](ReadonlyBytes bytes) {
+        auto on_data_received = GC::create_function(vm.heap(), [body_pipe](ReadonlyBytes bytes) {
             // 1. If one or more bytes have been transmitted from response’s message body, then:
             if (!bytes.is_empty()) {
                 // 1. Let bytes be the transmitted bytes.
@@ -2423,29 +2410,27 @@ WebIDL::ExceptionOr<GC::Ref<PendingResponse>> nonstandard_resource_loader_file_o
                 // FIXME: 6. If bytes is failure, then terminate fetchParams’s controller.
 
                 // 7. Append bytes to buffer.
-                fetched_data_receiver->on_data_received(bytes);
+                body_pipe->write(bytes);
 
                 // FIXME: 8. If the size of buffer is larger than an upper limit chosen by the user agent, ask the user agent
                 //           to suspend the ongoing fetch.
             }
         });
 
-        auto on_complete = GC::create_function(vm.heap(), [&vm, &realm, pending_response, stream](bool success, Requests::RequestTimingInfo const&, Optional<StringView> error_message) {
+        auto on_complete = GC::create_function(vm.heap(), [&vm, &realm, pending_response, body_pipe](bool success, Requests::RequestTimingInfo const&, Optional<StringView> error_message) {
             dbgln("FIXME: Implement on_complete timing info for unbuffered requests");
             HTML::TemporaryExecutionContext execution_context { realm, HTML::TemporaryExecutionContext::CallbacksEnabled::Yes };
 
             // 16.1.1.2. Otherwise, if the bytes transmission for response’s message body is done normally and stream is readable,
             //           then close stream, and abort these in-parallel steps.
             if (success) {
-                if (stream->is_readable())
-                    stream->close();
+                body_pipe->close();
             }
             // 16.1.2.2. Otherwise, if stream is readable, error stream with a TypeError.
             else {
                 auto error = MUST(String::formatted("Load failed: {}", error_message));
 
-                if (stream->is_readable())
-                    stream->error(JS::TypeError::create(realm, error));
+                body_pipe->error(JS::TypeError::create(realm, error));
 
                 if (!pending_response->is_resolved())
                     pending_response->resolve(Infrastructure::Response::network_error(vm, error));
@@ -2459,10 +2444,9 @@ WebIDL::ExceptionOr<GC::Ref<PendingResponse>> nonstandard_resource_loader_file_o
             dbgln_if(WEB_FETCH_DEBUG, "Fetch: ResourceLoader load for '{}' complete", request->url());
             if constexpr (WEB_FETCH_DEBUG)
                 log_response(status_code, response_headers, data);
-            auto [body, _] = TRY_OR_IGNORE(extract_body(realm, data));
             auto response = Infrastructure::Response::create(vm);
             response->set_status(status_code.value_or(200));
-            response->set_body(move(body));
+            response->set_body(Infrastructure::byte_sequence_as_body(realm, data));
             auto body_info = response->body_info();
             body_info.encoded_size = timing_info.encoded_body_size;
             body_info.decoded_size = data.size();
@@ -2492,8 +2476,7 @@ WebIDL::ExceptionOr<GC::Ref<PendingResponse>> nonstandard_resource_loader_file_o
             } else {
                 response->set_type(Infrastructure::Response::Type::Error);
                 response->set_status(status_code.value_or(400));
-                auto [body, _] = TRY_OR_IGNORE(extract_body(realm, data));
-                response->set_body(move(body));
+                response->set_body(Infrastructure::byte_sequence_as_body(realm, data));
                 auto body_info = response->body_info();
                 body_info.encoded_size = timing_info.encoded_body_size;
                 body_info.decoded_size = data.size();
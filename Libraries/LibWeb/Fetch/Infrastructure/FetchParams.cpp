@@ -40,6 +40,33 @@ void FetchParams::visit_edges(JS::Cell::Visitor& visitor)
         visitor.visit(m_task_destination.get<GC::Ref<JS::Object>>());
     if (m_preloaded_response_candidate.has<GC::Ref<Response>>())
         visitor.visit(m_preloaded_response_candidate.get<GC::Ref<Response>>());
+    visitor.visit(m_on_preloaded_response_candidate_available);
+}
+
+void FetchParams::set_preloaded_response_candidate(PreloadedResponseCandidate preloaded_response_candidate)
+{
+    m_preloaded_response_candidate = move(preloaded_response_candidate);
+
+    auto const* response = m_preloaded_response_candidate.get_pointer<GC::Ref<Response>>();
+    if (!response || !m_on_preloaded_response_candidate_available)
+        return;
+
+    auto on_available = m_on_preloaded_response_candidate_available;
+    m_on_preloaded_response_candidate_available = nullptr;
+    on_available->function()(*response);
+}
+
+void FetchParams::when_preloaded_response_candidate_is_available(Function<void(GC::Ref<Response>)> on_available)
+{
+    VERIFY(!m_preloaded_response_candidate.has<Empty>());
+    VERIFY(!m_on_preloaded_response_candidate_available);
+
+    if (auto const* response = m_preloaded_response_candidate.get_pointer<GC::Ref<Response>>()) {
+        on_available(*response);
+        return;
+    }
+
+    m_on_preloaded_response_candidate_available = GC::create_function(heap(), move(on_available));
 }
 
 // https://fetch.spec.whatwg.org/#fetch-params-aborted
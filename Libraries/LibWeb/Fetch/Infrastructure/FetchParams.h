@@ -46,7 +46,11 @@ public:
 
     [[nodiscard]] PreloadedResponseCandidate& preloaded_response_candidate() { return m_preloaded_response_candidate; }
     [[nodiscard]] PreloadedResponseCandidate const& preloaded_response_candidate() const { return m_preloaded_response_candidate; }
-    void set_preloaded_response_candidate(PreloadedResponseCandidate preloaded_response_candidate) { m_preloaded_response_candidate = move(preloaded_response_candidate); }
+    void set_preloaded_response_candidate(PreloadedResponseCandidate);
+
+    // Runs the given steps once the preloaded response candidate is a response, instead of waiting for it to stop
+    // being "pending".
+    void when_preloaded_response_candidate_is_available(Function<void(GC::Ref<Response>)>);
 
     [[nodiscard]] bool is_aborted() const;
     [[nodiscard]] bool is_canceled() const;
@@ -100,6 +104,8 @@ private:
     // preloaded response candidate (default null)
     //     Null, "pending", or a response.
     PreloadedResponseCandidate m_preloaded_response_candidate;
+
+    GC::Ptr<GC::Function<void(GC::Ref<Response>)>> m_on_preloaded_response_candidate_available;
 };
 
 }
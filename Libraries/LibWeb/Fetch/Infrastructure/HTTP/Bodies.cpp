@@ -8,7 +8,6 @@
 #include <LibJS/Runtime/PromiseCapability.h>
 #include <LibWeb/Bindings/ExceptionOrUtils.h>
 #include <LibWeb/Bindings/MainThreadVM.h>
-#include <LibWeb/Fetch/BodyInit.h>
 #include <LibWeb/Fetch/Infrastructure/HTTP/Bodies.h>
 #include <LibWeb/Fetch/Infrastructure/IncrementalReadLoopReadRequest.h>
 #include <LibWeb/Fetch/Infrastructure/Task.h>
@@ -29,6 +28,11 @@ GC::Ref<Body> Body::create(JS::VM& vm, GC::Ref<Streams::ReadableStream> stream,
     return vm.heap().allocate<Body>(stream, source, length);
 }
 
+GC::Ref<Body> Body::create(JS::VM& vm, GC::Ref<BodyPipe> pipe, SourceType source, Optional<u64> length)
+{
+    return vm.heap().allocate<Body>(pipe, source, length);
+}
+
 Body::Body(GC::Ref<Streams::ReadableStream> stream)
     : m_stream(stream)
 {
@@ -41,20 +45,57 @@ Body::Body(GC::Ref<Streams::ReadableStream> stream, SourceType source, Optional<
 {
 }
 
+Body::Body(GC::Ref<BodyPipe> pipe, SourceType source, Optional<u64> length)
+    : m_pipe(pipe)
+    , m_source(move(source))
+    , m_length(move(length))
+{
+}
+
 void Body::visit_edges(Cell::Visitor& visitor)
 {
     Base::visit_edges(visitor);
     visitor.visit(m_stream);
+    visitor.visit(m_pipe);
+}
+
+GC::Ref<Streams::ReadableStream> Body::stream() const
+{
+    if (!m_stream) {
+        m_stream = m_pipe->create_stream();
+        m_pipe = nullptr;
+    }
+    return *m_stream;
+}
+
+bool Body::is_disturbed() const
+{
+    if (m_pipe)
+        return m_pipe->is_being_read();
+    return m_stream->is_disturbed();
+}
+
+bool Body::is_locked() const
+{
+    if (m_pipe)
+        return m_pipe->is_being_read();
+    return m_stream->is_locked();
 }
 
 // https://fetch.spec.whatwg.org/#concept-body-clone
 GC::Ref<Body> Body::clone(JS::Realm& realm)
 {
+    // NOTE: If all of the bytes are already in the body's pipe, the clone can simply get a pipe with a copy of them.
+    if (m_pipe) {
+        if (auto pipe = m_pipe->clone_if_complete())
+            return Body::create(realm.vm(), *pipe, m_source, m_length);
+    }
+
     HTML::TemporaryExecutionContext execution_context { realm, HTML::TemporaryExecutionContext::CallbacksEnabled::Yes };
 
     // To clone a body body, run these steps:
     // 1. Let « out1, out2 » be the result of teeing body’s stream.
-    auto [out1, out2] = m_stream->tee(&realm).release_value_but_fixme_should_propagate_errors();
+    auto [out1, out2] = stream()->tee(&realm).release_value_but_fixme_should_propagate_errors();
 
     // 2. Set body’s stream to out1.
     m_stream = out1;
@@ -72,6 +113,12 @@ void Body::fully_read(JS::Realm& realm, Web::Fetch::Infrastructure::Body::Proces
     if (task_destination.has<Empty>())
         task_destination = HTML::ParallelQueue::create();
 
+    // NOTE: Reading a body that is still fed by a pipe doesn't need a stream, so let the pipe hand over the bytes itself.
+    if (m_pipe) {
+        m_pipe->read_fully(move(task_destination), process_body, process_body_error);
+        return;
+    }
+
     // 2. Let successSteps given a byte sequence bytes be to queue a fetch task to run processBody given bytes, with taskDestination.
     auto success_steps = [&realm, process_body, task_destination](ByteBuffer bytes) {
         queue_fetch_task(task_destination, GC::create_function(realm.heap(), [process_body, bytes = move(bytes)]() mutable {
@@ -89,7 +136,7 @@ void Body::fully_read(JS::Realm& realm, Web::Fetch::Infrastructure::Body::Proces
 
     // 4. Let reader be the result of getting a reader for body’s stream. If that threw an exception, then run errorSteps
     //    with that exception and return.
-    auto reader = m_stream->get_a_reader();
+    auto reader = stream()->get_a_reader();
 
     if (reader.is_exception()) {
         auto throw_completion = Bindings::exception_to_throw_completion(realm.vm(), reader.release_error());
@@ -104,12 +151,18 @@ void Body::fully_read(JS::Realm& realm, Web::Fetch::Infrastructure::Body::Proces
 // https://fetch.spec.whatwg.org/#body-incrementally-read
 void Body::incrementally_read(ProcessBodyChunkCallback process_body_chunk, ProcessEndOfBodyCallback process_end_of_body, ProcessBodyErrorCallback process_body_error, TaskDestination task_destination)
 {
-    HTML::TemporaryExecutionContext const execution_context { m_stream->realm(), HTML::TemporaryExecutionContext::CallbacksEnabled::Yes };
-
     // 1. If taskDestination is null, then set taskDestination to the result of starting a new parallel queue.
     if (task_destination.has<Empty>())
         task_destination = HTML::ParallelQueue::create();
 
+    // NOTE: Reading a body that is still fed by a pipe doesn't need a stream, so let the pipe hand over the bytes itself.
+    if (m_pipe) {
+        m_pipe->read_incrementally(move(task_destination), process_body_chunk, process_end_of_body, process_body_error);
+        return;
+    }
+
+    HTML::TemporaryExecutionContext const execution_context { m_stream->realm(), HTML::TemporaryExecutionContext::CallbacksEnabled::Yes };
+
     // 2. Let reader be the result of getting a reader for body’s stream.
     // NOTE: This operation will not throw an exception.
     auto reader = MUST(m_stream->get_a_reader());
@@ -134,8 +187,10 @@ void Body::incrementally_read_loop(Streams::ReadableStreamDefaultReader& reader,
 GC::Ref<Body> byte_sequence_as_body(JS::Realm& realm, ReadonlyBytes bytes)
 {
     // To get a byte sequence bytes as a body, return the body of the result of safely extracting bytes.
-    auto [body, _] = safely_extract_body(realm, bytes);
-    return body;
+    // NOTE: Safely extracting a byte sequence results in a body whose source is a copy of the bytes, whose length is
+    //       their size, and whose stream holds them. The stream is only created once something asks for it here.
+    auto source = MUST(ByteBuffer::copy(bytes));
+    return Body::create(realm.vm(), BodyPipe::create_with_bytes(realm, MUST(ByteBuffer::copy(bytes))), move(source), bytes.size());
 }
 
 }
@@ -14,6 +14,7 @@
 #include <LibGC/Ptr.h>
 #include <LibGC/Root.h>
 #include <LibWeb/Export.h>
+#include <LibWeb/Fetch/Infrastructure/HTTP/BodyPipe.h>
 #include <LibWeb/Fetch/Infrastructure/Task.h>
 #include <LibWeb/FileAPI/Blob.h>
 #include <LibWeb/Streams/ReadableStream.h>
@@ -39,9 +40,21 @@ public:
 
     [[nodiscard]] static GC::Ref<Body> create(JS::VM&, GC::Ref<Streams::ReadableStream>);
     [[nodiscard]] static GC::Ref<Body> create(JS::VM&, GC::Ref<Streams::ReadableStream>, SourceType, Optional<u64>);
+    [[nodiscard]] static GC::Ref<Body> create(JS::VM&, GC::Ref<BodyPipe>, SourceType = {}, Optional<u64> = {});
 
-    [[nodiscard]] GC::Ref<Streams::ReadableStream> stream() const { return *m_stream; }
-    void set_stream(GC::Ref<Streams::ReadableStream> value) { m_stream = value; }
+    [[nodiscard]] GC::Ref<Streams::ReadableStream> stream() const;
+    void set_stream(GC::Ref<Streams::ReadableStream> value)
+    {
+        m_stream = value;
+        m_pipe = nullptr;
+    }
+
+    // The pipe carrying this body's bytes, for as long as nothing has asked for its stream.
+    [[nodiscard]] GC::Ptr<BodyPipe> pipe() const { return m_pipe; }
+
+    // NOTE: These tell whether the body's stream is disturbed or locked, without creating it if it doesn't exist yet.
+    [[nodiscard]] bool is_disturbed() const;
+    [[nodiscard]] bool is_locked() const;
     [[nodiscard]] SourceType const& source() const { return m_source; }
     [[nodiscard]] Optional<u64> const& length() const { return m_length; }
 
@@ -56,10 +69,14 @@ public:
 private:
     explicit Body(GC::Ref<Streams::ReadableStream>);
     Body(GC::Ref<Streams::ReadableStream>, SourceType, Optional<u64>);
+    Body(GC::Ref<BodyPipe>, SourceType, Optional<u64>);
 
     // https://fetch.spec.whatwg.org/#concept-body-stream
     // A stream (a ReadableStream object).
-    GC::Ref<Streams::ReadableStream> m_stream;
+    // NOTE: Bodies fed by a pipe only get their stream once something asks for it, which internal consumers reading
+    //       the body never have to do.
+    mutable GC::Ptr<Streams::ReadableStream> m_stream;
+    mutable GC::Ptr<BodyPipe> m_pipe;
 
     // https://fetch.spec.whatwg.org/#concept-body-source
     // A source (null, a byte sequence, a Blob object, or a FormData object), initially null.
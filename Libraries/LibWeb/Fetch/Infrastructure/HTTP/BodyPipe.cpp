@@ -0,0 +1,318 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibJS/Runtime/Realm.h>
+#include <LibWeb/Bindings/ExceptionOrUtils.h>
+#include <LibWeb/Fetch/Infrastructure/FetchController.h>
+#include <LibWeb/Fetch/Infrastructure/HTTP/BodyPipe.h>
+#include <LibWeb/HTML/Scripting/ExceptionReporter.h>
+#include <LibWeb/HTML/Scripting/TemporaryExecutionContext.h>
+#include <LibWeb/Streams/ReadableStream.h>
+#include <LibWeb/WebIDL/Buffers.h>
+#include <LibWeb/WebIDL/Promise.h>
+
+namespace Web::Fetch::Infrastructure {
+
+GC_DEFINE_ALLOCATOR(BodyPipe);
+
+GC::Ref<BodyPipe> BodyPipe::create(JS::Realm& realm, GC::Ptr<FetchController> fetch_controller)
+{
+    return realm.heap().allocate<BodyPipe>(realm, fetch_controller);
+}
+
+GC::Ref<BodyPipe> BodyPipe::create_with_bytes(JS::Realm& realm, ByteBuffer bytes)
+{
+    auto pipe = create(realm);
+    pipe->m_buffer = move(bytes);
+    pipe->m_state = State::Closed;
+    return pipe;
+}
+
+BodyPipe::BodyPipe(JS::Realm& realm, GC::Ptr<FetchController> fetch_controller)
+    : m_realm(realm)
+    , m_fetch_controller(fetch_controller)
+{
+}
+
+BodyPipe::~BodyPipe() = default;
+
+void BodyPipe::visit_edges(Visitor& visitor)
+{
+    Base::visit_edges(visitor);
+    visitor.visit(m_realm);
+    visitor.visit(m_fetch_controller);
+    visitor.visit(m_error);
+    if (auto const* object = m_task_destination.get_pointer<GC::Ref<JS::Object>>())
+        visitor.visit(*object);
+    visitor.visit(m_process_bytes);
+    visitor.visit(m_process_end_of_body);
+    visitor.visit(m_process_error);
+    visitor.visit(m_stream);
+    visitor.visit(m_pending_pull_promise);
+    visitor.visit(m_end_of_body_steps);
+}
+
+void BodyPipe::write(ReadonlyBytes bytes)
+{
+    if (m_state != State::Open || bytes.is_empty())
+        return;
+
+    m_buffer.append(bytes);
+    schedule_delivery();
+}
+
+void BodyPipe::close()
+{
+    if (m_state != State::Open)
+        return;
+
+    m_state = State::Closed;
+    run_end_of_body_steps_if_needed();
+    schedule_delivery();
+}
+
+void BodyPipe::error(JS::Value error)
+{
+    if (m_state != State::Open && m_state != State::Closed)
+        return;
+
+    m_state = State::Errored;
+    m_error = error;
+    m_end_of_body_steps = nullptr;
+    schedule_delivery();
+}
+
+void BodyPipe::read_fully(TaskDestination task_destination, GC::Ref<GC::Function<void(ByteBuffer)>> process_body, GC::Ref<GC::Function<void(JS::Value)>> process_body_error)
+{
+    VERIFY(m_reader == Reader::None);
+    VERIFY(!task_destination.has<Empty>());
+
+    m_reader = Reader::Full;
+    m_task_destination = move(task_destination);
+    m_process_bytes = process_body;
+    m_process_error = process_body_error;
+    schedule_delivery();
+}
+
+void BodyPipe::read_incrementally(TaskDestination task_destination, GC::Ref<GC::Function<void(ByteBuffer)>> process_body_chunk, GC::Ref<GC::Function<void()>> process_end_of_body, GC::Ref<GC::Function<void(JS::Value)>> process_body_error)
+{
+    VERIFY(m_reader == Reader::None);
+    VERIFY(!task_destination.has<Empty>());
+
+    m_reader = Reader::Incremental;
+    m_task_destination = move(task_destination);
+    m_process_bytes = process_body_chunk;
+    m_process_end_of_body = process_end_of_body;
+    m_process_error = process_body_error;
+    schedule_delivery();
+}
+
+// This implements steps 10 to 13 of HTTP-network fetch, along with the parallel steps of its pullAlgorithm.
+// https://fetch.spec.whatwg.org/#ref-for-in-parallel④
+GC::Ref<Streams::ReadableStream> BodyPipe::create_stream()
+{
+    auto& realm = *m_realm;
+    HTML::TemporaryExecutionContext execution_context { realm, HTML::TemporaryExecutionContext::CallbacksEnabled::Yes };
+
+    // 10. Let stream be a new ReadableStream.
+    auto stream = realm.create<Streams::ReadableStream>(realm);
+
+    // 11. Let pullAlgorithm be the following steps:
+    auto pull_algorithm = GC::create_function(realm.heap(), [this, &realm]() {
+        // 1. Let promise be a new promise.
+        auto promise = WebIDL::create_promise(realm);
+
+        // 2. Run the following steps in parallel:
+        // NOTE: These are run by deliver_to_stream() once there is something to pull.
+        m_pending_pull_promise = promise;
+        schedule_delivery();
+
+        // 3. Return promise.
+        return promise;
+    });
+
+    // 12. Let cancelAlgorithm be an algorithm that aborts fetchParams’s controller with reason, given reason.
+    auto cancel_algorithm = GC::create_function(realm.heap(), [this, &realm](JS::Value reason) {
+        if (m_fetch_controller)
+            m_fetch_controller->abort(realm, reason);
+        return WebIDL::create_resolved_promise(realm, JS::js_undefined());
+    });
+
+    // 13. Set up stream with byte reading support with pullAlgorithm set to pullAlgorithm, cancelAlgorithm set to cancelAlgorithm.
+    stream->set_up_with_byte_reading_support(pull_algorithm, cancel_algorithm);
+
+    // NOTE: If the bytes have already been handed to another reader, the stream is left looking like one that has been
+    //       read to the end.
+    if (m_reader != Reader::None) {
+        stream->set_disturbed(true);
+        stream->close();
+        return stream;
+    }
+
+    m_reader = Reader::Stream;
+    m_task_destination = GC::Ref { realm.global_object() };
+    m_stream = stream;
+    schedule_delivery();
+    return stream;
+}
+
+GC::Ptr<BodyPipe> BodyPipe::clone_if_complete() const
+{
+    if (m_state != State::Closed || m_reader != Reader::None)
+        return {};
+    return create_with_bytes(m_realm, MUST(ByteBuffer::copy(m_buffer)));
+}
+
+void BodyPipe::set_end_of_body_steps(GC::Ref<GC::Function<void()>> steps)
+{
+    m_end_of_body_steps = steps;
+    run_end_of_body_steps_if_needed();
+}
+
+void BodyPipe::run_end_of_body_steps_if_needed()
+{
+    if (!m_end_of_body_steps || m_state != State::Closed)
+        return;
+
+    // NOTE: Without a reader, nothing holds the bytes back, so they count as having gone through as soon as they have
+    //       all been written.
+    if (m_reader != Reader::None && !m_buffer.is_empty())
+        return;
+
+    auto steps = m_end_of_body_steps;
+    m_end_of_body_steps = nullptr;
+    steps->function()();
+}
+
+bool BodyPipe::has_something_to_deliver() const
+{
+    switch (m_reader) {
+    case Reader::None:
+        return false;
+    case Reader::Full:
+        return m_state == State::Closed || m_state == State::Errored;
+    case Reader::Incremental:
+        return !m_buffer.is_empty() || m_state == State::Closed || m_state == State::Errored;
+    case Reader::Stream:
+        if (m_state == State::Errored)
+            return true;
+        if (m_buffer.is_empty())
+            return m_state == State::Closed;
+        return m_pending_pull_promise != nullptr;
+    }
+    VERIFY_NOT_REACHED();
+}
+
+void BodyPipe::schedule_delivery()
+{
+    // NOTE: Only one delivery is queued at a time. Any bytes that are written before it runs are handed over along with
+    //       those that were already waiting.
+    if (m_delivery_queued || !has_something_to_deliver())
+        return;
+    m_delivery_queued = true;
+
+    auto task = GC::create_function(heap(), [this]() {
+        m_delivery_queued = false;
+        deliver();
+    });
+
+    if (m_fetch_controller)
+        queue_fetch_task(*m_fetch_controller, m_task_destination, task);
+    else
+        queue_fetch_task(m_task_destination, task);
+}
+
+void BodyPipe::deliver()
+{
+    switch (m_reader) {
+    case Reader::None:
+        VERIFY_NOT_REACHED();
+
+    case Reader::Full:
+        if (m_state == State::Closed) {
+            auto bytes = move(m_buffer);
+            run_end_of_body_steps_if_needed();
+            m_state = State::Done;
+            m_process_bytes->function()(move(bytes));
+        } else if (m_state == State::Errored) {
+            m_state = State::Done;
+            m_process_error->function()(m_error);
+        }
+        break;
+
+    case Reader::Incremental:
+        if (!m_buffer.is_empty() && m_state != State::Errored)
+            m_process_bytes->function()(move(m_buffer));
+
+        if (m_state == State::Closed) {
+            run_end_of_body_steps_if_needed();
+            m_state = State::Done;
+            m_process_end_of_body->function()();
+        } else if (m_state == State::Errored) {
+            m_state = State::Done;
+            m_process_error->function()(m_error);
+        }
+        break;
+
+    case Reader::Stream:
+        deliver_to_stream();
+        break;
+    }
+}
+
+void BodyPipe::deliver_to_stream()
+{
+    auto& realm = *m_realm;
+    HTML::TemporaryExecutionContext execution_context { realm, HTML::TemporaryExecutionContext::CallbacksEnabled::Yes };
+
+    if (m_state == State::Errored) {
+        m_state = State::Done;
+        if (m_stream->is_readable())
+            m_stream->error(m_error);
+        return;
+    }
+
+    if (m_pending_pull_promise && !m_buffer.is_empty()) {
+        auto bytes = move(m_buffer);
+
+        // NOTE: Pulling from bytes only takes as many of them as fit into a BYOB request view, so keep the rest for
+        //       the next pull.
+        if (auto view = m_stream->current_byob_request_view(); view && view->byte_length() < bytes.size()) {
+            m_buffer = MUST(bytes.slice(view->byte_length(), bytes.size() - view->byte_length()));
+            bytes.trim(view->byte_length(), false);
+        }
+
+        // 1. Pull from bytes buffer into stream.
+        if (auto result = m_stream->pull_from_bytes(move(bytes)); result.is_error()) {
+            auto throw_completion = Bindings::exception_to_throw_completion(realm.vm(), result.release_error());
+
+            dbgln("BodyPipe: Stream error pulling bytes");
+            HTML::report_exception(throw_completion, realm);
+
+            return;
+        }
+
+        // 2. If stream is errored, then terminate fetchParams’s controller.
+        if (m_stream->is_errored() && m_fetch_controller)
+            m_fetch_controller->terminate();
+
+        // 3. Resolve promise with undefined.
+        auto promise = m_pending_pull_promise;
+        m_pending_pull_promise = nullptr;
+        WebIDL::resolve_promise(realm, *promise, JS::js_undefined());
+    }
+
+    // Otherwise, if the bytes transmission for response’s message body is done normally and stream is readable, then
+    // close stream.
+    if (m_state == State::Closed && m_buffer.is_empty()) {
+        run_end_of_body_steps_if_needed();
+        m_state = State::Done;
+        if (m_stream->is_readable())
+            m_stream->close();
+    }
+}
+
+}
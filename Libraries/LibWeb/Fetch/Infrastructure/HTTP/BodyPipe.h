@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/ByteBuffer.h>
+#include <LibGC/CellAllocator.h>
+#include <LibGC/Function.h>
+#include <LibJS/Heap/Cell.h>
+#include <LibWeb/Fetch/Infrastructure/Task.h>
+#include <LibWeb/Forward.h>
+
+namespace Web::Fetch::Infrastructure {
+
+// Carries the bytes of a body from wherever they come from to whatever reads them. As long as nothing asks for the
+// body's stream, the bytes are handed to the reader directly, so internal consumers of a body (documents, images,
+// scripts, XHR, ...) don't need a ReadableStream and a Uint8Array for every chunk that arrives. Bytes that arrive
+// while a delivery is already queued are coalesced into it.
+class BodyPipe final : public JS::Cell {
+    GC_CELL(BodyPipe, JS::Cell);
+    GC_DECLARE_ALLOCATOR(BodyPipe);
+
+public:
+    [[nodiscard]] static GC::Ref<BodyPipe> create(JS::Realm&, GC::Ptr<FetchController> = {});
+    [[nodiscard]] static GC::Ref<BodyPipe> create_with_bytes(JS::Realm&, ByteBuffer);
+
+    virtual ~BodyPipe() override;
+
+    // Producer side.
+    void write(ReadonlyBytes);
+    void close();
+    void error(JS::Value);
+
+    // Consumer side. A pipe can only be read once, by one of these.
+    void read_fully(TaskDestination, GC::Ref<GC::Function<void(ByteBuffer)>> process_body, GC::Ref<GC::Function<void(JS::Value)>> process_body_error);
+    void read_incrementally(TaskDestination, GC::Ref<GC::Function<void(ByteBuffer)>> process_body_chunk, GC::Ref<GC::Function<void()>> process_end_of_body, GC::Ref<GC::Function<void(JS::Value)>> process_body_error);
+    [[nodiscard]] GC::Ref<Streams::ReadableStream> create_stream();
+
+    bool is_being_read() const { return m_reader != Reader::None; }
+
+    // Returns a pipe holding a copy of this one's bytes, if they have all been written and nothing has read them yet.
+    [[nodiscard]] GC::Ptr<BodyPipe> clone_if_complete() const;
+
+    // Steps to run once all bytes have been written and handed to the reader, if there is one.
+    void set_end_of_body_steps(GC::Ref<GC::Function<void()>>);
+
+private:
+    BodyPipe(JS::Realm&, GC::Ptr<FetchController>);
+
+    virtual void visit_edges(Visitor&) override;
+
+    enum class State : u8 {
+        Open,
+        Closed,
+        Errored,
+        Done,
+    };
+
+    enum class Reader : u8 {
+        None,
+        Full,
+        Incremental,
+        Stream,
+    };
+
+    bool has_something_to_deliver() const;
+    void schedule_delivery();
+    void deliver();
+    void deliver_to_stream();
+    void run_end_of_body_steps_if_needed();
+
+    GC::Ref<JS::Realm> m_realm;
+    GC::Ptr<FetchController> m_fetch_controller;
+
+    State m_state { State::Open };
+    JS::Value m_error;
+
+    // The bytes that have been written, but not yet handed to the reader.
+    ByteBuffer m_buffer;
+
+    Reader m_reader { Reader::None };
+    TaskDestination m_task_destination;
+    bool m_delivery_queued { false };
+
+    GC::Ptr<GC::Function<void(ByteBuffer)>> m_process_bytes;
+    GC::Ptr<GC::Function<void()>> m_process_end_of_body;
+    GC::Ptr<GC::Function<void(JS::Value)>> m_process_error;
+
+    GC::Ptr<Streams::ReadableStream> m_stream;
+    GC::Ptr<WebIDL::Promise> m_pending_pull_promise;
+
+    GC::Ptr<GC::Function<void()>> m_end_of_body_steps;
+};
+
+}
@@ -43,6 +43,7 @@ class DisplayListPlayerSkia;
 class DisplayListRecorder;
 class SVGGradientPaintStyle;
 class ScrollStateSnapshot;
+class TiledRasterizer;
 using PaintStyle = RefPtr<SVGGradientPaintStyle>;
 using PaintStyleOrColor = Variant<PaintStyle, Gfx::Color>;
 using ScrollStateSnapshotByDisplayList = HashMap<NonnullRefPtr<DisplayList>, ScrollStateSnapshot>;
@@ -516,6 +517,7 @@ class RefCountedFlag;
 namespace Web::Fetch::Infrastructure {
 
 class Body;
+class BodyPipe;
 class FetchAlgorithms;
 class FetchController;
 class FetchParams;
@@ -713,6 +715,7 @@ class Navigator;
 class OffscreenCanvas;
 class OffscreenCanvasRenderingContext2D;
 class PageTransitionEvent;
+class PartialBitmapDecodedImageData;
 class Path2D;
 class Plugin;
 class PluginArray;
@@ -958,6 +961,16 @@ class Timer;
 
 }
 
+namespace Web::PrioritizedTaskScheduling {
+
+class Scheduler;
+class SchedulingState;
+class TaskController;
+class TaskPriorityChangeEvent;
+class TaskSignal;
+
+}
+
 namespace Web::ReferrerPolicy {
 
 enum class ReferrerPolicy;
@@ -988,6 +1001,12 @@ class Selection;
 
 }
 
+namespace Web::SelectorEngine {
+
+class MatchCache;
+
+}
+
 namespace Web::Serial {
 
 class Serial;
@@ -4,33 +4,160 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/AnyOf.h>
 #include <LibGC/Heap.h>
 #include <LibGfx/Bitmap.h>
+#include <LibGfx/ImageFormats/ImageDecoder.h>
+#include <LibGfx/Painter.h>
 #include <LibJS/Runtime/Realm.h>
+#include <LibWeb/DOM/Element.h>
 #include <LibWeb/HTML/AnimatedBitmapDecodedImageData.h>
+#include <LibWeb/HTML/DecodedImageCache.h>
+#include <LibWeb/Platform/EventLoopPlugin.h>
 
 namespace Web::HTML {
 
 GC_DEFINE_ALLOCATOR(AnimatedBitmapDecodedImageData);
 
-ErrorOr<GC::Ref<AnimatedBitmapDecodedImageData>> AnimatedBitmapDecodedImageData::create(JS::Realm& realm, Vector<Frame>&& frames, size_t loop_count, bool animated)
+static size_t decoded_size_of_frames(Vector<AnimatedBitmapDecodedImageData::Frame> const& frames)
 {
-    return realm.create<AnimatedBitmapDecodedImageData>(move(frames), loop_count, animated);
+    size_t size = 0;
+    for (auto const& frame : frames) {
+        if (frame.bitmap)
+            size += static_cast<size_t>(frame.bitmap->width()) * frame.bitmap->height() * sizeof(Gfx::ARGB32);
+    }
+    return size;
 }
 
-AnimatedBitmapDecodedImageData::AnimatedBitmapDecodedImageData(Vector<Frame>&& frames, size_t loop_count, bool animated)
+ErrorOr<GC::Ref<AnimatedBitmapDecodedImageData>> AnimatedBitmapDecodedImageData::create(JS::Realm& realm, Vector<Frame>&& frames, Gfx::IntSize natural_size, size_t loop_count, bool animated, ByteBuffer encoded_data, RefPtr<Platform::AnimationFrameDecoder> frame_decoder)
+{
+    auto image_data = realm.create<AnimatedBitmapDecodedImageData>(move(frames), natural_size, loop_count, animated, move(encoded_data), move(frame_decoder));
+    DecodedImageCache::the().did_decode(image_data);
+    return image_data;
+}
+
+AnimatedBitmapDecodedImageData::AnimatedBitmapDecodedImageData(Vector<Frame>&& frames, Gfx::IntSize natural_size, size_t loop_count, bool animated, ByteBuffer encoded_data, RefPtr<Platform::AnimationFrameDecoder> frame_decoder)
     : m_frames(move(frames))
     , m_loop_count(loop_count)
     , m_animated(animated)
+    , m_size(natural_size.is_empty() ? m_frames.first().bitmap->size() : natural_size)
+    , m_decoded_size(decoded_size_of_frames(m_frames))
+    , m_decoded_at_size(m_frames.first().bitmap->size())
+    , m_encoded_data(move(encoded_data))
+    , m_frame_decoder(move(frame_decoder))
 {
+    // NOTE: The frame decoder goes away along with us, so it can't call back into us once we're gone.
+    if (m_frame_decoder) {
+        m_frame_decoder->on_frames_decoded = [this](size_t start_frame_index, Vector<Platform::Frame>& frames) {
+            did_decode_lazy_frames(start_frame_index, frames);
+        };
+
+        // NOTE: We can't let go of the frame decoder while it's calling us.
+        m_frame_decoder->on_failure = [this] {
+            Platform::EventLoopPlugin::the().deferred_invoke(GC::create_function(heap(), [self = GC::Ref { *this }] {
+                self->did_fail_to_decode_lazy_frames();
+            }));
+        };
+    }
 }
 
 AnimatedBitmapDecodedImageData::~AnimatedBitmapDecodedImageData() = default;
 
-RefPtr<Gfx::ImmutableBitmap> AnimatedBitmapDecodedImageData::bitmap(size_t frame_index, Gfx::IntSize) const
+void AnimatedBitmapDecodedImageData::visit_edges(Cell::Visitor& visitor)
+{
+    Base::visit_edges(visitor);
+    visitor.visit(m_on_frames_decoded);
+    visitor.visit(m_on_frames_discarded);
+    for (auto& element : m_painting_elements)
+        visitor.visit(element);
+}
+
+void AnimatedBitmapDecodedImageData::finalize()
+{
+    Base::finalize();
+    DecodedImageCache::the().remove(*this);
+}
+
+RefPtr<Gfx::ImmutableBitmap> AnimatedBitmapDecodedImageData::bitmap(size_t frame_index, Gfx::IntSize size) const
 {
     if (frame_index >= m_frames.size())
         return nullptr;
+
+    // NOTE: Being asked for a bitmap is what keeps an image from being discarded, so the cache has to hear about it even
+    //       through this const getter.
+    auto& self = const_cast<AnimatedBitmapDecodedImageData&>(*this);
+    DecodedImageCache::the().did_use(self);
+
+    // Whoever asks for a bitmap this way (a canvas, createImageBitmap(), a CSS background, ...) isn't told when we enter or
+    // leave the viewport, so we hold on to our frames until the cache finds that they haven't asked again for a while.
+    self.m_was_used_outside_viewport = true;
+
+    // NOTE: When decoding frames lazily, we never discard the first one, so there is always a frame to hand out.
+    if (m_frame_decoder) {
+        self.redecode();
+        if (!is_decoded_at_least_at(self.did_request_size(size)))
+            self.redecode_at_larger_size();
+        return self.lazy_frame_bitmap(frame_index);
+    }
+
+    // If our frames were discarded, or decoded again at a smaller size than is wanted now, we start decoding them again
+    // and hand out what we have in the meantime. Whoever asked is painted again once we've been decoded.
+    // NOTE: This may be called while painting, so we must never wait for the image decoder here.
+    auto requested_size = self.did_request_size(size);
+    if (m_state != State::Decoded) {
+        self.redecode();
+        self.m_handed_out_incomplete_bitmap = true;
+        return nullptr;
+    }
+    if (is_decoded_at_least_at(requested_size))
+        return m_frames[frame_index].bitmap;
+
+    self.redecode_at_larger_size();
+    self.m_handed_out_incomplete_bitmap = true;
+
+    // NOTE: Callers that don't ask for a particular size work with the bitmap in terms of our natural size, e.g. to draw
+    //       parts of it onto a canvas, so they get our frame scaled up to that size until it has been decoded at it.
+    if (size.is_empty())
+        return self.frame_at_natural_size(frame_index);
+    return m_frames[frame_index].bitmap;
+}
+
+RefPtr<Gfx::ImmutableBitmap> AnimatedBitmapDecodedImageData::bitmap_if_decoded(size_t frame_index, Gfx::IntSize size) const
+{
+    if (frame_index >= m_frames.size())
+        return nullptr;
+
+    auto& self = const_cast<AnimatedBitmapDecodedImageData&>(*this);
+    DecodedImageCache::the().did_use(self);
+
+    // NOTE: The display list of a whole document is recorded at once, which paints images that are nowhere near the
+    //       viewport. Only decode what's missing for those that are in it; the others will be decoded once they are.
+    if (m_frame_decoder) {
+        if (!is_in_viewport())
+            return closest_decoded_frame(frame_index);
+        self.redecode();
+        if (!is_decoded_at_least_at(self.did_request_size(size)))
+            self.redecode_at_larger_size();
+        return self.lazy_frame_bitmap(frame_index);
+    }
+
+    auto requested_size = self.did_request_size(size);
+
+    // If our frames were discarded, paint nothing until they have been decoded again.
+    if (m_state != State::Decoded) {
+        if (is_in_viewport())
+            self.redecode();
+        return nullptr;
+    }
+
+    // Our frames may have been decoded at a smaller size than our own, if that's all we were displayed at. If we're now
+    // wanted at a larger size, keep showing what we have until we've been decoded at that size.
+    if (is_in_viewport()) {
+        if (!is_decoded_at_least_at(requested_size))
+            self.redecode_at_larger_size();
+        else
+            self.redecode_at_smaller_size_if_needed();
+    }
     return m_frames[frame_index].bitmap;
 }
 
@@ -43,17 +170,404 @@ int AnimatedBitmapDecodedImageData::frame_duration(size_t frame_index) const
 
 Optional<CSSPixels> AnimatedBitmapDecodedImageData::intrinsic_width() const
 {
-    return m_frames.first().bitmap->width();
+    return m_size.width();
 }
 
 Optional<CSSPixels> AnimatedBitmapDecodedImageData::intrinsic_height() const
 {
-    return m_frames.first().bitmap->height();
+    return m_size.height();
 }
 
 Optional<CSSPixelFraction> AnimatedBitmapDecodedImageData::intrinsic_aspect_ratio() const
 {
-    return CSSPixels(m_frames.first().bitmap->width()) / CSSPixels(m_frames.first().bitmap->height());
+    return CSSPixels(m_size.width()) / CSSPixels(m_size.height());
+}
+
+void AnimatedBitmapDecodedImageData::did_enter_viewport()
+{
+    ++m_viewport_user_count;
+    DecodedImageCache::the().did_use(*this);
+
+    // Start decoding discarded frames right away, rather than waiting for the image to be painted.
+    redecode();
+}
+
+void AnimatedBitmapDecodedImageData::did_leave_viewport()
+{
+    VERIFY(m_viewport_user_count > 0);
+    --m_viewport_user_count;
+}
+
+void AnimatedBitmapDecodedImageData::discard_decoded_frames()
+{
+    VERIFY(m_state == State::Decoded);
+
+    DecodedImageCache::the().did_discard(*this);
+
+    // NOTE: When decoding frames lazily, we keep the first one, which is what we show while waiting for the others anyway.
+    for (size_t i = m_frame_decoder ? 1 : 0; i < m_frames.size(); ++i)
+        m_frames[i].bitmap = nullptr;
+    m_frame_scaled_to_natural_size = {};
+    m_state = State::Discarded;
+
+    // NOTE: Whatever size we're decoded at again, we may find out that we could be smaller after all.
+    m_is_redecoding_at_smaller_size = false;
+
+    // NOTE: We may be discarded while another image is being painted, so don't have the display list invalidated under it.
+    queue_invoking_callback(m_on_frames_discarded);
+}
+
+void AnimatedBitmapDecodedImageData::redecode()
+{
+    if (m_state != State::Discarded)
+        return;
+
+    // NOTE: If our frames are decoded lazily, the image decoder still has the encoded image, so we can simply start asking
+    //       it for frames again.
+    if (m_frame_decoder) {
+        m_decoded_size = decoded_size_of_frames(m_frames);
+        m_state = State::Decoded;
+        DecodedImageCache::the().did_decode(*this);
+        request_missing_lazy_frames();
+        return;
+    }
+
+    m_state = State::Redecoding;
+
+    // There's no point in decoding the image at a larger size than it was displayed at before it got discarded.
+    Optional<Gfx::IntSize> ideal_size;
+    if (!m_largest_requested_size.is_empty() && m_largest_requested_size != m_size)
+        ideal_size = Gfx::size_to_decode_at(m_size, m_largest_requested_size);
+    m_largest_requested_size = {};
+
+    decode_again(ideal_size);
+}
+
+void AnimatedBitmapDecodedImageData::redecode_at_larger_size()
+{
+    if (m_is_redecoding_at_larger_size)
+        return;
+    m_is_redecoding_at_larger_size = true;
+
+    Optional<Gfx::IntSize> ideal_size;
+    if (m_largest_requested_size != m_size)
+        ideal_size = Gfx::size_to_decode_at(m_size, m_largest_requested_size);
+
+    decode_again(ideal_size);
+}
+
+void AnimatedBitmapDecodedImageData::redecode_at_smaller_size_if_needed()
+{
+    if (m_is_redecoding_at_smaller_size || m_is_redecoding_at_larger_size)
+        return;
+
+    // NOTE: Only bother if we'd take up no more than half as much memory, so that we're not decoded again every time our
+    //       size changes a little.
+    auto smaller_size = Gfx::size_to_decode_at(m_size, m_largest_requested_size);
+    if (smaller_size.area() * 2 > m_decoded_at_size.area())
+        return;
+
+    // NOTE: This is called while painting, and whoever else paints us in this frame may want us at a larger size, so we
+    //       only decide once everyone has had their say.
+    m_is_redecoding_at_smaller_size = true;
+    Platform::EventLoopPlugin::the().deferred_invoke(GC::create_function(heap(), [self = GC::Ref { *this }] {
+        self->redecode_at_smaller_size();
+    }));
+}
+
+void AnimatedBitmapDecodedImageData::redecode_at_smaller_size()
+{
+    auto smaller_size = Gfx::size_to_decode_at(m_size, m_largest_requested_size);
+    if (m_state != State::Decoded || m_is_redecoding_at_larger_size || smaller_size.area() * 2 > m_decoded_at_size.area()) {
+        m_is_redecoding_at_smaller_size = false;
+        return;
+    }
+
+    decode_again(smaller_size, true);
+}
+
+Gfx::IntSize AnimatedBitmapDecodedImageData::did_request_size(Gfx::IntSize size)
+{
+    auto requested_size = size.is_empty() ? m_size : Gfx::IntSize { min(size.width(), m_size.width()), min(size.height(), m_size.height()) };
+    m_largest_requested_size = {
+        max(m_largest_requested_size.width(), requested_size.width()),
+        max(m_largest_requested_size.height(), requested_size.height()),
+    };
+    return requested_size;
+}
+
+bool AnimatedBitmapDecodedImageData::is_decoded_at_least_at(Gfx::IntSize size) const
+{
+    return m_decoded_at_size.width() >= size.width() && m_decoded_at_size.height() >= size.height();
+}
+
+void AnimatedBitmapDecodedImageData::decode_again(Optional<Gfx::IntSize> ideal_size, bool at_smaller_size)
+{
+    auto on_resolved = [strong_this = GC::Root(*this), at_smaller_size](Platform::DecodedImage& result) -> ErrorOr<void> {
+        if (strong_this->did_redecode(result, at_smaller_size))
+            strong_this->did_invoke_on_frames_decoded();
+        return {};
+    };
+
+    auto on_rejected = [strong_this = GC::Root(*this)](Error& error) {
+        // NOTE: This decoded fine before, so there is no point in trying again. If we failed to decode at a larger or
+        //       smaller size, we leave m_is_redecoding_at_larger_size or m_is_redecoding_at_smaller_size set and keep
+        //       showing the frames we already have.
+        dbgln("Failed to decode image again: {}", error);
+        if (strong_this->m_state == State::Redecoding)
+            strong_this->m_state = State::RedecodeFailed;
+    };
+
+    (void)Platform::ImageCodecPlugin::the().decode_image(m_encoded_data.bytes(), move(on_resolved), move(on_rejected), ideal_size);
+}
+
+bool AnimatedBitmapDecodedImageData::did_redecode(Platform::DecodedImage& result, bool at_smaller_size)
+{
+    if (!at_smaller_size)
+        m_is_redecoding_at_larger_size = false;
+
+    // If our frames got discarded while we were decoding them at a larger size, we'll decode them again once needed.
+    bool was_discarded = m_state == State::Redecoding;
+    if (!was_discarded && m_state != State::Decoded)
+        return false;
+
+    if (result.frames.size() != m_frames.size()) {
+        dbgln("Image decoded again to {} frames instead of {}", result.frames.size(), m_frames.size());
+        if (was_discarded)
+            m_state = State::RedecodeFailed;
+        return false;
+    }
+
+    auto result_size = result.frames.first().bitmap->size();
+    if (!was_discarded) {
+        if (at_smaller_size) {
+            // NOTE: Not every image format can be decoded at a smaller size, in which case we leave
+            //       m_is_redecoding_at_smaller_size set, so that we don't keep trying.
+            if (result_size.area() >= m_decoded_at_size.area())
+                return false;
+            m_is_redecoding_at_smaller_size = false;
+
+            // NOTE: We may have been wanted at a larger size in the meantime.
+            if (result_size.width() < m_largest_requested_size.width() || result_size.height() < m_largest_requested_size.height())
+                return false;
+        } else if (is_decoded_at_least_at(result_size)) {
+            // NOTE: We may have been decoded at this size or a larger one in the meantime.
+            return false;
+        }
+    }
+
+    auto& cache = DecodedImageCache::the();
+    if (!was_discarded)
+        cache.did_discard(*this);
+
+    for (size_t i = 0; i < m_frames.size(); ++i)
+        m_frames[i].bitmap = Gfx::ImmutableBitmap::create(*result.frames[i].bitmap, Gfx::AlphaType::Premultiplied, result.color_space);
+    m_decoded_at_size = m_frames.first().bitmap->size();
+    m_decoded_size = decoded_size_of_frames(m_frames);
+    m_frame_scaled_to_natural_size = {};
+
+    // NOTE: If our frames were being decoded lazily, we now have all of them at the size we're wanted at, so we stop.
+    if (m_frame_decoder) {
+        m_frame_decoder = nullptr;
+        m_lazy_frame_request_in_flight = false;
+        m_lazy_frame_cursors.clear();
+    }
+
+    m_state = State::Decoded;
+    cache.did_decode(*this);
+    return true;
+}
+
+RefPtr<Gfx::ImmutableBitmap> AnimatedBitmapDecodedImageData::frame_at_natural_size(size_t frame_index)
+{
+    if (m_frame_scaled_to_natural_size.bitmap && m_frame_scaled_to_natural_size.frame_index == frame_index)
+        return m_frame_scaled_to_natural_size.bitmap;
+
+    auto const& frame = *m_frames[frame_index].bitmap;
+    auto scaled_frame = Gfx::Bitmap::create(Gfx::BitmapFormat::BGRA8888, Gfx::AlphaType::Premultiplied, m_size);
+    if (scaled_frame.is_error())
+        return m_frames[frame_index].bitmap;
+
+    auto painter = Gfx::Painter::create(scaled_frame.value());
+    painter->draw_bitmap(scaled_frame.value()->rect().to_type<float>(), frame, frame.rect(), Gfx::ScalingMode::BilinearBlend, {}, 1, Gfx::CompositingAndBlendingOperator::SourceOver);
+
+    m_frame_scaled_to_natural_size = { frame_index, Gfx::ImmutableBitmap::create(scaled_frame.release_value(), Gfx::AlphaType::Premultiplied) };
+    return m_frame_scaled_to_natural_size.bitmap;
+}
+
+bool AnimatedBitmapDecodedImageData::take_handed_out_incomplete_bitmap()
+{
+    return exchange(m_handed_out_incomplete_bitmap, false);
+}
+
+void AnimatedBitmapDecodedImageData::did_start_being_painted_by(DOM::Element& element)
+{
+    m_painting_elements.set(element);
+}
+
+void AnimatedBitmapDecodedImageData::did_stop_being_painted_by(DOM::Element& element)
+{
+    m_painting_elements.remove(element);
+}
+
+void AnimatedBitmapDecodedImageData::did_invoke_on_frames_decoded()
+{
+    if (m_on_frames_decoded)
+        m_on_frames_decoded->function()();
+}
+
+void AnimatedBitmapDecodedImageData::queue_invoking_callback(GC::Ptr<GC::Function<void()>> callback)
+{
+    if (!callback)
+        return;
+    Platform::EventLoopPlugin::the().deferred_invoke(GC::create_function(heap(), [callback = GC::Ref { *callback }] {
+        callback->function()();
+    }));
+}
+
+size_t AnimatedBitmapDecodedImageData::distance_between_frames(size_t from_frame_index, size_t to_frame_index) const
+{
+    return (to_frame_index + m_frames.size() - from_frame_index) % m_frames.size();
+}
+
+void AnimatedBitmapDecodedImageData::did_request_lazy_frame(size_t frame_index)
+{
+    auto now = MonotonicTime::now_coarse();
+    m_lazy_frame_cursors.remove_all_matching([&](auto const& cursor) {
+        return now - cursor.last_used > lazy_frame_cursor_lifetime;
+    });
+
+    // NOTE: Whoever shows us moves forward through our frames, so a frame shortly after a cursor moves the closest such
+    //       cursor along to it, rather than starting a new one.
+    LazyFrameCursor* closest_cursor = nullptr;
+    for (auto& cursor : m_lazy_frame_cursors) {
+        auto distance = distance_between_frames(cursor.frame_index, frame_index);
+        if (distance < lazy_frame_window_size && (!closest_cursor || distance < distance_between_frames(closest_cursor->frame_index, frame_index)))
+            closest_cursor = &cursor;
+    }
+    if (closest_cursor) {
+        *closest_cursor = { frame_index, now };
+        return;
+    }
+
+    if (m_lazy_frame_cursors.size() == max_lazy_frame_cursors) {
+        size_t least_recently_used = 0;
+        for (size_t i = 1; i < m_lazy_frame_cursors.size(); ++i) {
+            if (m_lazy_frame_cursors[i].last_used < m_lazy_frame_cursors[least_recently_used].last_used)
+                least_recently_used = i;
+        }
+        m_lazy_frame_cursors.remove(least_recently_used);
+    }
+    m_lazy_frame_cursors.append({ frame_index, now });
+}
+
+bool AnimatedBitmapDecodedImageData::is_in_lazy_frame_window(size_t frame_index) const
+{
+    return any_of(m_lazy_frame_cursors, [&](auto const& cursor) {
+        return distance_between_frames(cursor.frame_index, frame_index) < lazy_frame_window_size;
+    });
+}
+
+void AnimatedBitmapDecodedImageData::request_missing_lazy_frames()
+{
+    VERIFY(m_frame_decoder);
+    if (m_lazy_frame_request_in_flight)
+        return;
+
+    auto window_size = min(lazy_frame_window_size, m_frames.size());
+    for (auto const& cursor : m_lazy_frame_cursors) {
+        for (size_t offset = 0; offset < window_size; ++offset) {
+            auto start_frame_index = (cursor.frame_index + offset) % m_frames.size();
+            if (m_frames[start_frame_index].bitmap)
+                continue;
+
+            // NOTE: The decoder can't wrap around to the first frame, so a window that does is filled in two requests.
+            auto count = min(window_size - offset, m_frames.size() - start_frame_index);
+            m_lazy_frame_request_in_flight = true;
+            m_frame_decoder->request_frames(start_frame_index, count);
+            return;
+        }
+    }
+}
+
+void AnimatedBitmapDecodedImageData::did_decode_lazy_frames(size_t start_frame_index, Vector<Platform::Frame>& frames)
+{
+    m_lazy_frame_request_in_flight = false;
+
+    // If our frames were discarded in the meantime, we'll ask for these again once they're needed.
+    if (m_state != State::Decoded)
+        return;
+
+    auto& cache = DecodedImageCache::the();
+    cache.did_discard(*this);
+
+    for (size_t i = 0; i < frames.size() && start_frame_index + i < m_frames.size(); ++i) {
+        auto frame_index = start_frame_index + i;
+        auto& frame = m_frames[frame_index];
+        frame.duration = static_cast<int>(frames[i].duration);
+
+        // NOTE: Show the previous frame in place of one that failed to decode, so that we don't keep asking for it.
+        if (frames[i].bitmap)
+            frame.bitmap = Gfx::ImmutableBitmap::create(*frames[i].bitmap, Gfx::AlphaType::Premultiplied, m_frame_decoder->color_space);
+        else if (frame_index > 0)
+            frame.bitmap = m_frames[frame_index - 1].bitmap;
+    }
+
+    // Drop the frames we've moved past, except for the first one, which is what we show while we wait for others.
+    for (size_t i = 1; i < m_frames.size(); ++i) {
+        if (!is_in_lazy_frame_window(i))
+            m_frames[i].bitmap = nullptr;
+    }
+
+    m_decoded_size = decoded_size_of_frames(m_frames);
+    cache.did_decode(*this);
+
+    request_missing_lazy_frames();
+    did_invoke_on_frames_decoded();
+}
+
+void AnimatedBitmapDecodedImageData::did_fail_to_decode_lazy_frames()
+{
+    if (!m_frame_decoder)
+        return;
+
+    // The image decoder has forgotten our image, so decode all of its frames from our encoded data instead.
+    dbgln("Failed to decode animation frames lazily, decoding all of them instead");
+    m_lazy_frame_request_in_flight = false;
+    m_frame_decoder = nullptr;
+
+    if (m_state == State::Decoded)
+        DecodedImageCache::the().did_discard(*this);
+    for (auto& frame : m_frames)
+        frame.bitmap = nullptr;
+    m_state = State::Discarded;
+
+    // NOTE: Our frames may never have been decoded at anything but our natural size.
+    m_largest_requested_size = {};
+    if (is_in_viewport() || m_was_used_outside_viewport)
+        redecode();
+
+    if (m_on_frames_discarded)
+        m_on_frames_discarded->function()();
+}
+
+RefPtr<Gfx::ImmutableBitmap> AnimatedBitmapDecodedImageData::lazy_frame_bitmap(size_t frame_index)
+{
+    if (m_state == State::Decoded) {
+        did_request_lazy_frame(frame_index);
+        request_missing_lazy_frames();
+    }
+    return closest_decoded_frame(frame_index);
+}
+
+RefPtr<Gfx::ImmutableBitmap> AnimatedBitmapDecodedImageData::closest_decoded_frame(size_t frame_index) const
+{
+    // If this frame hasn't been decoded yet, show the closest one before it that has, rather than nothing at all.
+    for (size_t i = frame_index + 1; i > 0; --i) {
+        if (m_frames[i - 1].bitmap)
+            return m_frames[i - 1].bitmap;
+    }
+    return nullptr;
 }
 
 }
@@ -6,8 +6,14 @@
 
 #pragma once
 
+#include <AK/ByteBuffer.h>
+#include <AK/HashTable.h>
+#include <AK/IntrusiveList.h>
+#include <AK/Time.h>
+#include <LibGC/Function.h>
 #include <LibGfx/ImmutableBitmap.h>
 #include <LibWeb/HTML/DecodedImageData.h>
+#include <LibWeb/Platform/ImageCodecPlugin.h>
 
 namespace Web::HTML {
 
@@ -21,10 +27,14 @@ public:
         int duration { 0 };
     };
 
-    static ErrorOr<GC::Ref<AnimatedBitmapDecodedImageData>> create(JS::Realm&, Vector<Frame>&&, size_t loop_count, bool animated);
+    // If a frame decoder is given, only some of the frames have been decoded, and the rest are decoded as they're needed.
+    // Frames that have not been decoded yet have a null bitmap. The frames may have been decoded at a smaller size than
+    // the natural size of the image, and are decoded again at a larger size once they are wanted at one.
+    static ErrorOr<GC::Ref<AnimatedBitmapDecodedImageData>> create(JS::Realm&, Vector<Frame>&&, Gfx::IntSize natural_size, size_t loop_count, bool animated, ByteBuffer encoded_data, RefPtr<Platform::AnimationFrameDecoder> = {});
     virtual ~AnimatedBitmapDecodedImageData() override;
 
     virtual RefPtr<Gfx::ImmutableBitmap> bitmap(size_t frame_index, Gfx::IntSize = {}) const override;
+    virtual RefPtr<Gfx::ImmutableBitmap> bitmap_if_decoded(size_t frame_index, Gfx::IntSize = {}) const override;
     virtual int frame_duration(size_t frame_index) const override;
 
     virtual size_t frame_count() const override { return m_frames.size(); }
@@ -35,12 +45,139 @@ public:
     virtual Optional<CSSPixels> intrinsic_height() const override;
     virtual Optional<CSSPixelFraction> intrinsic_aspect_ratio() const override;
 
+    virtual void did_enter_viewport() override;
+    virtual void did_leave_viewport() override;
+
+    virtual void did_start_being_painted_by(DOM::Element&) override;
+    virtual void did_stop_being_painted_by(DOM::Element&) override;
+
+    template<typename Callback>
+    void for_each_painting_element(Callback callback) const
+    {
+        for (auto& element : m_painting_elements)
+            callback(*element);
+    }
+
+    // Returns whether bitmap() handed out less than it was asked for since this was last called, in which case whoever it
+    // handed that out to has to be painted again once our frames have been decoded.
+    bool take_handed_out_incomplete_bitmap();
+
+    // Invoked once frames that were missing have been decoded, either again after being discarded or for the first time,
+    // so that the image can be repainted.
+    void set_on_frames_decoded(GC::Ptr<GC::Function<void()>> on_frames_decoded) { m_on_frames_decoded = on_frames_decoded; }
+
+    // Invoked once our frames have been discarded, so that whatever was painted with them can let go of them.
+    void set_on_frames_discarded(GC::Ptr<GC::Function<void()>> on_frames_discarded) { m_on_frames_discarded = on_frames_discarded; }
+
+    bool is_decoded() const { return m_state == State::Decoded; }
+    bool is_in_viewport() const { return m_viewport_user_count > 0; }
+
+    // The number of bytes taken up by the decoded frames, whether or not they are currently discarded. For images whose
+    // frames are decoded lazily, this only counts the frames that are currently decoded.
+    size_t decoded_size() const { return m_decoded_size; }
+
 private:
-    AnimatedBitmapDecodedImageData(Vector<Frame>&&, size_t loop_count, bool animated);
+    friend class DecodedImageCache;
+
+    enum class State : u8 {
+        Decoded,
+        Discarded,
+        Redecoding,
+        RedecodeFailed,
+    };
+
+    AnimatedBitmapDecodedImageData(Vector<Frame>&&, Gfx::IntSize natural_size, size_t loop_count, bool animated, ByteBuffer encoded_data, RefPtr<Platform::AnimationFrameDecoder>);
+
+    virtual void visit_edges(Cell::Visitor&) override;
+    virtual void finalize() override;
+
+    void discard_decoded_frames();
+    void redecode();
+    void redecode_at_larger_size();
+    void redecode_at_smaller_size_if_needed();
+    void redecode_at_smaller_size();
+    void decode_again(Optional<Gfx::IntSize> ideal_size, bool at_smaller_size = false);
+    RefPtr<Gfx::ImmutableBitmap> frame_at_natural_size(size_t frame_index);
+    bool did_redecode(Platform::DecodedImage&, bool at_smaller_size);
+    Gfx::IntSize did_request_size(Gfx::IntSize);
+    bool is_decoded_at_least_at(Gfx::IntSize) const;
+    void did_invoke_on_frames_decoded();
+    void queue_invoking_callback(GC::Ptr<GC::Function<void()>>);
+
+    // The number of frames after each frame that's being shown, itself included, that we keep decoded when decoding frames
+    // lazily.
+    static constexpr size_t lazy_frame_window_size = 8;
+
+    // Everyone showing us may be at a different frame, so we keep a window of frames after each of those that have been
+    // asked for recently. Windows that aren't moved along for a while are dropped, and so is the least recently used one
+    // if there are too many.
+    struct LazyFrameCursor {
+        size_t frame_index { 0 };
+        MonotonicTime last_used;
+    };
+    static constexpr size_t max_lazy_frame_cursors = 4;
+    static constexpr AK::Duration lazy_frame_cursor_lifetime = AK::Duration::from_seconds(1);
+
+    size_t distance_between_frames(size_t from_frame_index, size_t to_frame_index) const;
+    void did_request_lazy_frame(size_t frame_index);
+    bool is_in_lazy_frame_window(size_t frame_index) const;
+    void request_missing_lazy_frames();
+    void did_decode_lazy_frames(size_t start_frame_index, Vector<Platform::Frame>&);
+    void did_fail_to_decode_lazy_frames();
+    RefPtr<Gfx::ImmutableBitmap> lazy_frame_bitmap(size_t frame_index);
+    RefPtr<Gfx::ImmutableBitmap> closest_decoded_frame(size_t frame_index) const;
 
     Vector<Frame> m_frames;
     size_t m_loop_count { 0 };
     bool m_animated { false };
+
+    Gfx::IntSize m_size;
+    size_t m_decoded_size { 0 };
+
+    // The size our frames are currently decoded at, which may be smaller than our natural size if we knew how large we
+    // would be displayed when we were decoded, or if they were decoded again after being discarded.
+    Gfx::IntSize m_decoded_at_size;
+
+    // The largest size we've been asked for a bitmap at since we were last decoded.
+    Gfx::IntSize m_largest_requested_size;
+    bool m_is_redecoding_at_larger_size { false };
+
+    // If we turn out to be displayed at a much smaller size than we were decoded at, e.g. because layout hadn't happened
+    // yet when we were first decoded, we're decoded again at that smaller size.
+    bool m_is_redecoding_at_smaller_size { false };
+
+    // A frame that has been decoded at a smaller size than our own, scaled up to our natural size for whoever needs it at
+    // that size before we've been decoded again.
+    struct ScaledFrame {
+        size_t frame_index { 0 };
+        RefPtr<Gfx::ImmutableBitmap> bitmap;
+    };
+    ScaledFrame m_frame_scaled_to_natural_size;
+    bool m_handed_out_incomplete_bitmap { false };
+
+    ByteBuffer m_encoded_data;
+    State m_state { State::Decoded };
+    GC::Ptr<GC::Function<void()>> m_on_frames_decoded;
+    GC::Ptr<GC::Function<void()>> m_on_frames_discarded;
+
+    RefPtr<Platform::AnimationFrameDecoder> m_frame_decoder;
+    Vector<LazyFrameCursor, max_lazy_frame_cursors> m_lazy_frame_cursors;
+    bool m_lazy_frame_request_in_flight { false };
+
+    size_t m_viewport_user_count { 0 };
+
+    // Set whenever someone who isn't told when we enter or leave the viewport reads our frames. The cache clears this each
+    // time it looks for idle images to discard, and only discards our frames once they haven't been read in between.
+    bool m_was_used_outside_viewport { false };
+
+    // The elements that paint us with bitmap_if_decoded(), and have to be painted again when our frames change.
+    HashTable<GC::Ref<DOM::Element>> m_painting_elements;
+
+    MonotonicTime m_last_used { MonotonicTime::now_coarse() };
+    IntrusiveListNode<AnimatedBitmapDecodedImageData> m_decoded_image_cache_list_node;
+
+public:
+    using DecodedImageCacheList = IntrusiveList<&AnimatedBitmapDecodedImageData::m_decoded_image_cache_list_node>;
 };
 
 }
@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibCore/Timer.h>
+#include <LibWeb/HTML/DecodedImageCache.h>
+
+namespace Web::HTML {
+
+DecodedImageCache& DecodedImageCache::the()
+{
+    static DecodedImageCache cache;
+    return cache;
+}
+
+DecodedImageCache::DecodedImageCache()
+    : m_retry_timer(Core::Timer::create_single_shot(static_cast<int>(minimum_idle_time.to_milliseconds()), [this] {
+        discard_unused_images(m_budget, minimum_idle_time, IsIdleSweep::Yes);
+    }))
+{
+}
+
+void DecodedImageCache::set_budget(size_t budget)
+{
+    m_budget = budget;
+    discard_until_within_budget();
+}
+
+void DecodedImageCache::did_decode(AnimatedBitmapDecodedImageData& image)
+{
+    m_decoded_size += image.decoded_size();
+    image.m_last_used = MonotonicTime::now_coarse();
+    m_images.append(image);
+    discard_until_within_budget();
+}
+
+void DecodedImageCache::did_discard(AnimatedBitmapDecodedImageData& image)
+{
+    VERIFY(m_decoded_size >= image.decoded_size());
+    m_decoded_size -= image.decoded_size();
+}
+
+void DecodedImageCache::did_use(AnimatedBitmapDecodedImageData& image)
+{
+    image.m_last_used = MonotonicTime::now_coarse();
+    if (m_images.last() != &image)
+        m_images.append(image);
+}
+
+void DecodedImageCache::remove(AnimatedBitmapDecodedImageData& image)
+{
+    if (image.is_decoded())
+        did_discard(image);
+    m_images.remove(image);
+}
+
+void DecodedImageCache::discard_until_within_budget()
+{
+    discard_unused_images(m_budget, minimum_idle_time, IsIdleSweep::No);
+}
+
+void DecodedImageCache::discard_all_unused_images()
+{
+    discard_unused_images(0, {}, IsIdleSweep::Yes);
+}
+
+void DecodedImageCache::discard_unused_images(size_t budget, AK::Duration idle_time, IsIdleSweep is_idle_sweep)
+{
+    if (m_decoded_size <= budget)
+        return;
+
+    auto now = MonotonicTime::now_coarse();
+    bool skipped_recently_used_image = false;
+
+    for (auto& image : m_images) {
+        if (m_decoded_size <= budget)
+            return;
+        if (!image.is_decoded() || image.is_in_viewport())
+            continue;
+
+        // NOTE: Images read by someone who isn't told about the viewport are only discarded once an idle sweep finds that
+        //       they haven't been read since the one before it.
+        if (image.m_was_used_outside_viewport) {
+            if (is_idle_sweep == IsIdleSweep::Yes)
+                image.m_was_used_outside_viewport = false;
+            skipped_recently_used_image = true;
+            continue;
+        }
+        if (now - image.m_last_used < idle_time) {
+            skipped_recently_used_image = true;
+            continue;
+        }
+        image.discard_decoded_frames();
+    }
+
+    // NOTE: Images that were used too recently to be discarded now may be idle a little while later, so try again then.
+    if (m_decoded_size > m_budget && skipped_recently_used_image && !m_retry_timer->is_active())
+        m_retry_timer->start();
+}
+
+}
@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Noncopyable.h>
+#include <AK/Time.h>
+#include <LibCore/Forward.h>
+#include <LibWeb/Export.h>
+#include <LibWeb/HTML/AnimatedBitmapDecodedImageData.h>
+
+namespace Web::HTML {
+
+// Keeps the memory taken up by decoded image frames in this process within a budget. Once the budget is exceeded, the
+// frames of the least recently used images that are neither in a viewport nor were painted recently are discarded.
+// Those images hold on to their encoded data, and decode it again when they are needed. Images that are read by someone
+// who isn't told about the viewport are only discarded once they haven't been read between two idle sweeps, which run
+// while we're over budget.
+class WEB_API DecodedImageCache {
+    AK_MAKE_NONCOPYABLE(DecodedImageCache);
+    AK_MAKE_NONMOVABLE(DecodedImageCache);
+
+public:
+    static DecodedImageCache& the();
+
+    static constexpr size_t default_budget = 256 * MiB;
+
+    size_t budget() const { return m_budget; }
+    void set_budget(size_t);
+
+    size_t decoded_size() const { return m_decoded_size; }
+
+    void did_decode(AnimatedBitmapDecodedImageData&);
+    void did_discard(AnimatedBitmapDecodedImageData&);
+    void did_use(AnimatedBitmapDecodedImageData&);
+    void remove(AnimatedBitmapDecodedImageData&);
+
+    // Runs an idle sweep regardless of the budget and of how recently images were painted. This is for testing.
+    void discard_all_unused_images();
+
+private:
+    DecodedImageCache();
+
+    enum class IsIdleSweep : u8 {
+        No,
+        Yes,
+    };
+
+    void discard_until_within_budget();
+    void discard_unused_images(size_t budget, AK::Duration idle_time, IsIdleSweep);
+
+    // Images that have been used within this long are not considered for discarding, even when outside any viewport.
+    static constexpr AK::Duration minimum_idle_time = AK::Duration::from_seconds(3);
+
+    size_t m_budget { default_budget };
+    size_t m_decoded_size { 0 };
+
+    // Ordered from least to most recently used.
+    AnimatedBitmapDecodedImageData::DecodedImageCacheList m_images;
+
+    RefPtr<Core::Timer> m_retry_timer;
+};
+
+}
@@ -9,6 +9,7 @@
 #include <AK/RefCounted.h>
 #include <LibGfx/Size.h>
 #include <LibJS/Heap/Cell.h>
+#include <LibWeb/Forward.h>
 #include <LibWeb/PixelUnits.h>
 
 namespace Web::HTML {
@@ -20,7 +21,14 @@ class DecodedImageData : public JS::Cell {
 public:
     virtual ~DecodedImageData();
 
+    // Returns a bitmap that covers the given size, or one at our natural size if no size is given. Images that have been
+    // decoded at a smaller size, or whose frames have been discarded, start decoding again and return what they have in
+    // the meantime, which may be nothing at all. The document is painted again once they have been decoded.
     virtual RefPtr<Gfx::ImmutableBitmap> bitmap(size_t frame_index, Gfx::IntSize = {}) const = 0;
+
+    // Like bitmap(), but only decodes missing frames again while we're in the viewport. This is only for painting an
+    // element that tells us when it enters and leaves the viewport, and that it paints us.
+    virtual RefPtr<Gfx::ImmutableBitmap> bitmap_if_decoded(size_t frame_index, Gfx::IntSize size = {}) const { return bitmap(frame_index, size); }
     virtual int frame_duration(size_t frame_index) const = 0;
 
     virtual size_t frame_count() const = 0;
@@ -31,6 +39,16 @@ public:
     virtual Optional<CSSPixels> intrinsic_height() const = 0;
     virtual Optional<CSSPixelFraction> intrinsic_aspect_ratio() const = 0;
 
+    // Called when an element displaying this image enters or leaves the viewport. An image that isn't in any viewport may
+    // discard its decoded data to save memory.
+    virtual void did_enter_viewport() { }
+    virtual void did_leave_viewport() { }
+
+    // Called when an element starts or stops painting this image with bitmap_if_decoded(). Such elements are painted again
+    // whenever that would give them something else.
+    virtual void did_start_being_painted_by(DOM::Element&) { }
+    virtual void did_stop_being_painted_by(DOM::Element&) { }
+
 protected:
     DecodedImageData();
 };
@@ -27,6 +27,7 @@
 #include <LibWeb/Painting/ViewportPaintable.h>
 #include <LibWeb/Platform/EventLoopPlugin.h>
 #include <LibWeb/Platform/Timer.h>
+#include <LibWeb/PrioritizedTaskScheduling/Scheduler.h>
 
 namespace Web::HTML {
 
@@ -54,6 +55,7 @@ void EventLoop::visit_edges(Visitor& visitor)
     visitor.visit(m_backup_incumbent_realm_stack);
     visitor.visit(m_rendering_task_function);
     visitor.visit(m_system_event_loop_timer);
+    visitor.visit(m_current_scheduling_state);
 }
 
 void EventLoop::schedule()
@@ -129,9 +131,7 @@ void EventLoop::spin_processing_tasks_with_source_until(Task::Source source, GC:
         if (goal_condition->function()())
             return true;
         if (m_task_queue->has_runnable_tasks()) {
-            auto tasks = m_task_queue->take_tasks_matching([&](auto& task) {
-                return task.source() == source && task.is_runnable();
-            });
+            auto tasks = m_task_queue->take_runnable_tasks_with_source(source);
 
             for (auto& task : tasks) {
                 m_currently_running_task = task.ptr();
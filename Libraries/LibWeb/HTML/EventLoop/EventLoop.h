@@ -93,6 +93,9 @@ public:
 
     bool running_rendering_task() const { return m_running_rendering_task; }
 
+    GC::Ptr<PrioritizedTaskScheduling::SchedulingState> current_scheduling_state() const { return m_current_scheduling_state; }
+    void set_current_scheduling_state(GC::Ptr<PrioritizedTaskScheduling::SchedulingState> state) { m_current_scheduling_state = state; }
+
 private:
     explicit EventLoop(Type);
 
@@ -139,6 +142,9 @@ private:
     bool m_running_rendering_task { false };
 
     GC::Ptr<GC::Function<void()>> m_rendering_task_function;
+
+    // https://wicg.github.io/scheduling-apis/#event-loop-current-scheduling-state
+    GC::Ptr<PrioritizedTaskScheduling::SchedulingState> m_current_scheduling_state;
 };
 
 WEB_API EventLoop& main_thread_event_loop();
@@ -25,9 +25,24 @@ GC::Ref<Task> Task::create(JS::VM& vm, Source source, GC::Ptr<DOM::Document cons
     return vm.heap().allocate<Task>(source, document, move(steps));
 }
 
+static Task::Priority default_priority_for_source(Task::Source source)
+{
+    switch (source) {
+    case Task::Source::UserInteraction:
+        return Task::Priority::UserInput;
+    case Task::Source::Rendering:
+        return Task::Priority::Rendering;
+    case Task::Source::IdleTask:
+        return Task::Priority::Idle;
+    default:
+        return Task::Priority::Normal;
+    }
+}
+
 Task::Task(Source source, GC::Ptr<DOM::Document const> document, GC::Ref<GC::Function<void()>> steps)
     : m_id(allocate_task_id())
     , m_source(source)
+    , m_priority(default_priority_for_source(source))
     , m_steps(steps)
     , m_document(document)
 {
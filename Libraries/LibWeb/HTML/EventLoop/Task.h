@@ -84,12 +84,29 @@ public:
         // https://w3c.github.io/gamepad/#dfn-gamepad-task-source
         Gamepad,
 
+        // https://w3c.github.io/webcrypto/#dfn-crypto-task-source
+        Crypto,
+
+        // https://wicg.github.io/scheduling-apis/#posted-task-task-source
+        PostedTask,
+
         // !!! IMPORTANT: Keep this field last!
         // This serves as the base value of all unique task sources.
         // Some elements, such as the HTMLMediaElement, must have a unique task source per instance.
         UniqueTaskSourceStart
     };
 
+    // When there are runnable tasks in several task queues, the event loop takes one from the queue with the highest
+    // priority, and the oldest one among those with the same priority.
+    enum class Priority : u8 {
+        Idle,
+        Background,
+        Normal,
+        UserBlocking,
+        Rendering,
+        UserInput,
+    };
+
     static GC::Ref<Task> create(JS::VM&, Source, GC::Ptr<DOM::Document const>, GC::Ref<GC::Function<void()>> steps);
 
     virtual ~Task() override;
@@ -98,6 +115,9 @@ public:
     Source source() const { return m_source; }
     void execute();
 
+    Priority priority() const { return m_priority; }
+    void set_priority(Priority priority) { m_priority = priority; }
+
     DOM::Document const* document() const;
 
     bool is_runnable() const;
@@ -109,6 +129,7 @@ private:
 
     TaskID m_id {};
     Source m_source { Source::Unspecified };
+    Priority m_priority { Priority::Normal };
     GC::Ref<GC::Function<void()>> m_steps;
     GC::Ptr<DOM::Document const> m_document;
 };
@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/QuickSort.h>
 #include <LibGC/RootVector.h>
 #include <LibWeb/HTML/EventLoop/EventLoop.h>
 #include <LibWeb/HTML/EventLoop/TaskQueue.h>
@@ -23,27 +24,93 @@ void TaskQueue::visit_edges(Visitor& visitor)
 {
     Base::visit_edges(visitor);
     visitor.visit(m_event_loop);
-    visitor.visit(m_tasks);
+    for (auto& it : m_queues)
+        it.value->visit_edges(visitor);
+    visitor.visit(m_last_added_task);
+}
+
+GC::Ref<Task> TaskQueue::SourceQueue::take_first()
+{
+    auto task = m_tasks[m_head++];
+    if (is_empty()) {
+        m_tasks.clear_with_capacity();
+        m_head = 0;
+    } else if (m_head >= 64 && m_head >= m_tasks.size() / 2) {
+        m_tasks.remove(0, m_head);
+        m_head = 0;
+    }
+    return task;
+}
+
+void TaskQueue::SourceQueue::remove_all_matching(Function<bool(GC::Ref<Task> const&)> filter)
+{
+    m_tasks.remove(0, m_head);
+    m_head = 0;
+    m_tasks.remove_all_matching(filter);
+}
+
+void TaskQueue::SourceQueue::visit_edges(Visitor& visitor)
+{
+    for (size_t i = m_head; i < m_tasks.size(); ++i)
+        visitor.visit(m_tasks[i]);
 }
 
 void TaskQueue::add(GC::Ref<Task> task)
 {
-    m_tasks.append(task);
+    // NOTE: Microtasks always run in the order they were queued in, whichever document they are for.
+    auto const* document = task->source() == Task::Source::Microtask ? nullptr : task->document();
+
+    auto& queue = m_queues.ensure({ task->source(), document, task->priority() }, [&] {
+        return make<SourceQueue>(task->priority());
+    });
+    queue->append(task);
+    m_last_added_task = task;
     m_event_loop->schedule();
 }
 
+bool TaskQueue::can_take_from(Task::Source source, SourceQueue const& queue) const
+{
+    if (m_event_loop->running_rendering_task() && source == Task::Source::Rendering)
+        return false;
+    return queue.is_runnable();
+}
+
 GC::Ptr<Task> TaskQueue::take_first_runnable()
 {
     if (m_event_loop->execution_paused())
         return nullptr;
 
-    for (size_t i = 0; i < m_tasks.size(); ++i) {
-        if (m_event_loop->running_rendering_task() && m_tasks[i]->source() == Task::Source::Rendering)
+    SourceQueue* chosen_queue = nullptr;
+    for (auto& [key, queue] : m_queues) {
+        if (!can_take_from(key.source, *queue))
+            continue;
+        if (chosen_queue && (queue->priority() < chosen_queue->priority() || (queue->priority() == chosen_queue->priority() && queue->first().id() > chosen_queue->first().id())))
             continue;
-        if (m_tasks[i]->is_runnable())
-            return m_tasks.take(i);
+        chosen_queue = queue.ptr();
+    }
+    if (!chosen_queue)
+        return nullptr;
+
+    auto task = chosen_queue->take_first();
+    if (chosen_queue->is_empty())
+        remove_empty_queues();
+    return task;
+}
+
+GC::Ptr<Task> TaskQueue::dequeue()
+{
+    SourceQueue* oldest_queue = nullptr;
+    for (auto& it : m_queues) {
+        if (!oldest_queue || it.value->first().id() < oldest_queue->first().id())
+            oldest_queue = it.value.ptr();
     }
-    return nullptr;
+    if (!oldest_queue)
+        return {};
+
+    auto task = oldest_queue->take_first();
+    if (oldest_queue->is_empty())
+        remove_empty_queues();
+    return task;
 }
 
 bool TaskQueue::has_runnable_tasks() const
@@ -51,51 +118,70 @@ bool TaskQueue::has_runnable_tasks() const
     if (m_event_loop->execution_paused())
         return false;
 
-    for (auto& task : m_tasks) {
-        if (m_event_loop->running_rendering_task() && task->source() == Task::Source::Rendering)
-            continue;
-        if (task->is_runnable())
+    for (auto const& [key, queue] : m_queues) {
+        if (can_take_from(key.source, *queue))
             return true;
     }
     return false;
 }
 
-void TaskQueue::remove_tasks_matching(Function<bool(HTML::Task const&)> filter)
+void TaskQueue::remove_empty_queues()
 {
-    m_tasks.remove_all_matching([&](auto& task) {
-        return filter(*task);
+    m_queues.remove_all_matching([](auto const&, auto const& queue) {
+        return queue->is_empty();
     });
 }
 
+void TaskQueue::remove_tasks_matching(Function<bool(HTML::Task const&)> filter)
+{
+    for (auto& it : m_queues) {
+        it.value->remove_all_matching([&](auto const& task) {
+            if (!filter(*task))
+                return false;
+            if (task == m_last_added_task)
+                m_last_added_task = nullptr;
+            return true;
+        });
+    }
+    remove_empty_queues();
+}
+
 GC::RootVector<GC::Ref<Task>> TaskQueue::take_tasks_matching(Function<bool(HTML::Task const&)> filter)
 {
     GC::RootVector<GC::Ref<Task>> matching_tasks(heap());
 
-    for (size_t i = 0; i < m_tasks.size();) {
-        auto& task = m_tasks.at(i);
-
-        if (filter(*task)) {
-            matching_tasks.append(task);
-            m_tasks.remove(i);
-        } else {
-            ++i;
-        }
-    }
+    remove_tasks_matching([&](auto const& task) {
+        if (!filter(task))
+            return false;
+        matching_tasks.append(const_cast<Task&>(task));
+        return true;
+    });
 
+    // NOTE: The tasks were collected queue by queue, but have to be returned in the order they were added in.
+    quick_sort(matching_tasks, [](auto const& a, auto const& b) { return a->id() < b->id(); });
     return matching_tasks;
 }
 
-Task const* TaskQueue::last_added_task() const
+GC::RootVector<GC::Ref<Task>> TaskQueue::take_runnable_tasks_with_source(Task::Source source)
 {
-    if (m_tasks.is_empty())
-        return nullptr;
-    return m_tasks.last();
+    GC::RootVector<GC::Ref<Task>> tasks(heap());
+
+    for (auto& [key, queue] : m_queues) {
+        if (key.source != source || !queue->is_runnable())
+            continue;
+        while (!queue->is_empty())
+            tasks.append(queue->take_first());
+    }
+    remove_empty_queues();
+
+    quick_sort(tasks, [](auto const& a, auto const& b) { return a->id() < b->id(); });
+    return tasks;
 }
 
 bool TaskQueue::has_rendering_tasks() const
 {
-    for (auto const& task : m_tasks) {
-        if (task->source() == Task::Source::Rendering)
+    for (auto const& it : m_queues) {
+        if (it.key.source == Task::Source::Rendering)
             return true;
     }
     return false;
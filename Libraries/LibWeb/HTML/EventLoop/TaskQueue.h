@@ -6,12 +6,18 @@
 
 #pragma once
 
+#include <AK/HashMap.h>
+#include <AK/NonnullOwnPtr.h>
 #include <AK/Queue.h>
 #include <LibJS/Heap/Cell.h>
 #include <LibWeb/HTML/EventLoop/Task.h>
 
 namespace Web::HTML {
 
+// NOTE: Tasks from the same source for the same document have to run in the order they were added in, but the event loop
+//       may choose freely between those from different sources or documents. So each such combination gets a queue of
+//       its own, and the event loop takes the oldest task from whichever runnable queue has the highest priority. That
+//       way, taking a task only depends on how many of those queues there are, rather than on how many tasks there are.
 class TaskQueue : public JS::Cell {
     GC_CELL(TaskQueue, JS::Cell);
     GC_DECLARE_ALLOCATOR(TaskQueue);
@@ -20,7 +26,7 @@ public:
     explicit TaskQueue(HTML::EventLoop&);
     virtual ~TaskQueue() override;
 
-    bool is_empty() const { return m_tasks.is_empty(); }
+    bool is_empty() const { return m_queues.is_empty(); }
 
     bool has_runnable_tasks() const;
     bool has_rendering_tasks() const;
@@ -29,24 +35,70 @@ public:
     GC::Ptr<HTML::Task> take_first_runnable();
 
     void enqueue(GC::Ref<HTML::Task> task) { add(task); }
-    GC::Ptr<HTML::Task> dequeue()
-    {
-        if (m_tasks.is_empty())
-            return {};
-        return m_tasks.take_first();
-    }
+    GC::Ptr<HTML::Task> dequeue();
 
     void remove_tasks_matching(Function<bool(HTML::Task const&)>);
     GC::RootVector<GC::Ref<Task>> take_tasks_matching(Function<bool(HTML::Task const&)>);
+    GC::RootVector<GC::Ref<Task>> take_runnable_tasks_with_source(Task::Source);
 
-    Task const* last_added_task() const;
+    Task const* last_added_task() const { return m_last_added_task; }
 
 private:
     virtual void visit_edges(Visitor&) override;
 
+    struct QueueKey {
+        Task::Source source;
+        DOM::Document const* document;
+        Task::Priority priority;
+
+        bool operator==(QueueKey const&) const = default;
+    };
+
+    struct QueueKeyTraits : public DefaultTraits<QueueKey> {
+        static unsigned hash(QueueKey const& key)
+        {
+            return pair_int_hash(pair_int_hash(to_underlying(key.source), ptr_hash(key.document)), to_underlying(key.priority));
+        }
+    };
+
+    // A first-in, first-out queue of tasks that all share the same source, document and priority.
+    class SourceQueue {
+    public:
+        Task::Priority priority() const { return m_priority; }
+
+        bool is_empty() const { return m_head == m_tasks.size(); }
+        Task& first() const { return *m_tasks[m_head]; }
+
+        void append(GC::Ref<Task> task) { m_tasks.append(task); }
+        GC::Ref<Task> take_first();
+        void remove_all_matching(Function<bool(GC::Ref<Task> const&)>);
+
+        // All tasks in a queue are for the same document, so they're either all runnable or none of them are.
+        bool is_runnable() const { return first().is_runnable(); }
+
+        void visit_edges(Visitor&);
+
+        explicit SourceQueue(Task::Priority priority)
+            : m_priority(priority)
+        {
+        }
+
+    private:
+        Task::Priority m_priority;
+
+        // Tasks before the head have already been taken, and are only dropped every once in a while so that taking a
+        // task doesn't have to move all those after it.
+        Vector<GC::Ref<Task>> m_tasks;
+        size_t m_head { 0 };
+    };
+
+    bool can_take_from(Task::Source, SourceQueue const&) const;
+    void remove_empty_queues();
+
     GC::Ref<HTML::EventLoop> m_event_loop;
 
-    Vector<GC::Ref<HTML::Task>> m_tasks;
+    HashMap<QueueKey, NonnullOwnPtr<SourceQueue>, QueueKeyTraits> m_queues;
+    GC::Ptr<Task> m_last_added_task;
 };
 
 }
@@ -35,6 +35,7 @@
 #include <LibWeb/HTML/PotentialCORSRequest.h>
 #include <LibWeb/HTML/Scripting/TemporaryExecutionContext.h>
 #include <LibWeb/HTML/SharedResourceRequest.h>
+#include <LibWeb/HTML/Window.h>
 #include <LibWeb/Layout/ImageBox.h>
 #include <LibWeb/Loader/ResourceLoader.h>
 #include <LibWeb/Painting/PaintableBox.h>
@@ -71,6 +72,17 @@ void HTMLImageElement::initialize(JS::Realm& realm)
     m_current_request = ImageRequest::create(realm, document().page());
 }
 
+void HTMLImageElement::removed_from(DOM::Node* old_parent, DOM::Node& old_root)
+{
+    Base::removed_from(old_parent, old_root);
+
+    // NOTE: Once we're no longer in a document, nothing tells us that we've left the viewport, and we no longer paint.
+    if (!in_a_document_tree()) {
+        set_visible_in_viewport(false);
+        set_painted_image_data(nullptr);
+    }
+}
+
 void HTMLImageElement::adopted_from(DOM::Document& old_document)
 {
     old_document.unregister_viewport_client(*this);
@@ -90,6 +102,8 @@ void HTMLImageElement::visit_edges(Cell::Visitor& visitor)
     visitor.visit(m_current_request);
     visitor.visit(m_pending_request);
     visitor.visit(m_document_observer);
+    visitor.visit(m_image_data_in_viewport);
+    visitor.visit(m_painted_image_data);
     visit_lazy_loading_element(visitor);
 }
 
@@ -213,9 +227,40 @@ RefPtr<Gfx::ImmutableBitmap> HTMLImageElement::current_image_bitmap_sized(Gfx::I
     return nullptr;
 }
 
-void HTMLImageElement::set_visible_in_viewport(bool)
+RefPtr<Gfx::ImmutableBitmap> HTMLImageElement::current_image_bitmap_for_painting(Gfx::IntSize size) const
+{
+    auto data = m_current_request->image_data();
+    const_cast<HTMLImageElement&>(*this).set_painted_image_data(data);
+    if (data)
+        return data->bitmap_if_decoded(m_current_frame_index, size);
+    return nullptr;
+}
+
+void HTMLImageElement::set_painted_image_data(GC::Ptr<DecodedImageData> image_data)
+{
+    // NOTE: Our image data tells our paintable to paint again when its frames have been decoded or discarded.
+    if (image_data == m_painted_image_data)
+        return;
+
+    if (m_painted_image_data)
+        m_painted_image_data->did_stop_being_painted_by(*this);
+    m_painted_image_data = image_data;
+    if (m_painted_image_data)
+        m_painted_image_data->did_start_being_painted_by(*this);
+}
+
+void HTMLImageElement::set_visible_in_viewport(bool visible_in_viewport)
 {
-    // FIXME: Loosen grip on image data when it's not visible, e.g via volatile memory.
+    // NOTE: Our image data may discard its decoded frames while it's not in the viewport, so keep it posted.
+    GC::Ptr<DecodedImageData> image_data = visible_in_viewport ? m_current_request->image_data() : nullptr;
+    if (image_data == m_image_data_in_viewport)
+        return;
+
+    if (m_image_data_in_viewport)
+        m_image_data_in_viewport->did_leave_viewport();
+    m_image_data_in_viewport = image_data;
+    if (m_image_data_in_viewport)
+        m_image_data_in_viewport->did_enter_viewport();
 }
 
 // https://html.spec.whatwg.org/multipage/embedded-content.html#dom-img-width
@@ -285,6 +330,9 @@ unsigned HTMLImageElement::natural_width() const
 {
     // Return the density-corrected intrinsic width of the image, in CSS pixels,
     // if the image has intrinsic dimensions and is available.
+    // NOTE: The bitmap may have been decoded at a smaller size than the image's own, so prefer what the image says.
+    if (auto intrinsic_width = this->intrinsic_width(); intrinsic_width.has_value())
+        return intrinsic_width->to_int();
     if (auto bitmap = current_image_bitmap())
         return bitmap->width();
 
@@ -297,6 +345,9 @@ unsigned HTMLImageElement::natural_height() const
 {
     // Return the density-corrected intrinsic height of the image, in CSS pixels,
     // if the image has intrinsic dimensions and is available.
+    // NOTE: The bitmap may have been decoded at a smaller size than the image's own, so prefer what the image says.
+    if (auto intrinsic_height = this->intrinsic_height(); intrinsic_height.has_value())
+        return intrinsic_height->to_int();
     if (auto bitmap = current_image_bitmap())
         return bitmap->height();
 
@@ -590,6 +641,7 @@ void HTMLImageElement::update_the_image_data_impl(bool restart_animations, bool
 
             // 4. Set the current request to a new image request whose image data is that of the entry and whose state is completely available.
             m_current_request = ImageRequest::create(realm(), document().page());
+            set_visible_in_viewport(false);
             m_current_request->set_image_data(entry->image_data);
             m_current_request->set_state(ImageRequest::State::CompletelyAvailable);
 
@@ -722,9 +774,10 @@ after_step_7:
 
         // 18. If the current request's state is unavailable or broken, then set the current request to image request.
         //     Otherwise, set the pending request to image request.
-        if (m_current_request->state() == ImageRequest::State::Unavailable || m_current_request->state() == ImageRequest::State::Broken)
+        if (m_current_request->state() == ImageRequest::State::Unavailable || m_current_request->state() == ImageRequest::State::Broken) {
             m_current_request = image_request;
-        else
+            set_visible_in_viewport(false);
+        } else
             m_pending_request = image_request;
 
         // 24. Let delay load event be true if the img's lazy loading attribute is in the Eager state, or if scripting is disabled for the img, and false otherwise.
@@ -847,11 +900,74 @@ void HTMLImageElement::add_callbacks_to_image_request(GC::Ref<ImageRequest> imag
                 dispatch_event(DOM::Event::create(realm(), HTML::EventNames::error));
 
             m_load_event_delayer.clear();
-        });
+        },
+        [this, image_request]() {
+            // NOTE: While the image data is still arriving, show what has been decoded of it so far. This only applies to
+            //       the current request, as a pending request replaces the current one once it is completely available.
+            if (image_request != m_current_request)
+                return;
+            auto state = image_request->state();
+            if (state != ImageRequest::State::Unavailable && state != ImageRequest::State::PartiallyAvailable)
+                return;
+
+            VERIFY(image_request->shared_resource_request());
+            auto partial_image_data = image_request->shared_resource_request()->partial_image_data();
+            if (!partial_image_data)
+                return;
+
+            image_request->set_image_data(partial_image_data);
+            if (state == ImageRequest::State::PartiallyAvailable)
+                return;
+
+            image_request->set_state(ImageRequest::State::PartiallyAvailable);
+            set_needs_style_update(true);
+            if (auto layout_node = this->layout_node())
+                layout_node->set_needs_layout_update(DOM::SetNeedsLayoutReason::HTMLImageElementUpdateTheImageData);
+        },
+        [this] { return size_to_decode_image_at(); });
+}
+
+Optional<Gfx::IntSize> HTMLImageElement::size_to_decode_image_at() const
+{
+    Optional<CSSPixelSize> display_size;
+    if (auto const* paintable_box = this->paintable_box()) {
+        // NOTE: If our size depends on the image's (e.g. width: auto), layout hasn't seen the image yet, so our box doesn't
+        //       tell us how large it's going to be. With object-fit: none or scale-down, the image may be shown at its
+        //       natural size regardless of ours.
+        auto const& computed_values = paintable_box->computed_values();
+        if (!computed_values.width().is_length_percentage() || !computed_values.height().is_length_percentage())
+            return {};
+        if (computed_values.object_fit() == CSS::ObjectFit::None || computed_values.object_fit() == CSS::ObjectFit::ScaleDown)
+            return {};
+        display_size = paintable_box->content_size();
+    } else if (!layout_node()) {
+        // NOTE: If we haven't been laid out yet, our dimension attributes are the best guess we have.
+        auto width_attribute = get_attribute(HTML::AttributeNames::width);
+        auto height_attribute = get_attribute(HTML::AttributeNames::height);
+        if (!width_attribute.has_value() || !height_attribute.has_value())
+            return {};
+        auto width = parse_non_negative_integer(*width_attribute);
+        auto height = parse_non_negative_integer(*height_attribute);
+        if (!width.has_value() || !height.has_value())
+            return {};
+        display_size = CSSPixelSize { CSSPixels(*width), CSSPixels(*height) };
+    }
+    if (!display_size.has_value())
+        return {};
+
+    auto device_pixel_ratio = document().window() ? document().window()->device_pixel_ratio() : 1.0;
+    return Gfx::IntSize {
+        static_cast<int>(AK::ceil(display_size->width().to_double() * device_pixel_ratio)),
+        static_cast<int>(AK::ceil(display_size->height().to_double() * device_pixel_ratio)),
+    };
 }
 
 void HTMLImageElement::did_set_viewport_rect(CSSPixelRect const& viewport_rect)
 {
+    // NOTE: If we're no longer rendered (e.g. display: none), there is no paintable left to tell us we left the viewport.
+    if (!paintable())
+        set_visible_in_viewport(false);
+
     if (viewport_rect.size() == m_last_seen_viewport_size)
         return;
     m_last_seen_viewport_size = viewport_rect.size();
@@ -1016,7 +1132,9 @@ void HTMLImageElement::react_to_changes_in_the_environment()
                 //    or if the user agent is able to determine that image request's image is corrupted in some
                 //    fatal way such that the image dimensions cannot be obtained,
                 m_pending_request = nullptr;
-            });
+            },
+            {},
+            [this] { return size_to_decode_image_at(); });
 
         // 5. Let response be the result of fetching request.
         image_request->fetch_image(realm(), request);
@@ -1032,6 +1150,9 @@ void HTMLImageElement::upgrade_pending_request_to_current_request()
 
     // 2. Set the img element's pending request to null.
     m_pending_request = nullptr;
+
+    // NOTE: Our paintable tells us whether the new image is in the viewport once it has been laid out again.
+    set_visible_in_viewport(false);
 }
 
 void HTMLImageElement::handle_failed_fetch()
@@ -1235,7 +1356,8 @@ Optional<ImageSourceAndPixelDensity> HTMLImageElement::select_an_image_source()
         return {};
 
     // 3. Return the result of selecting an image from el's source set.
-    return m_source_set.select_an_image_source();
+    auto device_pixel_ratio = document().window() ? document().window()->device_pixel_ratio() : 1.0;
+    return m_source_set.select_an_image_source(device_pixel_ratio);
 }
 
 void HTMLImageElement::set_source_set(SourceSet source_set)
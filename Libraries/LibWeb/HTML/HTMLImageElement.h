@@ -106,6 +106,7 @@ public:
     virtual Optional<CSSPixels> intrinsic_height() const override;
     virtual Optional<CSSPixelFraction> intrinsic_aspect_ratio() const override;
     virtual RefPtr<Gfx::ImmutableBitmap> current_image_bitmap_sized(Gfx::IntSize) const override;
+    virtual RefPtr<Gfx::ImmutableBitmap> current_image_bitmap_for_painting(Gfx::IntSize) const override;
     virtual void set_visible_in_viewport(bool) override;
     virtual GC::Ptr<DOM::Element const> to_html_element() const override { return *this; }
 
@@ -121,6 +122,7 @@ private:
     virtual void initialize(JS::Realm&) override;
     virtual void finalize() override;
 
+    virtual void removed_from(DOM::Node* old_parent, DOM::Node& old_root) override;
     virtual void adopted_from(DOM::Document&) override;
 
     virtual bool is_presentational_hint(FlyString const&) const override;
@@ -138,8 +140,13 @@ private:
     void handle_failed_fetch();
     void add_callbacks_to_image_request(GC::Ref<ImageRequest>, bool maybe_omit_events, String const& url_string, String const& previous_url);
 
+    // The size in device pixels that we're going to display our image at, if we already know it before the image arrives.
+    Optional<Gfx::IntSize> size_to_decode_image_at() const;
+
     void animate();
 
+    void set_painted_image_data(GC::Ptr<DecodedImageData>);
+
     RefPtr<Core::Timer> m_animation_timer;
     size_t m_current_frame_index { 0 };
     size_t m_loops_completed { 0 };
@@ -163,6 +170,12 @@ private:
     SourceSet m_source_set;
 
     CSSPixelSize m_last_seen_viewport_size;
+
+    // The image data we've told that it's in the viewport, if any.
+    GC::Ptr<DecodedImageData> m_image_data_in_viewport;
+
+    // The image data we've told that we paint it, if any.
+    GC::Ptr<DecodedImageData> m_painted_image_data;
 };
 
 }
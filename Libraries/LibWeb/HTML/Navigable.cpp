@@ -2438,7 +2438,10 @@ void Navigable::perform_scroll_of_viewport(CSSPixelPoint new_position)
         scroll_offset_did_change();
 
         if (auto document = active_document()) {
-            document->set_needs_display(InvalidateDisplayList::No);
+            if (is_traversable())
+                set_needs_repaint_after_scrolling();
+            else
+                document->set_needs_display(InvalidateDisplayList::No);
             document->set_needs_to_refresh_scroll_state(true);
             document->inform_all_viewport_clients_about_the_current_viewport_rect();
         }
@@ -2647,9 +2650,51 @@ void Navigable::ready_to_paint()
     VERIFY(m_number_of_queued_rasterization_tasks >= 0 && m_number_of_queued_rasterization_tasks < 2);
 }
 
+static bool should_repaint_partially(Painting::DamageRegion const& damage_region, Gfx::IntRect const& viewport_rect)
+{
+    if (damage_region.is_everything())
+        return false;
+
+    // NOTE: Copying the rest of the previous frame only pays off if most of the viewport hasn't changed.
+    return damage_region.area() <= static_cast<size_t>(viewport_rect.size().area()) / 2;
+}
+
+// Scrolling the viewport moves most of what's in it along as a whole, so the previous frame can be copied moved by the
+// scroll delta, and only what has been scrolled into view or doesn't move along has to be painted again.
+static bool add_damage_for_scrolling(Painting::PartialRepaint& partial_repaint, Painting::DisplayList const& display_list, Painting::ScrollStateSnapshot const& previous_scroll_state, Painting::ScrollStateSnapshot const& scroll_state, Gfx::IntRect const& viewport_rect)
+{
+    // NOTE: The scroll frame of the viewport is always the first one to be created.
+    auto viewport_scroll_offset = [&](Painting::ScrollStateSnapshot const& state) {
+        return state.cumulative_offset_for_frame_with_id(0).to_type<double>().scaled(display_list.device_pixels_per_css_pixel()).to_type<int>();
+    };
+    auto shift = viewport_scroll_offset(scroll_state) - viewport_scroll_offset(previous_scroll_state);
+    if (shift.is_zero())
+        return true;
+    if (abs(shift.x()) >= viewport_rect.width() || abs(shift.y()) >= viewport_rect.height())
+        return false;
+
+    // NOTE: Anything damaged since the previous frame may have been damaged before the viewport was scrolled, in which
+    //       case what has to be painted over has been moved along with the rest of the frame.
+    Painting::DamageRegion damage_region;
+    for (auto const& rect : partial_repaint.damage_region.rects()) {
+        damage_region.add(rect);
+        damage_region.add(rect.translated(shift).intersected(viewport_rect));
+    }
+
+    for (auto const& rect : viewport_rect.shatter(viewport_rect.translated(shift)))
+        damage_region.add(rect);
+
+    if (!display_list.add_damage_for_scrolling(damage_region, previous_scroll_state, scroll_state, shift, viewport_rect))
+        return false;
+
+    partial_repaint.damage_region = move(damage_region);
+    partial_repaint.previous_frame_offset = shift;
+    return true;
+}
+
 void Navigable::paint_next_frame()
 {
-    auto [backing_store_id, painting_surface] = m_backing_store_manager->acquire_store_for_next_frame();
+    auto [backing_store_id, painting_surface, previous_frame_store] = m_backing_store_manager->acquire_store_for_next_frame();
     if (!painting_surface)
         return;
 
@@ -2657,33 +2702,62 @@ void Navigable::paint_next_frame()
     m_number_of_queued_rasterization_tasks++;
 
     auto viewport_rect = page().css_to_device_rect(this->viewport_rect());
+
+    Optional<Painting::PartialRepaint> partial_repaint;
+    if (previous_frame_store && m_viewport_rect_of_previous_frame.has_value() && m_viewport_rect_of_previous_frame->size() == viewport_rect.size() && !m_damage_region.is_everything())
+        partial_repaint = Painting::PartialRepaint { *previous_frame_store, move(m_damage_region) };
+    m_damage_region.clear();
+    m_viewport_rect_of_previous_frame = viewport_rect;
+
     PaintConfig paint_config { .paint_overlay = true, .should_show_line_box_borders = m_should_show_line_box_borders, .canvas_fill_rect = Gfx::IntRect { {}, viewport_rect.size().to_type<int>() } };
-    start_display_list_rendering(*painting_surface, paint_config, [this, viewport_rect, backing_store_id] {
-        if (!is_top_level_traversable())
-            return;
-        auto& traversable = *page().top_level_traversable();
-        traversable.page().client().page_did_paint(viewport_rect.to_type<int>(), backing_store_id);
-    });
+    start_display_list_rendering(
+        *painting_surface, paint_config, [this, viewport_rect, backing_store_id] {
+            if (!is_top_level_traversable())
+                return;
+            auto& traversable = *page().top_level_traversable();
+            traversable.page().client().page_did_paint(viewport_rect.to_type<int>(), backing_store_id);
+        },
+        move(partial_repaint));
+
+    // NOTE: The next frame can be painted from this one, moved by however far the viewport gets scrolled meanwhile.
+    m_scroll_state_of_previous_frame.clear();
+    if (auto document = active_document(); document && document->paintable())
+        m_scroll_state_of_previous_frame = document->paintable()->scroll_state().snapshot();
 }
 
-void Navigable::start_display_list_rendering(Gfx::PaintingSurface& painting_surface, PaintConfig paint_config, Function<void()>&& callback)
+void Navigable::start_display_list_rendering(Gfx::PaintingSurface& painting_surface, PaintConfig paint_config, Function<void()>&& callback, Optional<Painting::PartialRepaint> partial_repaint)
 {
     m_needs_repaint = false;
     auto document = active_document();
     if (!document) {
+        // NOTE: Nothing gets painted, so the next frame can't build on this one.
+        m_viewport_rect_of_previous_frame.clear();
         callback();
         return;
     }
     auto display_list = document->record_display_list(paint_config);
     if (!display_list) {
+        m_viewport_rect_of_previous_frame.clear();
         callback();
         return;
     }
 
+    if (partial_repaint.has_value() && display_list->has_backdrop_filters())
+        partial_repaint.clear();
+
     auto& document_paintable = *document->paintable();
     Painting::ScrollStateSnapshotByDisplayList scroll_state_snapshot_by_display_list;
     document_paintable.refresh_scroll_state();
     auto scroll_state_snapshot = document_paintable.scroll_state().snapshot();
+
+    if (partial_repaint.has_value()) {
+        Gfx::IntRect viewport_rect { {}, page().css_to_device_rect(this->viewport_rect()).size().to_type<int>() };
+        if (!m_scroll_state_of_previous_frame.has_value()
+            || !add_damage_for_scrolling(*partial_repaint, *display_list, *m_scroll_state_of_previous_frame, scroll_state_snapshot, viewport_rect)
+            || !should_repaint_partially(partial_repaint->damage_region, viewport_rect))
+            partial_repaint.clear();
+    }
+
     scroll_state_snapshot_by_display_list.set(*display_list, move(scroll_state_snapshot));
     // Collect scroll state snapshots for each nested navigable
     document_paintable.for_each_in_inclusive_subtree_of_type<Painting::NavigableContainerViewportPaintable>([&scroll_state_snapshot_by_display_list](auto& navigable_container_paintable) {
@@ -2702,7 +2776,7 @@ void Navigable::start_display_list_rendering(Gfx::PaintingSurface& painting_surf
         return TraversalDecision::Continue;
     });
 
-    m_rendering_thread.enqueue_rendering_task(*display_list, move(scroll_state_snapshot_by_display_list), painting_surface, move(callback));
+    m_rendering_thread.enqueue_rendering_task(*display_list, move(scroll_state_snapshot_by_display_list), painting_surface, move(partial_repaint), move(callback));
 }
 
 RefPtr<Gfx::SkiaBackendContext> Navigable::skia_backend_context() const
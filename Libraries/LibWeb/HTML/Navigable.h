@@ -27,6 +27,8 @@
 #include <LibWeb/InvalidateDisplayList.h>
 #include <LibWeb/Page/EventHandler.h>
 #include <LibWeb/Painting/BackingStoreManager.h>
+#include <LibWeb/Painting/DamageRegion.h>
+#include <LibWeb/Painting/ScrollState.h>
 #include <LibWeb/PixelUnits.h>
 #include <LibWeb/XHR/FormDataEntry.h>
 
@@ -216,10 +218,29 @@ public:
     bool is_ready_to_paint() const;
     void ready_to_paint();
     void paint_next_frame();
-    void start_display_list_rendering(Gfx::PaintingSurface&, PaintConfig, Function<void()>&& callback);
+    void start_display_list_rendering(Gfx::PaintingSurface&, PaintConfig, Function<void()>&& callback, Optional<Painting::PartialRepaint> = {});
 
     bool needs_repaint() const { return m_needs_repaint; }
-    void set_needs_repaint() { m_needs_repaint = true; }
+    void set_needs_repaint()
+    {
+        m_needs_repaint = true;
+        m_damage_region.add_everything();
+    }
+
+    // Only the given rect of the viewport, in device pixels, has to be painted again, unless more gets damaged before
+    // the next frame.
+    void set_needs_repaint(Gfx::IntRect const& damage_rect)
+    {
+        m_needs_repaint = true;
+        m_damage_region.add(damage_rect);
+    }
+
+    // Only what has moved by scrolling the viewport has to be painted again, which is worked out when painting the next
+    // frame by comparing its scroll state with that of the previous one.
+    void set_needs_repaint_after_scrolling() { m_needs_repaint = true; }
+
+    // Makes the next frame paint all of the viewport, without scheduling one.
+    void damage_entire_viewport() { m_damage_region.add_everything(); }
 
     RefPtr<Gfx::SkiaBackendContext> skia_backend_context() const;
 
@@ -294,6 +315,12 @@ private:
     bool m_pending_set_browser_zoom_request { false };
     bool m_should_show_line_box_borders { false };
     i32 m_number_of_queued_rasterization_tasks { 0 };
+
+    // What has changed in the viewport since the last frame, and the viewport and scroll state that frame was painted for.
+    Painting::DamageRegion m_damage_region { Painting::DamageRegion::everything() };
+    Optional<DevicePixelRect> m_viewport_rect_of_previous_frame;
+    Optional<Painting::ScrollStateSnapshot> m_scroll_state_of_previous_frame;
+
     GC::Ref<Painting::BackingStoreManager> m_backing_store_manager;
     RefPtr<Gfx::SkiaBackendContext> m_skia_backend_context;
     RenderingThread m_rendering_thread;
@@ -37,6 +37,7 @@
 #include <LibWeb/HTML/HTMLTemplateElement.h>
 #include <LibWeb/HTML/Parser/HTMLEncodingDetection.h>
 #include <LibWeb/HTML/Parser/HTMLParser.h>
+#include <LibWeb/HTML/Parser/HTMLPreloadScanner.h>
 #include <LibWeb/HTML/Parser/HTMLToken.h>
 #include <LibWeb/HTML/Scripting/ExceptionReporter.h>
 #include <LibWeb/HTML/Scripting/SimilarOriginWindowAgent.h>
@@ -3307,7 +3308,8 @@ void HTMLParser::handle_text(HTMLToken& token)
                     // 2. Set the pending parsing-blocking script to null.
                     auto the_script = document().take_pending_parsing_blocking_script({});
 
-                    // FIXME: 3. Start the speculative HTML parser for this instance of the HTML parser.
+                    // 3. Start the speculative HTML parser for this instance of the HTML parser.
+                    start_the_speculative_html_parser();
 
                     // 4. Block the tokenizer for this instance of the HTML parser, such that the event loop will not run tasks that invoke the tokenizer.
                     m_tokenizer.set_blocked(true);
@@ -3326,7 +3328,8 @@ void HTMLParser::handle_text(HTMLToken& token)
                     if (m_aborted)
                         return;
 
-                    // FIXME: 7. Stop the speculative HTML parser for this instance of the HTML parser.
+                    // 7. Stop the speculative HTML parser for this instance of the HTML parser.
+                    // NOTE: Our speculative HTML parser runs to completion as soon as it is started, so there is nothing to stop.
 
                     // 8. Unblock the tokenizer for this instance of the HTML parser, such that tasks that invoke the tokenizer can again be run.
                     m_tokenizer.set_blocked(false);
@@ -4992,6 +4995,34 @@ void HTMLParser::reset_the_insertion_mode_appropriately()
     VERIFY_NOT_REACHED();
 }
 
+void HTMLParser::insert_input_at_insertion_point(StringView input)
+{
+    if (m_tokenizer.insertion_point_offset_in_stream() < m_speculatively_scanned_input_length)
+        m_speculatively_scanned_input_length += input.length();
+    m_tokenizer.insert_input_at_insertion_point(input);
+}
+
+// https://html.spec.whatwg.org/multipage/parsing.html#start-the-speculative-html-parser
+void HTMLParser::start_the_speculative_html_parser()
+{
+    // 1. Optionally, return.
+    // NOTE: Speculative fetches need a Window to fetch on behalf of.
+    if (!m_document->browsing_context() || !is<Window>(relevant_global_object(*m_document)))
+        return;
+
+    // NOTE: Rather than keeping a speculative parser around for as long as the parser is blocked, we scan through all
+    //       of the input that is available right away, and remember how far we got. Later parser-blocking scripts
+    //       then don't make us go over the same input again.
+    if (m_tokenizer.consumed_input_length() < m_speculatively_scanned_input_length)
+        return;
+
+    auto input = m_tokenizer.unconsumed_input();
+    m_speculatively_scanned_input_length = m_tokenizer.consumed_input_length() + input.length();
+
+    HTMLPreloadScanner preload_scanner { *m_document, input };
+    preload_scanner.run();
+}
+
 char const* HTMLParser::insertion_mode_name() const
 {
     switch (m_insertion_mode) {
@@ -94,6 +94,8 @@ public:
 
     HTMLTokenizer& tokenizer() { return m_tokenizer; }
 
+    void insert_input_at_insertion_point(StringView);
+
     // https://html.spec.whatwg.org/multipage/parsing.html#abort-a-parser
     void abort();
 
@@ -174,6 +176,8 @@ private:
     void decrement_script_nesting_level();
     void reset_the_insertion_mode_appropriately();
 
+    void start_the_speculative_html_parser();
+
     void adjust_mathml_attributes(HTMLToken&);
     void adjust_svg_tag_names(HTMLToken&);
     void adjust_svg_attributes(HTMLToken&);
@@ -226,6 +230,10 @@ private:
     GC::ForeignPtr<Web::SpeculativeHTMLParser> m_speculative_parser;
 #endif
 
+    // NOTE: How much of the input stream the preload scanner has already looked through, so that we don't scan it
+    //       again. Input that document.write() inserts before this point moves it along.
+    size_t m_speculatively_scanned_input_length { 0 };
+
     Vector<HTMLToken> m_pending_table_character_tokens;
 
     GC::Ptr<DOM::Text> m_character_insertion_node;
@@ -0,0 +1,233 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/QuickSort.h>
+#include <LibWeb/DOM/Document.h>
+#include <LibWeb/DOMURL/DOMURL.h>
+#include <LibWeb/Fetch/Infrastructure/URL.h>
+#include <LibWeb/HTML/AttributeNames.h>
+#include <LibWeb/HTML/Parser/HTMLPreloadScanner.h>
+#include <LibWeb/HTML/PotentialCORSRequest.h>
+#include <LibWeb/HTML/PreloadedResources.h>
+#include <LibWeb/HTML/SourceSet.h>
+#include <LibWeb/HTML/TagNames.h>
+#include <LibWeb/HTML/Window.h>
+#include <LibWeb/Infra/CharacterTypes.h>
+#include <LibWeb/MimeSniff/MimeType.h>
+
+namespace Web::HTML {
+
+HTMLPreloadScanner::HTMLPreloadScanner(DOM::Document& document, StringView input)
+    : m_document(document)
+    , m_tokenizer(input, "utf-8")
+    , m_base_url(document.base_url())
+    , m_has_seen_base_element_with_href(document.first_base_element_with_href_in_tree_order() != nullptr)
+    , m_scripting_enabled(document.is_scripting_enabled())
+    , m_device_pixel_ratio(document.window() ? document.window()->device_pixel_ratio() : 1.0)
+{
+}
+
+void HTMLPreloadScanner::run()
+{
+    for (;;) {
+        auto token = m_tokenizer.next_token();
+        if (!token.has_value() || token->is_end_of_file())
+            break;
+
+        if (token->is_start_tag()) {
+            process_start_tag(*token);
+        } else if (token->is_end_tag() && token->tag_name() == TagNames::template_) {
+            if (m_template_nesting_level > 0)
+                --m_template_nesting_level;
+        }
+    }
+}
+
+void HTMLPreloadScanner::process_start_tag(HTMLToken const& token)
+{
+    auto const& tag_name = token.tag_name();
+
+    // Switch the tokenizer to the state that tree construction would switch it to, so that we don't go looking for
+    // tags in the contents of these elements.
+    if (tag_name == TagNames::script)
+        m_tokenizer.switch_to(HTMLTokenizer::State::ScriptData);
+    else if (tag_name.is_one_of(TagNames::style, TagNames::xmp, TagNames::iframe, TagNames::noembed, TagNames::noframes))
+        m_tokenizer.switch_to(HTMLTokenizer::State::RAWTEXT);
+    else if (tag_name == TagNames::noscript && m_scripting_enabled)
+        m_tokenizer.switch_to(HTMLTokenizer::State::RAWTEXT);
+    else if (tag_name.is_one_of(TagNames::textarea, TagNames::title))
+        m_tokenizer.switch_to(HTMLTokenizer::State::RCDATA);
+    else if (tag_name == TagNames::plaintext)
+        m_tokenizer.switch_to(HTMLTokenizer::State::PLAINTEXT);
+
+    if (tag_name == TagNames::template_) {
+        ++m_template_nesting_level;
+        return;
+    }
+
+    // Speculative fetches should not be performed for elements in template contents.
+    if (m_template_nesting_level > 0)
+        return;
+
+    if (tag_name == TagNames::base) {
+        // NOTE: Only the first base element with an href attribute affects the document base URL.
+        if (m_has_seen_base_element_with_href)
+            return;
+        auto href = token.attribute(AttributeNames::href);
+        if (!href.has_value())
+            return;
+        m_has_seen_base_element_with_href = true;
+        if (auto url = DOMURL::parse(*href, m_document->fallback_base_url(), m_document->encoding_or_default()); url.has_value())
+            m_base_url = url.release_value();
+        return;
+    }
+
+    if (tag_name == TagNames::script)
+        process_script_start_tag(token);
+    else if (tag_name == TagNames::link)
+        process_link_start_tag(token);
+    else if (tag_name == TagNames::img)
+        process_img_start_tag(token);
+}
+
+void HTMLPreloadScanner::process_script_start_tag(HTMLToken const& token)
+{
+    auto src = token.attribute(AttributeNames::src);
+    if (!src.has_value() || src->is_empty())
+        return;
+
+    // NOTE: This follows the script type checks in HTMLScriptElement::prepare_script(), minus the language attribute.
+    auto is_module = false;
+    if (auto type = token.attribute(AttributeNames::type); type.has_value() && !type->is_empty()) {
+        auto script_block_type = type->bytes_as_string_view().trim(Infra::ASCII_WHITESPACE);
+        if (script_block_type.equals_ignoring_ascii_case("module"sv))
+            is_module = true;
+        else if (!MimeSniff::is_javascript_mime_type_essence_match(script_block_type))
+            return;
+    }
+
+    // Classic scripts with a nomodule attribute don't get fetched at all.
+    if (!is_module && token.has_attribute(AttributeNames::nomodule))
+        return;
+
+    auto cors_setting = cors_setting_attribute_from_keyword(token.attribute(AttributeNames::crossorigin));
+
+    // Module scripts are always fetched in "cors" mode, with credentials only if asked for.
+    if (is_module && cors_setting == CORSSettingAttribute::NoCORS)
+        cors_setting = CORSSettingAttribute::Anonymous;
+
+    fetch(*src, Fetch::Infrastructure::Request::Destination::Script, cors_setting, token.attribute(AttributeNames::integrity));
+}
+
+void HTMLPreloadScanner::process_link_start_tag(HTMLToken const& token)
+{
+    auto href = token.attribute(AttributeNames::href);
+    auto rel = token.attribute(AttributeNames::rel);
+    if (!href.has_value() || href->is_empty() || !rel.has_value())
+        return;
+
+    auto is_stylesheet = false;
+    auto is_alternate = false;
+    auto is_preload = false;
+    for (auto keyword : rel->bytes_as_string_view().split_view_if(Infra::is_ascii_whitespace)) {
+        if (keyword.equals_ignoring_ascii_case("stylesheet"sv))
+            is_stylesheet = true;
+        else if (keyword.equals_ignoring_ascii_case("alternate"sv))
+            is_alternate = true;
+        else if (keyword.equals_ignoring_ascii_case("preload"sv))
+            is_preload = true;
+    }
+
+    auto cors_setting = cors_setting_attribute_from_keyword(token.attribute(AttributeNames::crossorigin));
+    auto integrity = token.attribute(AttributeNames::integrity);
+
+    // NOTE: Alternate stylesheets aren't fetched until they get enabled.
+    if (is_stylesheet && !is_alternate) {
+        fetch(*href, Fetch::Infrastructure::Request::Destination::Style, cors_setting, move(integrity));
+        return;
+    }
+
+    if (is_preload) {
+        // NOTE: We only preload the kinds of resources that are fetched in a way that can consume a preloaded response.
+        auto as = token.attribute(AttributeNames::as).value_or({});
+        if (as.equals_ignoring_ascii_case("script"sv))
+            fetch(*href, Fetch::Infrastructure::Request::Destination::Script, cors_setting, move(integrity));
+        else if (as.equals_ignoring_ascii_case("style"sv))
+            fetch(*href, Fetch::Infrastructure::Request::Destination::Style, cors_setting, move(integrity));
+        else if (as.equals_ignoring_ascii_case("image"sv))
+            fetch(*href, Fetch::Infrastructure::Request::Destination::Image, cors_setting, move(integrity));
+    }
+}
+
+// Picks the same image source that SourceSet::select_an_image_source() would, as long as that doesn't depend on layout.
+static Optional<String> select_an_image_source(Optional<String> const& src, Optional<String> const& srcset, double device_pixel_ratio)
+{
+    if (!srcset.has_value() || srcset->is_empty()) {
+        if (src.has_value() && !src->is_empty())
+            return src;
+        return {};
+    }
+
+    Vector<ImageSourceAndPixelDensity> candidates;
+    auto has_candidate_with_pixel_density_of_1 = false;
+    for (auto const& source : parse_a_srcset_attribute(*srcset).m_sources) {
+        // NOTE: Width descriptors can only be resolved against the layout, so those have to wait for the parser.
+        if (source.descriptor.has<ImageSource::WidthDescriptorValue>())
+            return {};
+
+        auto pixel_density = 1.0;
+        if (auto const* descriptor = source.descriptor.get_pointer<ImageSource::PixelDensityDescriptorValue>())
+            pixel_density = descriptor->value;
+        if (pixel_density == 1.0)
+            has_candidate_with_pixel_density_of_1 = true;
+        candidates.append({ source, pixel_density });
+    }
+
+    if (src.has_value() && !src->is_empty() && !has_candidate_with_pixel_density_of_1)
+        candidates.append({ { .url = *src, .descriptor = {} }, 1.0 });
+
+    if (candidates.is_empty())
+        return {};
+
+    quick_sort(candidates, [](auto& a, auto& b) {
+        return a.pixel_density < b.pixel_density;
+    });
+    for (auto const& candidate : candidates) {
+        if (candidate.pixel_density >= device_pixel_ratio)
+            return candidate.source.url;
+    }
+    return candidates.last().source.url;
+}
+
+void HTMLPreloadScanner::process_img_start_tag(HTMLToken const& token)
+{
+    // Lazily loaded images may never be fetched at all.
+    if (auto loading = token.attribute(AttributeNames::loading); loading.has_value() && loading->equals_ignoring_ascii_case("lazy"sv))
+        return;
+
+    auto url = select_an_image_source(token.attribute(AttributeNames::src), token.attribute(AttributeNames::srcset), m_device_pixel_ratio);
+    if (!url.has_value())
+        return;
+
+    auto cors_setting = cors_setting_attribute_from_keyword(token.attribute(AttributeNames::crossorigin));
+    fetch(*url, Fetch::Infrastructure::Request::Destination::Image, cors_setting);
+}
+
+// https://html.spec.whatwg.org/multipage/parsing.html#speculative-fetch
+void HTMLPreloadScanner::fetch(StringView url_string, Optional<Fetch::Infrastructure::Request::Destination> destination, CORSSettingAttribute cors_setting, Optional<String> integrity)
+{
+    auto url = DOMURL::parse(url_string, m_base_url, m_document->encoding_or_default());
+    if (!url.has_value() || !Fetch::Infrastructure::is_http_or_https_scheme(url->scheme()))
+        return;
+
+    auto request = create_potential_CORS_request(m_document->vm(), *url, destination, cors_setting);
+    if (integrity.has_value())
+        request->set_integrity_metadata(integrity.release_value());
+
+    speculatively_fetch(*m_document, request);
+}
+
+}
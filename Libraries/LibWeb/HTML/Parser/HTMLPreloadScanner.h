@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Noncopyable.h>
+#include <LibGC/Ptr.h>
+#include <LibURL/URL.h>
+#include <LibWeb/Fetch/Infrastructure/HTTP/Requests.h>
+#include <LibWeb/Forward.h>
+#include <LibWeb/HTML/CORSSettingAttribute.h>
+#include <LibWeb/HTML/Parser/HTMLTokenizer.h>
+
+namespace Web::HTML {
+
+// Looks ahead through input that the HTML parser hasn't gotten to yet, and makes speculative fetches for the
+// subresources it finds there. This keeps the network busy while the parser is blocked on a script.
+// https://html.spec.whatwg.org/multipage/parsing.html#speculative-html-parsing
+class HTMLPreloadScanner {
+    AK_MAKE_NONCOPYABLE(HTMLPreloadScanner);
+    AK_MAKE_NONMOVABLE(HTMLPreloadScanner);
+
+public:
+    HTMLPreloadScanner(DOM::Document&, StringView input);
+
+    void run();
+
+private:
+    void process_start_tag(HTMLToken const&);
+    void process_script_start_tag(HTMLToken const&);
+    void process_link_start_tag(HTMLToken const&);
+    void process_img_start_tag(HTMLToken const&);
+
+    void fetch(StringView url, Optional<Fetch::Infrastructure::Request::Destination>, CORSSettingAttribute, Optional<String> integrity = {});
+
+    GC::Ref<DOM::Document> m_document;
+    HTMLTokenizer m_tokenizer;
+
+    URL::URL m_base_url;
+    bool m_has_seen_base_element_with_href { false };
+
+    bool m_scripting_enabled { false };
+    double m_device_pixel_ratio { 1 };
+
+    size_t m_template_nesting_level { 0 };
+};
+
+}
@@ -7,6 +7,7 @@
 
 #include <AK/CharacterTypes.h>
 #include <AK/Debug.h>
+#include <AK/FindFirstOfASCII.h>
 #include <AK/GenericShorthands.h>
 #include <AK/SourceLocation.h>
 #include <LibTextCodec/Decoder.h>
@@ -193,9 +194,47 @@ static inline void log_parse_error(SourceLocation const& location = SourceLocati
     dbgln_if(TOKENIZER_TRACE_DEBUG, "Parse error (tokenization) {}", location);
 }
 
+static constexpr bool is_utf8_continuation_byte(u8 byte)
+{
+    return (byte & 0xC0) == 0x80;
+}
+
+static constexpr size_t utf8_code_point_length(u8 leading_byte)
+{
+    if (leading_byte < 0x80)
+        return 1;
+    if (leading_byte < 0xE0)
+        return 2;
+    if (leading_byte < 0xF0)
+        return 3;
+    return 4;
+}
+
+u32 HTMLTokenizer::code_point_at(ssize_t offset) const
+{
+    // NOTE: The input is always valid UTF-8, as it was either produced by a decoder or validated when inserted.
+    auto const* data = m_input.data() + offset;
+    switch (utf8_code_point_length(data[0])) {
+    case 1:
+        return data[0];
+    case 2:
+        return ((data[0] & 0x1F) << 6) | (data[1] & 0x3F);
+    case 3:
+        return ((data[0] & 0x0F) << 12) | ((data[1] & 0x3F) << 6) | (data[2] & 0x3F);
+    default:
+        return ((data[0] & 0x07) << 18) | ((data[1] & 0x3F) << 12) | ((data[2] & 0x3F) << 6) | (data[3] & 0x3F);
+    }
+}
+
+ssize_t HTMLTokenizer::offset_after_code_point_at(ssize_t offset) const
+{
+    return offset + static_cast<ssize_t>(utf8_code_point_length(m_input[offset]));
+}
+
 Optional<u32> HTMLTokenizer::next_code_point(StopAtInsertionPoint stop_at_insertion_point)
 {
-    if (m_current_offset >= static_cast<ssize_t>(m_decoded_input.size()))
+    make_input_readable(1, StopAtInsertionPoint::No);
+    if (m_current_offset >= static_cast<ssize_t>(m_input.size()))
         return {};
 
     u32 code_point;
@@ -211,7 +250,7 @@ Optional<u32> HTMLTokenizer::next_code_point(StopAtInsertionPoint stop_at_insert
         code_point = '\n';
     } else {
         skip(1);
-        code_point = m_decoded_input[m_prev_offset];
+        code_point = code_point_at(m_prev_offset);
     }
 
     dbgln_if(TOKENIZER_TRACE_DEBUG, "(Tokenizer) Next code_point: {}", code_point);
@@ -224,30 +263,104 @@ void HTMLTokenizer::skip(size_t count)
         m_source_positions.append(m_source_positions.last());
     for (size_t i = 0; i < count; ++i) {
         m_prev_offset = m_current_offset;
-        auto code_point = m_decoded_input[m_current_offset];
         if (!m_source_positions.is_empty()) {
-            if (code_point == '\n') {
+            if (m_input[m_current_offset] == '\n') {
                 m_source_positions.last().column = 0;
                 m_source_positions.last().line++;
             } else {
                 m_source_positions.last().column++;
             }
         }
-        ++m_current_offset;
+        m_current_offset = offset_after_code_point_at(m_current_offset);
     }
 }
 
-Optional<u32> HTMLTokenizer::peek_code_point(ssize_t offset, StopAtInsertionPoint stop_at_insertion_point) const
+// NOTE: This walks over the code points before the one it returns, so it's only meant for looking a code point or two ahead.
+Optional<u32> HTMLTokenizer::peek_code_point(ssize_t offset, StopAtInsertionPoint stop_at_insertion_point)
 {
-    auto it = m_current_offset + offset;
-    if (it >= static_cast<ssize_t>(m_decoded_input.size()))
+    // NOTE: A code point takes up to four bytes, so this is enough input to reach the requested one.
+    make_input_readable((offset + 1) * 4, stop_at_insertion_point);
+
+    auto input_size = static_cast<ssize_t>(m_input.size());
+    auto it = m_current_offset;
+    for (ssize_t i = 0; i < offset && it < input_size; ++i)
+        it = offset_after_code_point_at(it);
+    if (it >= input_size)
         return {};
     if (stop_at_insertion_point == StopAtInsertionPoint::Yes
         && m_insertion_point.defined
         && it >= m_insertion_point.position) {
         return {};
     }
-    return m_decoded_input[it];
+    return code_point_at(it);
+}
+
+// Consumes the code points from the current offset up to (but not including) the next one of the given ASCII
+// characters, the insertion point, or the end of the input, and returns them. The caller must have already dealt
+// with any state-specific handling of these code points, as they don't go through the state machine.
+StringView HTMLTokenizer::consume_run_until_any_of(ReadonlySpan<char> stop_characters, StopAtInsertionPoint stop_at_insertion_point, size_t max_length)
+{
+    auto bytes = m_input;
+    auto end = bytes.size();
+    if (stop_at_insertion_point == StopAtInsertionPoint::Yes && m_insertion_point.defined)
+        end = min(end, static_cast<size_t>(m_insertion_point.position));
+
+    auto start = static_cast<size_t>(m_current_offset);
+    if (start >= end)
+        return {};
+
+    if (end - start > max_length) {
+        end = start + max_length;
+        // Don't split a multi-byte code point.
+        while (end > start && is_utf8_continuation_byte(bytes[end]))
+            --end;
+    }
+
+    auto run_end = find_first_of_ascii(bytes.trim(end), start, stop_characters).value_or(end);
+    if (run_end == start)
+        return {};
+
+    StringView run { bytes.slice(start, run_end - start) };
+    if (!m_source_positions.is_empty()) {
+        auto position = m_source_positions.last();
+        for (auto byte : run.bytes()) {
+            if (byte == '\n') {
+                position.column = 0;
+                position.line++;
+            } else if (!is_utf8_continuation_byte(byte)) {
+                position.column++;
+            }
+        }
+        m_source_positions.append(position);
+    }
+
+    m_prev_offset = static_cast<ssize_t>(run_end - 1);
+    while (is_utf8_continuation_byte(bytes[m_prev_offset]))
+        --m_prev_offset;
+    m_current_offset = static_cast<ssize_t>(run_end);
+    return run;
+}
+
+// Queues up a character token for each code point in the run of code points that the data state would emit as-is.
+void HTMLTokenizer::queue_character_tokens_for_run(StopAtInsertionPoint stop_at_insertion_point)
+{
+    static constexpr Array data_state_stop_characters { '&', '<', '\0', '\r' };
+    // NOTE: Keep batches small, so we don't end up with a huge queue of tokens for a large text node.
+    static constexpr size_t max_run_length = 64;
+
+    auto position = nth_last_position(0);
+    auto run = consume_run_until_any_of(data_state_stop_characters, stop_at_insertion_point, max_run_length);
+    for (auto code_point : Utf8View { run }) {
+        if (code_point == '\n') {
+            position.column = 0;
+            position.line++;
+        } else {
+            position.column++;
+        }
+        auto token = HTMLToken::make_character(code_point);
+        token.set_start_position({}, position);
+        m_queued_tokens.enqueue(move(token));
+    }
 }
 
 HTMLToken::Position HTMLTokenizer::nth_last_position(size_t n)
@@ -266,6 +379,10 @@ Optional<HTMLToken> HTMLTokenizer::next_token(StopAtInsertionPoint stop_at_inser
         m_source_positions.clear_with_capacity();
         m_source_positions.append(move(last_position));
     }
+    // NOTE: Unless we're stopping at the insertion point, the state machine may look ahead past it, so make sure that
+    //       the rest of the input stream is readable.
+    if (!(stop_at_insertion_point == StopAtInsertionPoint::Yes && m_insertion_point.defined))
+        close_input_gap();
 _StartOfFunction:
     if (!m_queued_tokens.is_empty())
         return m_queued_tokens.dequeue();
@@ -302,7 +419,13 @@ _StartOfFunction:
                 }
                 ANYTHING_ELSE
                 {
-                    EMIT_CURRENT_CHARACTER;
+                    create_new_token(HTMLToken::Type::Character);
+                    m_current_token.set_code_point(current_input_character.value());
+                    m_queued_tokens.enqueue(move(m_current_token));
+                    // OPTIMIZATION: Queue up the ordinary characters that follow as well, so that they don't each
+                    //               have to make a trip through the state machine.
+                    queue_character_tokens_for_run(stop_at_insertion_point);
+                    return m_queued_tokens.dequeue();
                 }
             }
             END_STATE
@@ -1315,6 +1438,9 @@ _StartOfFunction:
                 ANYTHING_ELSE
                 {
                     m_current_builder.append_code_point(current_input_character.value());
+                    // OPTIMIZATION: Append the ordinary characters that follow in one go.
+                    static constexpr Array stop_characters { '"', '&', '\0', '\r' };
+                    m_current_builder.append(consume_run_until_any_of(stop_characters, stop_at_insertion_point));
                     continue;
                 }
             }
@@ -1347,6 +1473,9 @@ _StartOfFunction:
                 ANYTHING_ELSE
                 {
                     m_current_builder.append_code_point(current_input_character.value());
+                    // OPTIMIZATION: Append the ordinary characters that follow in one go.
+                    static constexpr Array stop_characters { '\'', '&', '\0', '\r' };
+                    m_current_builder.append(consume_run_until_any_of(stop_characters, stop_at_insertion_point));
                     continue;
                 }
             }
@@ -1712,9 +1841,9 @@ _StartOfFunction:
                     // of the input and try to match a named character reference all-at-once. This is worthwhile
                     // because matching all-at-once ends up being more efficient.
                     auto starting_consumed_count = m_temporary_buffer.size();
-                    auto remaining_source = m_decoded_input.span().slice(m_prev_offset);
+                    auto remaining_source = StringView { m_input }.substring_view(m_prev_offset);
 
-                    for (auto const code_point : remaining_source) {
+                    for (auto const code_point : Utf8View { remaining_source }) {
                         if (m_named_character_reference_matcher.try_consume_code_point(code_point)) {
                             m_temporary_buffer.append(code_point);
                         } else {
@@ -1735,6 +1864,7 @@ _StartOfFunction:
                 // have lead to `&notindot;`) would need to backtrack back to `&not`.
                 auto overconsumed_code_points = m_named_character_reference_matcher.overconsumed_code_points();
                 if (overconsumed_code_points > 0) {
+                    // NOTE: Named character references only ever consume ASCII, so code points and bytes line up here.
                     restore_to(m_current_offset - overconsumed_code_points);
                     m_temporary_buffer.resize_and_keep_capacity(m_temporary_buffer.size() - overconsumed_code_points);
                 }
@@ -2843,23 +2973,30 @@ _StartOfFunction:
 
 HTMLTokenizer::ConsumeNextResult HTMLTokenizer::consume_next_if_match(StringView string, StopAtInsertionPoint stop_at_insertion_point, CaseSensitivity case_sensitivity)
 {
+    // NOTE: The strings we match are all ASCII, so we can compare them byte by byte: any byte of a multi-byte code point
+    //       in the input is outside the ASCII range, and won't match.
+    VERIFY(string.is_ascii());
+
+    make_input_readable(static_cast<ssize_t>(string.length()), stop_at_insertion_point);
+
+    auto available_length = static_cast<ssize_t>(m_input.size()) - m_current_offset;
+    if (stop_at_insertion_point == StopAtInsertionPoint::Yes && m_insertion_point.defined)
+        available_length = min(available_length, m_insertion_point.position - m_current_offset);
+
     for (size_t i = 0; i < string.length(); ++i) {
-        auto code_point = peek_code_point(i, stop_at_insertion_point);
-        if (!code_point.has_value()) {
+        if (static_cast<ssize_t>(i) >= available_length) {
             if (StopAtInsertionPoint::Yes == stop_at_insertion_point) {
                 return ConsumeNextResult::RanOutOfCharacters;
             }
             return ConsumeNextResult::NotConsumed;
         }
-        // FIXME: This should be more Unicode-aware.
+        auto byte = m_input[m_current_offset + i];
         if (case_sensitivity == CaseSensitivity::CaseInsensitive) {
-            if (code_point.value() < 0x80) {
-                if (to_ascii_lowercase(code_point.value()) != to_ascii_lowercase(string[i]))
-                    return ConsumeNextResult::NotConsumed;
-                continue;
-            }
+            if (to_ascii_lowercase(byte) != to_ascii_lowercase(string[i]))
+                return ConsumeNextResult::NotConsumed;
+            continue;
         }
-        if (code_point.value() != (u32)string[i])
+        if (byte != static_cast<u8>(string[i]))
             return ConsumeNextResult::NotConsumed;
     }
     skip(string.length());
@@ -2876,7 +3013,6 @@ void HTMLTokenizer::create_new_token(HTMLToken::Type type)
 
 HTMLTokenizer::HTMLTokenizer()
 {
-    m_decoded_input = {};
     m_current_offset = 0;
     m_prev_offset = 0;
     m_source_positions.empend(0u, 0u);
@@ -2887,34 +3023,123 @@ HTMLTokenizer::HTMLTokenizer(StringView input, ByteString const& encoding)
     auto decoder = TextCodec::decoder_for(encoding);
     VERIFY(decoder.has_value());
     m_source = MUST(decoder->to_utf8(input));
-    m_decoded_input.ensure_capacity(m_source.bytes().size());
-    for (auto code_point : m_source.code_points())
-        m_decoded_input.append(code_point);
+    m_input = m_source.bytes();
     m_current_offset = 0;
     m_prev_offset = 0;
     m_source_positions.empend(0u, 0u);
 }
 
+StringView HTMLTokenizer::unconsumed_input()
+{
+    close_input_gap();
+    return StringView { m_input.slice(m_current_offset) };
+}
+
 void HTMLTokenizer::insert_input_at_insertion_point(StringView input)
 {
-    Vector<u32> new_decoded_input;
-    new_decoded_input.ensure_capacity(m_decoded_input.size() + input.length());
+    VERIFY(Utf8View { input }.validate());
+    if (input.is_empty())
+        return;
+
+    make_room_at_insertion_point(input.length());
 
-    auto before = m_decoded_input.span().slice(0, m_insertion_point.position);
-    new_decoded_input.append(before.data(), before.size());
+    auto gap_start = static_cast<size_t>(m_insertion_point.position);
+    input.bytes().copy_to(m_input_buffer.span().slice(gap_start));
+    m_input = m_input_buffer.span().trim(gap_start + input.length());
+
+    m_insertion_point.position += input.length();
+}
+
+// Returns how much of the start of m_input the tokenizer won't need to look at anymore.
+ssize_t HTMLTokenizer::discardable_input_length() const
+{
+    // NOTE: The tokenizer may still go back a little from where it is, to reconsume the current code point or after
+    //       overconsuming a named character reference.
+    static constexpr ssize_t max_lookbehind = 64;
+
+    auto length = min(m_prev_offset, m_current_offset) - max_lookbehind;
+    if (m_insertion_point.defined)
+        length = min(length, m_insertion_point.position);
+    if (m_old_insertion_point.defined)
+        length = min(length, m_old_insertion_point.position);
+    return max(length, 0);
+}
+
+void HTMLTokenizer::shift_input_offsets(ssize_t delta)
+{
+    m_current_offset += delta;
+    m_prev_offset += delta;
+    m_insertion_point.position += delta;
+    m_old_insertion_point.position += delta;
+    m_input_offset_in_stream -= delta;
+}
 
-    auto utf8_to_insert = MUST(String::from_utf8(input));
-    ssize_t code_points_inserted = 0;
-    for (auto code_point : utf8_to_insert.code_points()) {
-        new_decoded_input.append(code_point);
-        ++code_points_inserted;
+// Makes sure that the given number of bytes after the current offset can be read, if the input stream has that many.
+void HTMLTokenizer::make_input_readable(ssize_t length, StopAtInsertionPoint stop_at_insertion_point)
+{
+    if (!has_input_after_gap() || m_current_offset + length <= static_cast<ssize_t>(m_input.size()))
+        return;
+
+    // NOTE: If we're going to stop at an insertion point before the gap, we won't read past it anyway.
+    if (stop_at_insertion_point == StopAtInsertionPoint::Yes && m_insertion_point.defined && m_insertion_point.position <= static_cast<ssize_t>(m_input.size()))
+        return;
+
+    close_input_gap();
+}
+
+// Moves the input before the gap up against the input after it, so that the whole input stream is readable.
+void HTMLTokenizer::close_input_gap()
+{
+    if (!has_input_gap())
+        return;
+
+    auto keep_from = static_cast<size_t>(discardable_input_length());
+    auto length = m_input.size() - keep_from;
+    auto new_start = m_input_gap_end - length;
+    memmove(m_input_buffer.data() + new_start, m_input_buffer.data() + keep_from, length);
+    shift_input_offsets(static_cast<ssize_t>(new_start - keep_from));
+
+    m_input_gap_end = m_input_buffer.size();
+    m_input = m_input_buffer.span();
+}
+
+// Puts a gap of at least the given length at the insertion point.
+void HTMLTokenizer::make_room_at_insertion_point(size_t length)
+{
+    VERIFY(m_insertion_point.defined);
+
+    if (has_input_gap() && m_insertion_point.position == static_cast<ssize_t>(m_input.size()) && m_input_gap_end - m_input.size() >= length)
+        return;
+
+    close_input_gap();
+
+    auto keep_from = static_cast<size_t>(discardable_input_length());
+    auto insertion_point = static_cast<size_t>(m_insertion_point.position);
+    auto length_before_gap = insertion_point - keep_from;
+
+    // If there's enough consumed input at the start of the buffer, move the input before the insertion point there.
+    if (!m_input_buffer.is_empty() && keep_from >= length) {
+        memmove(m_input_buffer.data(), m_input_buffer.data() + keep_from, length_before_gap);
+        shift_input_offsets(-static_cast<ssize_t>(keep_from));
+        m_input_gap_end = insertion_point;
+        m_input = m_input_buffer.span().trim(length_before_gap);
+        return;
     }
 
-    auto after = m_decoded_input.span().slice(m_insertion_point.position);
-    new_decoded_input.append(after.data(), after.size());
-    m_decoded_input = move(new_decoded_input);
+    // Otherwise, make a new buffer, leaving out the consumed input. The gap grows along with the input, so that
+    // reallocating doesn't happen for every insertion.
+    static constexpr size_t minimum_gap_length = 4 * KiB;
+    auto input_after_gap = m_input.slice(insertion_point);
+    auto gap_length = max(length, max(minimum_gap_length, (length_before_gap + input_after_gap.size()) / 4));
+
+    auto new_buffer = MUST(ByteBuffer::create_uninitialized(length_before_gap + gap_length + input_after_gap.size()));
+    m_input.slice(keep_from, length_before_gap).copy_to(new_buffer.span());
+    input_after_gap.copy_to(new_buffer.span().slice(length_before_gap + gap_length));
 
-    m_insertion_point.position += code_points_inserted;
+    m_input_buffer = move(new_buffer);
+    shift_input_offsets(-static_cast<ssize_t>(keep_from));
+    m_input_gap_end = length_before_gap + gap_length;
+    m_input = m_input_buffer.span().trim(length_before_gap);
 }
 
 void HTMLTokenizer::insert_eof()
@@ -2970,9 +3195,9 @@ bool HTMLTokenizer::consumed_as_part_of_an_attribute() const
 
 void HTMLTokenizer::restore_to(ssize_t new_iterator)
 {
-    auto diff = m_current_offset - new_iterator;
-    if (diff > 0) {
-        for (ssize_t i = 0; i < diff; ++i) {
+    if (new_iterator < m_current_offset) {
+        // NOTE: Offsets are in bytes, but positions are tracked per code point.
+        for (auto offset = new_iterator; offset < m_current_offset; offset = offset_after_code_point_at(offset)) {
             if (!m_source_positions.is_empty())
                 m_source_positions.take_last();
         }
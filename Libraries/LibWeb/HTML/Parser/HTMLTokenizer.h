@@ -7,6 +7,8 @@
 
 #pragma once
 
+#include <AK/ByteBuffer.h>
+#include <AK/Noncopyable.h>
 #include <AK/Queue.h>
 #include <AK/StringBuilder.h>
 #include <AK/StringView.h>
@@ -102,6 +104,9 @@ namespace Web::HTML {
     __ENUMERATE_TOKENIZER_STATE(NumericCharacterReferenceEnd)
 
 class WEB_API HTMLTokenizer {
+    AK_MAKE_NONCOPYABLE(HTMLTokenizer);
+    AK_MAKE_NONMOVABLE(HTMLTokenizer);
+
 public:
     explicit HTMLTokenizer();
     explicit HTMLTokenizer(StringView input, ByteString const& encoding);
@@ -131,11 +136,20 @@ public:
 
     auto const& source() const { return m_source; }
 
+    // The part of the input stream that hasn't been consumed yet, and the length of the part before it.
+    StringView unconsumed_input();
+    size_t consumed_input_length() const { return m_input_offset_in_stream + m_current_offset; }
+
     void insert_input_at_insertion_point(StringView input);
     void insert_eof();
     bool is_eof_inserted();
 
     bool is_insertion_point_defined() const { return m_insertion_point.defined; }
+    size_t insertion_point_offset_in_stream() const
+    {
+        VERIFY(m_insertion_point.defined);
+        return m_input_offset_in_stream + m_insertion_point.position;
+    }
     bool is_insertion_point_reached()
     {
         return m_insertion_point.defined && m_current_offset >= m_insertion_point.position;
@@ -155,7 +169,20 @@ public:
 private:
     void skip(size_t count);
     Optional<u32> next_code_point(StopAtInsertionPoint);
-    Optional<u32> peek_code_point(ssize_t offset, StopAtInsertionPoint) const;
+    Optional<u32> peek_code_point(ssize_t offset, StopAtInsertionPoint);
+    u32 code_point_at(ssize_t offset) const;
+    ssize_t offset_after_code_point_at(ssize_t offset) const;
+
+    bool has_input_gap() const { return m_input.size() < m_input_buffer.size(); }
+    bool has_input_after_gap() const { return m_input_gap_end < m_input_buffer.size(); }
+    ssize_t discardable_input_length() const;
+    void shift_input_offsets(ssize_t delta);
+    void make_input_readable(ssize_t length, StopAtInsertionPoint);
+    void close_input_gap();
+    void make_room_at_insertion_point(size_t length);
+
+    StringView consume_run_until_any_of(ReadonlySpan<char> stop_characters, StopAtInsertionPoint, size_t max_length = NumericLimits<size_t>::max());
+    void queue_character_tokens_for_run(StopAtInsertionPoint);
 
     enum class ConsumeNextResult {
         Consumed,
@@ -197,7 +224,19 @@ private:
     Vector<u32> m_temporary_buffer;
 
     String m_source;
-    Vector<u32> m_decoded_input;
+
+    // The input stream, as UTF-8. All offsets into it are byte offsets. Until document.write() inserts something into
+    // it, this is simply m_source. After that, the input stream lives in m_input_buffer, with a gap in it that insertions
+    // go into: m_input is the part of the buffer before the gap, and the rest of the input stream follows the gap at
+    // m_input_gap_end. The gap is kept at the insertion point, so inserting doesn't have to move the input after it.
+    // Once the tokenizer needs to read past the gap, the input before the gap is moved up against the rest instead,
+    // and the input that has been consumed by then becomes room for the next gap.
+    ReadonlyBytes m_input;
+    ByteBuffer m_input_buffer;
+    size_t m_input_gap_end { 0 };
+
+    // Where m_input starts in the input stream, as the consumed input is dropped from the front of m_input_buffer.
+    ssize_t m_input_offset_in_stream { 0 };
 
     struct InsertionPoint {
         ssize_t position { 0 };
@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibJS/Runtime/Realm.h>
+#include <LibWeb/HTML/PartialBitmapDecodedImageData.h>
+
+namespace Web::HTML {
+
+GC_DEFINE_ALLOCATOR(PartialBitmapDecodedImageData);
+
+GC::Ref<PartialBitmapDecodedImageData> PartialBitmapDecodedImageData::create(JS::Realm& realm, NonnullRefPtr<Gfx::ImmutableBitmap> bitmap)
+{
+    return realm.create<PartialBitmapDecodedImageData>(move(bitmap));
+}
+
+PartialBitmapDecodedImageData::PartialBitmapDecodedImageData(NonnullRefPtr<Gfx::ImmutableBitmap> bitmap)
+    : m_bitmap(move(bitmap))
+{
+}
+
+PartialBitmapDecodedImageData::~PartialBitmapDecodedImageData() = default;
+
+RefPtr<Gfx::ImmutableBitmap> PartialBitmapDecodedImageData::bitmap(size_t frame_index, Gfx::IntSize) const
+{
+    if (frame_index > 0)
+        return nullptr;
+    return m_bitmap;
+}
+
+Optional<CSSPixels> PartialBitmapDecodedImageData::intrinsic_width() const
+{
+    return m_bitmap->width();
+}
+
+Optional<CSSPixels> PartialBitmapDecodedImageData::intrinsic_height() const
+{
+    return m_bitmap->height();
+}
+
+Optional<CSSPixelFraction> PartialBitmapDecodedImageData::intrinsic_aspect_ratio() const
+{
+    return CSSPixels(m_bitmap->width()) / CSSPixels(m_bitmap->height());
+}
+
+}
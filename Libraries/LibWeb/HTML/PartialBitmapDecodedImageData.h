@@ -0,0 +1,42 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <LibGfx/ImmutableBitmap.h>
+#include <LibWeb/HTML/DecodedImageData.h>
+
+namespace Web::HTML {
+
+// What can be shown of an image while its data is still arriving, until the whole image has been decoded.
+class PartialBitmapDecodedImageData final : public DecodedImageData {
+    GC_CELL(PartialBitmapDecodedImageData, DecodedImageData);
+    GC_DECLARE_ALLOCATOR(PartialBitmapDecodedImageData);
+
+public:
+    static GC::Ref<PartialBitmapDecodedImageData> create(JS::Realm&, NonnullRefPtr<Gfx::ImmutableBitmap>);
+    virtual ~PartialBitmapDecodedImageData() override;
+
+    void set_bitmap(NonnullRefPtr<Gfx::ImmutableBitmap> bitmap) { m_bitmap = move(bitmap); }
+
+    virtual RefPtr<Gfx::ImmutableBitmap> bitmap(size_t frame_index, Gfx::IntSize = {}) const override;
+    virtual int frame_duration(size_t) const override { return 0; }
+
+    virtual size_t frame_count() const override { return 1; }
+    virtual size_t loop_count() const override { return 0; }
+    virtual bool is_animated() const override { return false; }
+
+    virtual Optional<CSSPixels> intrinsic_width() const override;
+    virtual Optional<CSSPixels> intrinsic_height() const override;
+    virtual Optional<CSSPixelFraction> intrinsic_aspect_ratio() const override;
+
+private:
+    explicit PartialBitmapDecodedImageData(NonnullRefPtr<Gfx::ImmutableBitmap>);
+
+    NonnullRefPtr<Gfx::ImmutableBitmap> m_bitmap;
+};
+
+}
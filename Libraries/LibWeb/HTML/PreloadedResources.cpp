@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibWeb/DOM/Document.h>
+#include <LibWeb/Fetch/Fetching/Fetching.h>
+#include <LibWeb/Fetch/Infrastructure/FetchAlgorithms.h>
+#include <LibWeb/Fetch/Infrastructure/HTTP/Bodies.h>
+#include <LibWeb/Fetch/Infrastructure/HTTP/Responses.h>
+#include <LibWeb/HTML/PreloadedResources.h>
+#include <LibWeb/HTML/Window.h>
+#include <LibWeb/SRI/SRI.h>
+
+namespace Web::HTML {
+
+GC_DEFINE_ALLOCATOR(PreloadEntry);
+
+void PreloadEntry::visit_edges(Cell::Visitor& visitor)
+{
+    Base::visit_edges(visitor);
+    visitor.visit(response);
+    visitor.visit(on_response_available);
+}
+
+static bool is_equal(Vector<SRI::Metadata> const& a, Vector<SRI::Metadata> const& b)
+{
+    if (a.size() != b.size())
+        return false;
+    for (size_t i = 0; i < a.size(); ++i) {
+        if (a[i].algorithm != b[i].algorithm || a[i].base64_value != b[i].base64_value || a[i].options != b[i].options)
+            return false;
+    }
+    return true;
+}
+
+// https://html.spec.whatwg.org/multipage/links.html#consume-a-preloaded-resource
+bool consume_a_preloaded_resource(Window& window, URL::URL const& url, Optional<Fetch::Infrastructure::Request::Destination> destination, Fetch::Infrastructure::Request::Mode mode, Fetch::Infrastructure::Request::CredentialsMode credentials_mode, StringView integrity_metadata, GC::Ref<PreloadEntry::OnResponseAvailable> on_response_available)
+{
+    // 1. Let key be a preload key whose URL is url, destination is destination, mode is mode, and credentials mode is
+    //    credentialsMode.
+    PreloadKey key { url, destination, mode, credentials_mode };
+
+    // 2. Let preloads be window's associated Document's map of preloaded resources.
+    auto& preloads = window.associated_document().map_of_preloaded_resources();
+
+    // 3. If key does not exist in preloads, then return false.
+    auto it = preloads.find(key);
+    if (it == preloads.end())
+        return false;
+
+    // 4. Let entry be preloads[key].
+    auto entry = it->value;
+
+    // 5. Let consumerIntegrityMetadata be the result of parsing integrityMetadata.
+    auto consumer_integrity_metadata = SRI::parse_metadata(integrity_metadata);
+
+    // 6. Let preloadIntegrityMetadata be the result of parsing entry's integrity metadata.
+    auto preload_integrity_metadata = SRI::parse_metadata(entry->integrity_metadata);
+    if (consumer_integrity_metadata.is_error() || preload_integrity_metadata.is_error())
+        return false;
+
+    // 7. If none of the following conditions apply:
+    //    - consumerIntegrityMetadata is no metadata;
+    //    - consumerIntegrityMetadata is equal to preloadIntegrityMetadata;
+    //    then return false.
+    if (!consumer_integrity_metadata.value().is_empty() && !is_equal(consumer_integrity_metadata.value(), preload_integrity_metadata.value()))
+        return false;
+
+    // 8. Remove preloads[key].
+    preloads.remove(it);
+
+    // 9. If entry's response is null, then set entry's on response available to onResponseAvailable.
+    if (!entry->response)
+        entry->on_response_available = on_response_available;
+    // 10. Otherwise, call onResponseAvailable with entry's response.
+    else
+        on_response_available->function()(*entry->response);
+
+    // 11. Return true.
+    return true;
+}
+
+// https://html.spec.whatwg.org/multipage/parsing.html#speculative-fetch
+// NOTE: Speculative fetches go into the map of preloaded resources, so that the fetch made for the actual element
+//       later on can consume the response instead of going to the network again. The response handling mirrors
+//       that of the preload algorithm: https://html.spec.whatwg.org/multipage/links.html#preload
+void speculatively_fetch(DOM::Document& document, GC::Ref<Fetch::Infrastructure::Request> request)
+{
+    auto& realm = document.realm();
+
+    request->set_client(&document.relevant_settings_object());
+    request->set_priority(Fetch::Infrastructure::Request::Priority::Low);
+
+    PreloadKey key { request->url(), request->destination(), request->mode(), request->credentials_mode() };
+    auto& preloads = document.map_of_preloaded_resources();
+    if (preloads.contains(key))
+        return;
+
+    auto entry = realm.heap().allocate<PreloadEntry>();
+    entry->integrity_metadata = request->integrity_metadata();
+    entry->is_speculative = true;
+
+    Fetch::Infrastructure::FetchAlgorithms::Input fetch_algorithms_input {};
+    fetch_algorithms_input.process_response_consume_body = [document = GC::Ref { document }, entry](GC::Ref<Fetch::Infrastructure::Response> response, Fetch::Infrastructure::FetchAlgorithms::BodyBytes body_bytes) {
+        // 1. If bytesOrNull is a byte sequence, then set response's body to the first return value of safely
+        //    extracting bytesOrNull.
+        if (auto* bytes = body_bytes.get_pointer<ByteBuffer>())
+            response->set_body(Fetch::Infrastructure::byte_sequence_as_body(document->realm(), *bytes));
+        // 2. Otherwise, set response to a network error.
+        else
+            response = Fetch::Infrastructure::Response::network_error(document->realm().vm(), "Speculative fetch failed"_string);
+
+        // 3. If entry's on response available is null, then set entry's response to response; otherwise call entry's
+        //    on response available with response.
+        if (!entry->on_response_available)
+            entry->response = response;
+        else
+            entry->on_response_available->function()(response);
+    };
+
+    (void)Fetch::Fetching::fetch(realm, *request, Fetch::Infrastructure::FetchAlgorithms::create(realm.vm(), move(fetch_algorithms_input)));
+
+    // NOTE: This has to happen after starting the fetch, so that it doesn't end up consuming its own entry.
+    preloads.set(move(key), entry);
+}
+
+}
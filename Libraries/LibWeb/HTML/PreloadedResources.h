@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <LibGC/Function.h>
+#include <LibJS/Heap/Cell.h>
+#include <LibURL/URL.h>
+#include <LibWeb/Fetch/Infrastructure/HTTP/Requests.h>
+#include <LibWeb/Forward.h>
+
+namespace Web::HTML {
+
+// https://html.spec.whatwg.org/multipage/links.html#preload-key
+struct PreloadKey {
+    // URL, a URL
+    URL::URL url;
+
+    // destination, a string
+    Optional<Fetch::Infrastructure::Request::Destination> destination;
+
+    // mode, a request mode
+    Fetch::Infrastructure::Request::Mode mode;
+
+    // credentials mode, a credentials mode
+    Fetch::Infrastructure::Request::CredentialsMode credentials_mode;
+
+    [[nodiscard]] bool operator==(PreloadKey const&) const = default;
+};
+
+// https://html.spec.whatwg.org/multipage/links.html#preload-entry
+class PreloadEntry final : public JS::Cell {
+    GC_CELL(PreloadEntry, JS::Cell);
+    GC_DECLARE_ALLOCATOR(PreloadEntry);
+
+public:
+    using OnResponseAvailable = GC::Function<void(GC::Ref<Fetch::Infrastructure::Response>)>;
+
+    // integrity metadata, a string
+    String integrity_metadata;
+
+    // response, a response or null
+    GC::Ptr<Fetch::Infrastructure::Response> response;
+
+    // on response available, an algorithm accepting a response or null
+    GC::Ptr<OnResponseAvailable> on_response_available;
+
+    // NOTE: Whether this entry was made by the speculative HTML parser, rather than by a preload link.
+    bool is_speculative { false };
+
+private:
+    PreloadEntry() = default;
+
+    virtual void visit_edges(Cell::Visitor&) override;
+};
+
+bool consume_a_preloaded_resource(Window&, URL::URL const&, Optional<Fetch::Infrastructure::Request::Destination>, Fetch::Infrastructure::Request::Mode, Fetch::Infrastructure::Request::CredentialsMode, StringView integrity_metadata, GC::Ref<PreloadEntry::OnResponseAvailable>);
+void speculatively_fetch(DOM::Document&, GC::Ref<Fetch::Infrastructure::Request>);
+
+}
+
+namespace AK {
+
+template<>
+struct Traits<Web::HTML::PreloadKey> : public DefaultTraits<Web::HTML::PreloadKey> {
+    static unsigned hash(Web::HTML::PreloadKey const& key)
+    {
+        auto destination_hash = key.destination.has_value() ? to_underlying(*key.destination) + 1 : 0;
+        return pair_int_hash(Traits<URL::URL>::hash(key.url), pair_int_hash(destination_hash, pair_int_hash(to_underlying(key.mode), to_underlying(key.credentials_mode))));
+    }
+};
+
+}
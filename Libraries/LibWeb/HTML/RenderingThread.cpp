@@ -8,6 +8,7 @@
 #include <LibWeb/HTML/RenderingThread.h>
 #include <LibWeb/HTML/TraversableNavigable.h>
 #include <LibWeb/Painting/DisplayListPlayerSkia.h>
+#include <LibWeb/Painting/TiledRasterizer.h>
 
 namespace Web::HTML {
 
@@ -37,6 +38,12 @@ void RenderingThread::start(DisplayListPlayerType display_list_player_type)
 {
     m_display_list_player_type = display_list_player_type;
     VERIFY(m_skia_player);
+    if (display_list_player_type == DisplayListPlayerType::SkiaCPU) {
+        if (auto tiled_rasterizer = Painting::TiledRasterizer::create(); !tiled_rasterizer.is_error())
+            m_tiled_rasterizer = tiled_rasterizer.release_value();
+        else
+            dbgln("Unable to create tiled rasterizer, painting on a single thread: {}", tiled_rasterizer.error());
+    }
     m_thread = Threading::Thread::construct([this] {
         rendering_thread_loop();
         return static_cast<intptr_t>(0);
@@ -67,7 +74,11 @@ void RenderingThread::rendering_thread_loop()
             break;
         }
 
-        m_skia_player->execute(*task->display_list, move(task->scroll_state_snapshot_by_display_list), task->painting_surface);
+        // NOTE: Partial repaints only paint small parts of the frame, which aren't worth splitting up further.
+        bool painted_in_tiles = m_tiled_rasterizer && !task->partial_repaint.has_value()
+            && m_tiled_rasterizer->rasterize(*task->display_list, task->scroll_state_snapshot_by_display_list, *task->painting_surface);
+        if (!painted_in_tiles)
+            m_skia_player->execute(*task->display_list, move(task->scroll_state_snapshot_by_display_list), task->painting_surface, move(task->partial_repaint));
         if (m_exit)
             break;
         m_main_thread_event_loop.deferred_invoke([callback = move(task->callback)] {
@@ -76,10 +87,10 @@ void RenderingThread::rendering_thread_loop()
     }
 }
 
-void RenderingThread::enqueue_rendering_task(NonnullRefPtr<Painting::DisplayList> display_list, Painting::ScrollStateSnapshotByDisplayList&& scroll_state_snapshot_by_display_list, NonnullRefPtr<Gfx::PaintingSurface> painting_surface, Function<void()>&& callback)
+void RenderingThread::enqueue_rendering_task(NonnullRefPtr<Painting::DisplayList> display_list, Painting::ScrollStateSnapshotByDisplayList&& scroll_state_snapshot_by_display_list, NonnullRefPtr<Gfx::PaintingSurface> painting_surface, Optional<Painting::PartialRepaint> partial_repaint, Function<void()>&& callback)
 {
     Threading::MutexLocker const locker { m_rendering_task_mutex };
-    m_rendering_tasks.enqueue(Task { move(display_list), move(scroll_state_snapshot_by_display_list), move(painting_surface), move(callback) });
+    m_rendering_tasks.enqueue(Task { move(display_list), move(scroll_state_snapshot_by_display_list), move(painting_surface), move(partial_repaint), move(callback) });
     m_rendering_task_ready_wake_condition.signal();
 }
 
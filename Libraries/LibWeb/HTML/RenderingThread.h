@@ -14,6 +14,7 @@
 #include <LibThreading/Thread.h>
 #include <LibWeb/Forward.h>
 #include <LibWeb/Page/Page.h>
+#include <LibWeb/Painting/DamageRegion.h>
 
 namespace Web::HTML {
 
@@ -27,7 +28,7 @@ public:
 
     void start(DisplayListPlayerType);
     void set_skia_player(OwnPtr<Painting::DisplayListPlayerSkia>&& player);
-    void enqueue_rendering_task(NonnullRefPtr<Painting::DisplayList>, Painting::ScrollStateSnapshotByDisplayList&&, NonnullRefPtr<Gfx::PaintingSurface>, Function<void()>&& callback);
+    void enqueue_rendering_task(NonnullRefPtr<Painting::DisplayList>, Painting::ScrollStateSnapshotByDisplayList&&, NonnullRefPtr<Gfx::PaintingSurface>, Optional<Painting::PartialRepaint>, Function<void()>&& callback);
 
 private:
     void rendering_thread_loop();
@@ -37,6 +38,9 @@ private:
 
     OwnPtr<Painting::DisplayListPlayerSkia> m_skia_player;
 
+    // Only used with the CPU player, to paint whole frames on several threads at once.
+    OwnPtr<Painting::TiledRasterizer> m_tiled_rasterizer;
+
     RefPtr<Threading::Thread> m_thread;
     Atomic<bool> m_exit { false };
     NonnullRefPtr<Core::Promise<NonnullRefPtr<Core::EventReceiver>>> m_main_thread_exit_promise;
@@ -45,6 +49,7 @@ private:
         NonnullRefPtr<Painting::DisplayList> display_list;
         Painting::ScrollStateSnapshotByDisplayList scroll_state_snapshot_by_display_list;
         NonnullRefPtr<Gfx::PaintingSurface> painting_surface;
+        Optional<Painting::PartialRepaint> partial_repaint;
         Function<void()> callback;
     };
     // NOTE: Queue will only contain multiple items in case tasks were scheduled by screenshot requests.
@@ -6,6 +6,7 @@
 
 #include <LibGfx/Bitmap.h>
 #include <LibWeb/Bindings/PrincipalHostDefined.h>
+#include <LibWeb/DOM/Document.h>
 #include <LibWeb/Fetch/Fetching/Fetching.h>
 #include <LibWeb/Fetch/Infrastructure/FetchAlgorithms.h>
 #include <LibWeb/Fetch/Infrastructure/FetchController.h>
@@ -13,8 +14,10 @@
 #include <LibWeb/Fetch/Infrastructure/HTTP/Statuses.h>
 #include <LibWeb/HTML/AnimatedBitmapDecodedImageData.h>
 #include <LibWeb/HTML/DecodedImageData.h>
+#include <LibWeb/HTML/PartialBitmapDecodedImageData.h>
 #include <LibWeb/HTML/SharedResourceRequest.h>
 #include <LibWeb/Page/Page.h>
+#include <LibWeb/Painting/Paintable.h>
 #include <LibWeb/Platform/ImageCodecPlugin.h>
 #include <LibWeb/SVG/SVGDecodedImageData.h>
 
@@ -59,8 +62,11 @@ void SharedResourceRequest::visit_edges(JS::Cell::Visitor& visitor)
     for (auto& callback : m_callbacks) {
         visitor.visit(callback.on_finish);
         visitor.visit(callback.on_fail);
+        visitor.visit(callback.on_partial_image);
+        visitor.visit(callback.display_size);
     }
     visitor.visit(m_image_data);
+    visitor.visit(m_partial_image_data);
 }
 
 GC::Ptr<DecodedImageData> SharedResourceRequest::image_data() const
@@ -68,6 +74,11 @@ GC::Ptr<DecodedImageData> SharedResourceRequest::image_data() const
     return m_image_data;
 }
 
+GC::Ptr<DecodedImageData> SharedResourceRequest::partial_image_data() const
+{
+    return m_partial_image_data;
+}
+
 GC::Ptr<Fetch::Infrastructure::FetchController> SharedResourceRequest::fetch_controller()
 {
     return m_fetch_controller.ptr();
@@ -78,6 +89,11 @@ void SharedResourceRequest::set_fetch_controller(GC::Ptr<Fetch::Infrastructure::
     m_fetch_controller = move(fetch_controller);
 }
 
+static bool is_svg_image(StringView mime_type, URL::URL const& url)
+{
+    return mime_type == "image/svg+xml"sv || url.basename().ends_with(".svg"sv);
+}
+
 void SharedResourceRequest::fetch_resource(JS::Realm& realm, GC::Ref<Fetch::Infrastructure::Request> request)
 {
     Fetch::Infrastructure::FetchAlgorithms::Input fetch_algorithms_input {};
@@ -86,22 +102,56 @@ void SharedResourceRequest::fetch_resource(JS::Realm& realm, GC::Ref<Fetch::Infr
         //        https://github.com/whatwg/html/issues/9355
         response = response->unsafe_response();
 
-        auto process_body = GC::create_function(heap(), [this, request, response](ByteBuffer data) {
-            auto extracted_mime_type = response->header_list()->extract_mime_type();
-            auto mime_type = extracted_mime_type.has_value() ? extracted_mime_type.value().essence().bytes_as_string_view() : StringView {};
-            handle_successful_fetch(request->url(), mime_type, move(data));
-        });
+        // Check for failed fetch response
+        if (!Fetch::Infrastructure::is_ok_status(response->status()) || !response->body()) {
+            handle_failed_fetch();
+            return;
+        }
+
+        auto extracted_mime_type = response->header_list()->extract_mime_type();
+        auto mime_type = extracted_mime_type.has_value() ? extracted_mime_type.value().essence() : String {};
+
         auto process_body_error = GC::create_function(heap(), [this](JS::Value) {
             handle_failed_fetch();
         });
 
-        // Check for failed fetch response
-        if (!Fetch::Infrastructure::is_ok_status(response->status()) || !response->body()) {
-            handle_failed_fetch();
+        if (!is_svg_image(mime_type.bytes_as_string_view(), request->url()))
+            m_incremental_decoder = Web::Platform::ImageCodecPlugin::the().start_incremental_decode();
+
+        if (!m_incremental_decoder) {
+            auto process_body = GC::create_function(heap(), [this, request, mime_type](ByteBuffer data) {
+                handle_successful_fetch(request->url(), mime_type.bytes_as_string_view(), move(data));
+            });
+            response->body()->fully_read(realm, process_body, process_body_error, GC::Ref { realm.global_object() });
             return;
         }
 
-        response->body()->fully_read(realm, process_body, process_body_error, GC::Ref { realm.global_object() });
+        m_incremental_decoder->on_partial_image_decoded = [this](NonnullRefPtr<Gfx::Bitmap> bitmap, Gfx::ColorSpace const& color_space) {
+            handle_partial_image(move(bitmap), color_space);
+        };
+
+        auto process_body_chunk = GC::create_function(heap(), [this](ByteBuffer chunk) {
+            if (m_state != State::Fetching)
+                return;
+            if (m_incremental_decoder->append_encoded_data(chunk.bytes()).is_error()) {
+                m_incremental_decoder = nullptr;
+                handle_failed_fetch();
+            }
+        });
+        auto process_end_of_body = GC::create_function(heap(), [this, request, mime_type] {
+            if (m_state != State::Fetching)
+                return;
+            // NOTE: The encoded data has been kept in the buffer that is shared with the image decoder until now. We need
+            //       our own copy of it, in case the image has to be decoded again later.
+            auto data = ByteBuffer::copy(m_incremental_decoder->encoded_data());
+            if (data.is_error()) {
+                m_incremental_decoder = nullptr;
+                handle_failed_fetch();
+                return;
+            }
+            handle_successful_fetch(request->url(), mime_type.bytes_as_string_view(), data.release_value());
+        });
+        response->body()->incrementally_read(process_body_chunk, process_end_of_body, process_body_error, GC::Ref { realm.global_object() });
     };
 
     m_state = State::Fetching;
@@ -115,7 +165,7 @@ void SharedResourceRequest::fetch_resource(JS::Realm& realm, GC::Ref<Fetch::Infr
     set_fetch_controller(fetch_controller);
 }
 
-void SharedResourceRequest::add_callbacks(Function<void()> on_finish, Function<void()> on_fail)
+void SharedResourceRequest::add_callbacks(Function<void()> on_finish, Function<void()> on_fail, Function<void()> on_partial_image, Function<Optional<Gfx::IntSize>()> display_size)
 {
     if (m_state == State::Finished) {
         if (on_finish)
@@ -134,6 +184,13 @@ void SharedResourceRequest::add_callbacks(Function<void()> on_finish, Function<v
         callbacks.on_finish = GC::create_function(vm().heap(), move(on_finish));
     if (on_fail)
         callbacks.on_fail = GC::create_function(vm().heap(), move(on_fail));
+    if (on_partial_image)
+        callbacks.on_partial_image = GC::create_function(vm().heap(), move(on_partial_image));
+    if (display_size)
+        callbacks.display_size = GC::create_function(vm().heap(), move(display_size));
+
+    if (m_partial_image_data && callbacks.on_partial_image)
+        callbacks.on_partial_image->function()();
 
     m_callbacks.append(move(callbacks));
 }
@@ -143,9 +200,7 @@ void SharedResourceRequest::handle_successful_fetch(URL::URL const& url_string,
     // AD-HOC: At this point, things gets very ad-hoc.
     // FIXME: Bring this closer to spec.
 
-    bool const is_svg_image = mime_type == "image/svg+xml"sv || url_string.basename().ends_with(".svg"sv);
-
-    if (is_svg_image) {
+    if (is_svg_image(mime_type, url_string)) {
         auto result = SVG::SVGDecodedImageData::create(m_document->realm(), m_page, url_string, data);
         if (result.is_error()) {
             handle_failed_fetch();
@@ -156,15 +211,41 @@ void SharedResourceRequest::handle_successful_fetch(URL::URL const& url_string,
         return;
     }
 
-    auto handle_successful_bitmap_decode = [strong_this = GC::Root(*this)](Web::Platform::DecodedImage& result) -> ErrorOr<void> {
+    // NOTE: We hold on to the encoded data, so that the image can be decoded again if its frames get discarded. Images
+    //       whose animation frames are decoded lazily need it too, in case the image decoder goes away along with theirs.
+    auto handle_successful_bitmap_decode = [strong_this = GC::Root(*this), encoded_data = data](Web::Platform::DecodedImage& result) mutable -> ErrorOr<void> {
         Vector<AnimatedBitmapDecodedImageData::Frame> frames;
+        frames.ensure_capacity(max<size_t>(result.frame_count, result.frames.size()));
         for (auto& frame : result.frames) {
-            frames.append(AnimatedBitmapDecodedImageData::Frame {
+            frames.unchecked_append(AnimatedBitmapDecodedImageData::Frame {
                 .bitmap = Gfx::ImmutableBitmap::create(*frame.bitmap, Gfx::AlphaType::Premultiplied, result.color_space),
                 .duration = static_cast<int>(frame.duration),
             });
         }
-        strong_this->m_image_data = AnimatedBitmapDecodedImageData::create(strong_this->m_document->realm(), move(frames), result.loop_count, result.is_animated).release_value_but_fixme_should_propagate_errors();
+
+        // NOTE: Until we learn the actual durations of the frames that are yet to be decoded, assume they match the first.
+        while (frames.size() < result.frame_count)
+            frames.unchecked_append({ .bitmap = nullptr, .duration = frames.first().duration });
+
+        auto image_data = AnimatedBitmapDecodedImageData::create(strong_this->m_document->realm(), move(frames), result.natural_size, result.loop_count, result.is_animated, move(encoded_data), move(result.frame_decoder)).release_value_but_fixme_should_propagate_errors();
+        image_data->set_on_frames_decoded(GC::create_function(strong_this->heap(), [document = strong_this->m_document, image_data] {
+            image_data->for_each_painting_element([](DOM::Element& element) {
+                if (auto* paintable = element.paintable())
+                    paintable->set_needs_display();
+            });
+
+            // NOTE: We can't tell who else was handed less than they asked for (a CSS background, an SVG <image>, ...), so
+            //       everything is painted again for them.
+            if (image_data->take_handed_out_incomplete_bitmap())
+                document->set_needs_display();
+        }));
+        image_data->set_on_frames_discarded(GC::create_function(strong_this->heap(), [image_data] {
+            image_data->for_each_painting_element([](DOM::Element& element) {
+                if (auto* paintable = element.paintable())
+                    element.document().invalidate_display_list_for(*paintable);
+            });
+        }));
+        strong_this->m_image_data = image_data;
         strong_this->handle_successful_resource_load();
         return {};
     };
@@ -173,12 +254,63 @@ void SharedResourceRequest::handle_successful_fetch(URL::URL const& url_string,
         strong_this->handle_failed_fetch();
     };
 
-    (void)Web::Platform::ImageCodecPlugin::the().decode_image(data.bytes(), move(handle_successful_bitmap_decode), move(handle_failed_decode));
+    // NOTE: If we already know how large the image is going to be displayed, there's no point in decoding it at a larger
+    //       size. If it turns out to be displayed larger after all, it's decoded again at that size.
+    auto ideal_size = ideal_size_to_decode_at();
+
+    // NOTE: If we've been decoding the image as its data arrived, the image decoder already has all of that data.
+    if (auto incremental_decoder = move(m_incremental_decoder)) {
+        (void)incremental_decoder->finish(move(handle_successful_bitmap_decode), move(handle_failed_decode), ideal_size, Web::Platform::AnimationFrameDecoding::Lazy);
+        return;
+    }
+
+    (void)Web::Platform::ImageCodecPlugin::the().decode_image(data.bytes(), move(handle_successful_bitmap_decode), move(handle_failed_decode), ideal_size, Web::Platform::AnimationFrameDecoding::Lazy);
+}
+
+Optional<Gfx::IntSize> SharedResourceRequest::ideal_size_to_decode_at() const
+{
+    // NOTE: Everyone waiting for the image has to be able to tell us how large they'll display it, or we decode it at its
+    //       natural size.
+    Gfx::IntSize largest_display_size;
+    for (auto const& callback : m_callbacks) {
+        if (!callback.display_size)
+            return {};
+        auto display_size = callback.display_size->function()();
+        if (!display_size.has_value() || display_size->is_empty())
+            return {};
+        largest_display_size = {
+            max(largest_display_size.width(), display_size->width()),
+            max(largest_display_size.height(), display_size->height()),
+        };
+    }
+    if (largest_display_size.is_empty())
+        return {};
+    return largest_display_size;
+}
+
+void SharedResourceRequest::handle_partial_image(NonnullRefPtr<Gfx::Bitmap> bitmap, Gfx::ColorSpace const& color_space)
+{
+    if (m_state != State::Fetching)
+        return;
+
+    auto immutable_bitmap = Gfx::ImmutableBitmap::create(move(bitmap), Gfx::AlphaType::Premultiplied, color_space);
+    if (m_partial_image_data)
+        m_partial_image_data->set_bitmap(move(immutable_bitmap));
+    else
+        m_partial_image_data = PartialBitmapDecodedImageData::create(m_document->realm(), move(immutable_bitmap));
+
+    for (auto& callback : m_callbacks) {
+        if (callback.on_partial_image)
+            callback.on_partial_image->function()();
+    }
+    m_document->set_needs_display();
 }
 
 void SharedResourceRequest::handle_failed_fetch()
 {
     m_state = State::Failed;
+    m_incremental_decoder = nullptr;
+    m_partial_image_data = nullptr;
     for (auto& callback : m_callbacks) {
         if (callback.on_fail)
             callback.on_fail->function()();
@@ -189,6 +321,7 @@ void SharedResourceRequest::handle_failed_fetch()
 void SharedResourceRequest::handle_successful_resource_load()
 {
     m_state = State::Finished;
+    m_partial_image_data = nullptr;
     for (auto& callback : m_callbacks) {
         if (callback.on_finish)
             callback.on_finish->function()();
@@ -11,6 +11,7 @@
 #include <LibJS/Heap/Cell.h>
 #include <LibURL/URL.h>
 #include <LibWeb/Forward.h>
+#include <LibWeb/Platform/ImageCodecPlugin.h>
 
 namespace Web::HTML {
 
@@ -27,12 +28,18 @@ public:
 
     [[nodiscard]] GC::Ptr<DecodedImageData> image_data() const;
 
+    // What can be shown of the image while its data is still arriving, if anything.
+    [[nodiscard]] GC::Ptr<DecodedImageData> partial_image_data() const;
+
     [[nodiscard]] GC::Ptr<Fetch::Infrastructure::FetchController> fetch_controller();
     void set_fetch_controller(GC::Ptr<Fetch::Infrastructure::FetchController>);
 
     void fetch_resource(JS::Realm&, GC::Ref<Fetch::Infrastructure::Request>);
 
-    void add_callbacks(Function<void()> on_finish, Function<void()> on_fail);
+    // on_partial_image is invoked whenever more of the image can be shown while its data is still arriving.
+    // display_size returns the size in device pixels that the image is going to be displayed at, if that is known by the
+    // time its data has arrived, so that it isn't decoded at a larger size than that.
+    void add_callbacks(Function<void()> on_finish, Function<void()> on_fail, Function<void()> on_partial_image = {}, Function<Optional<Gfx::IntSize>()> display_size = {});
 
     bool is_fetching() const;
     bool needs_fetching() const;
@@ -44,8 +51,10 @@ private:
     virtual void visit_edges(JS::Cell::Visitor&) override;
 
     void handle_successful_fetch(URL::URL const&, StringView mime_type, ByteBuffer data);
+    void handle_partial_image(NonnullRefPtr<Gfx::Bitmap>, Gfx::ColorSpace const&);
     void handle_failed_fetch();
     void handle_successful_resource_load();
+    Optional<Gfx::IntSize> ideal_size_to_decode_at() const;
 
     enum class State {
         New,
@@ -61,11 +70,17 @@ private:
     struct Callbacks {
         GC::Ptr<GC::Function<void()>> on_finish;
         GC::Ptr<GC::Function<void()>> on_fail;
+        GC::Ptr<GC::Function<void()>> on_partial_image;
+        GC::Ptr<GC::Function<Optional<Gfx::IntSize>()>> display_size;
     };
     Vector<Callbacks> m_callbacks;
 
     URL::URL m_url;
     GC::Ptr<DecodedImageData> m_image_data;
+
+    // NOTE: Bitmap images are decoded as their data arrives, so that we can show what there is of them in the meantime.
+    RefPtr<Platform::IncrementalImageDecoder> m_incremental_decoder;
+    GC::Ptr<PartialBitmapDecodedImageData> m_partial_image_data;
     GC::Ptr<Fetch::Infrastructure::FetchController> m_fetch_controller;
 
     GC::Ptr<DOM::Document> m_document;
@@ -40,6 +40,7 @@
 #include <LibWeb/PerformanceTimeline/EventNames.h>
 #include <LibWeb/PerformanceTimeline/PerformanceObserver.h>
 #include <LibWeb/PerformanceTimeline/PerformanceObserverEntryList.h>
+#include <LibWeb/PrioritizedTaskScheduling/Scheduler.h>
 #include <LibWeb/Platform/EventLoopPlugin.h>
 #include <LibWeb/Platform/ImageCodecPlugin.h>
 #include <LibWeb/ResourceTiming/PerformanceResourceTiming.h>
@@ -86,6 +87,7 @@ void WindowOrWorkerGlobalScopeMixin::visit_edges(JS::Cell::Visitor& visitor)
     visitor.visit(m_cache_storage);
     visitor.visit(m_resource_timing_secondary_buffer);
     visitor.visit(m_trusted_type_policy_factory);
+    visitor.visit(m_scheduler);
 }
 
 void WindowOrWorkerGlobalScopeMixin::finalize()
@@ -1275,4 +1277,16 @@ GC::Ref<TrustedTypes::TrustedTypePolicyFactory> WindowOrWorkerGlobalScopeMixin::
     return *m_trusted_type_policy_factory;
 }
 
+// https://wicg.github.io/scheduling-apis/#dom-windoworworkerglobalscope-scheduler
+GC::Ref<PrioritizedTaskScheduling::Scheduler> WindowOrWorkerGlobalScopeMixin::scheduler()
+{
+    // The scheduler attribute’s getter steps are to return this’s scheduler.
+    auto& platform_object = this_impl();
+    auto& realm = platform_object.realm();
+
+    if (!m_scheduler)
+        m_scheduler = PrioritizedTaskScheduling::Scheduler::create(realm);
+    return *m_scheduler;
+}
+
 }
@@ -106,6 +106,8 @@ public:
 
     [[nodiscard]] GC::Ref<TrustedTypes::TrustedTypePolicyFactory> trusted_types();
 
+    [[nodiscard]] GC::Ref<PrioritizedTaskScheduling::Scheduler> scheduler();
+
 protected:
     void initialize(JS::Realm&);
     void visit_edges(JS::Cell::Visitor&);
@@ -156,6 +158,8 @@ private:
 
     GC::Ptr<TrustedTypes::TrustedTypePolicyFactory> m_trusted_type_policy_factory;
 
+    GC::Ptr<PrioritizedTaskScheduling::Scheduler> m_scheduler;
+
     bool m_error_reporting_mode { false };
 
     WebSockets::WebSocket::List m_registered_web_sockets;
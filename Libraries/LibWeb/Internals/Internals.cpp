@@ -16,6 +16,7 @@
 #include <LibWeb/DOM/EventTarget.h>
 #include <LibWeb/DOM/NodeList.h>
 #include <LibWeb/DOMURL/DOMURL.h>
+#include <LibWeb/HTML/DecodedImageCache.h>
 #include <LibWeb/HTML/HTMLElement.h>
 #include <LibWeb/HTML/Window.h>
 #include <LibWeb/Internals/InternalGamepad.h>
@@ -111,6 +112,11 @@ void Internals::gc()
     vm().heap().collect_garbage();
 }
 
+void Internals::discard_decoded_images()
+{
+    HTML::DecodedImageCache::the().discard_all_unused_images();
+}
+
 WebIDL::ExceptionOr<String> Internals::set_time_zone(StringView time_zone)
 {
     auto current_time_zone = Unicode::current_time_zone();
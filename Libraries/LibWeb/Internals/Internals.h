@@ -28,6 +28,7 @@ public:
     WebIDL::ExceptionOr<String> set_time_zone(StringView time_zone);
 
     void gc();
+    void discard_decoded_images();
     JS::Object* hit_test(double x, double y);
 
     void send_text(HTML::HTMLElement&, String const&, WebIDL::UnsignedShort modifiers);
@@ -25,6 +25,9 @@ public:
 
     virtual RefPtr<Gfx::ImmutableBitmap> current_image_bitmap() const;
     virtual RefPtr<Gfx::ImmutableBitmap> current_image_bitmap_sized(Gfx::IntSize) const = 0;
+
+    // May return null while the image is not decoded, for as long as we have not been told it is in the viewport.
+    virtual RefPtr<Gfx::ImmutableBitmap> current_image_bitmap_for_painting(Gfx::IntSize size) const { return current_image_bitmap_sized(size); }
     virtual void set_visible_in_viewport(bool) = 0;
 
     virtual void image_provider_visit_edges(GC::Cell::Visitor& visitor) const
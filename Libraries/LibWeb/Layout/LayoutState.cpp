@@ -18,36 +18,113 @@
 
 namespace Web::Layout {
 
+LayoutState::LayoutState(Node const& root)
+    : m_first_layout_index(root.layout_index())
+{
+    m_used_values_by_layout_index.resize(root.layout_subtree_end_index() - root.layout_index());
+}
+
+LayoutState::LayoutState() = default;
+
 LayoutState::~LayoutState()
 {
 }
 
+Optional<size_t> LayoutState::index_in_subtree(Node const& node) const
+{
+    // NOTE: Nodes that haven't been assigned a layout index have an index past the end of every subtree.
+    auto index = node.layout_index();
+    if (index < m_first_layout_index || index - m_first_layout_index >= m_used_values_by_layout_index.size())
+        return {};
+    return index - m_first_layout_index;
+}
+
+LayoutState::UsedValues* LayoutState::try_get(Node const& node) const
+{
+    if (auto index = index_in_subtree(node); index.has_value())
+        return m_used_values_by_layout_index[*index];
+    return m_used_values_by_node.get(node).value_or(nullptr);
+}
+
+LayoutState::UsedValues& LayoutState::create_used_values(Node const& node)
+{
+    auto* used_values = m_used_values_allocator.allocate();
+    VERIFY(used_values);
+    m_used_values.append(*used_values);
+
+    if (auto index = index_in_subtree(node); index.has_value())
+        m_used_values_by_layout_index[*index] = used_values;
+    else
+        m_used_values_by_node.set(node, used_values);
+    return *used_values;
+}
+
+// Makes the used values unreachable from this state. The allocation itself stays alive until the state is destroyed.
+void LayoutState::forget_used_values(UsedValues const& used_values)
+{
+    auto const& node = used_values.node();
+    if (auto index = index_in_subtree(node); index.has_value())
+        m_used_values_by_layout_index[*index] = nullptr;
+    else
+        m_used_values_by_node.remove(node);
+}
+
 LayoutState::UsedValues& LayoutState::get_mutable(NodeWithStyle const& node)
 {
-    if (auto* used_values = used_values_per_layout_node.get(node).value_or(nullptr))
+    if (auto* used_values = try_get(node))
         return *used_values;
 
     auto const* containing_block_used_values = node.is_viewport() ? nullptr : &get(*node.containing_block());
 
-    auto new_used_values = adopt_own(*new UsedValues);
-    auto* new_used_values_ptr = new_used_values.ptr();
-    new_used_values->set_node(node, containing_block_used_values);
-    used_values_per_layout_node.set(node, move(new_used_values));
-    return *new_used_values_ptr;
+    auto& new_used_values = create_used_values(node);
+    new_used_values.set_node(node, containing_block_used_values);
+    return new_used_values;
 }
 
 LayoutState::UsedValues const& LayoutState::get(NodeWithStyle const& node) const
 {
-    if (auto const* used_values = used_values_per_layout_node.get(node).value_or(nullptr))
+    return const_cast<LayoutState&>(*this).get_mutable(node);
+}
+
+LayoutState::UsedValues& LayoutState::populate_from_paintable(Box const& box)
+{
+    if (auto* used_values = try_get(box))
         return *used_values;
 
-    auto const* containing_block_used_values = node.is_viewport() ? nullptr : &get(*node.containing_block());
+    auto const* containing_block_used_values = box.is_viewport() ? nullptr : &populate_from_paintable(*box.containing_block());
 
-    auto new_used_values = adopt_own(*new UsedValues);
-    auto* new_used_values_ptr = new_used_values.ptr();
-    new_used_values->set_node(node, containing_block_used_values);
-    const_cast<LayoutState*>(this)->used_values_per_layout_node.set(node, move(new_used_values));
-    return *new_used_values_ptr;
+    auto const& paintable_box = *box.paintable_box();
+    auto const& box_model = paintable_box.box_model();
+
+    auto& used_values = create_used_values(box);
+    used_values.set_node(box, containing_block_used_values);
+    used_values.set_content_width(paintable_box.content_width());
+    used_values.set_content_height(paintable_box.content_height());
+
+    used_values.margin_left = box_model.margin.left;
+    used_values.margin_right = box_model.margin.right;
+    used_values.margin_top = box_model.margin.top;
+    used_values.margin_bottom = box_model.margin.bottom;
+    used_values.border_left = box_model.border.left;
+    used_values.border_right = box_model.border.right;
+    used_values.border_top = box_model.border.top;
+    used_values.border_bottom = box_model.border.bottom;
+    used_values.padding_left = box_model.padding.left;
+    used_values.padding_right = box_model.padding.right;
+    used_values.padding_top = box_model.padding.top;
+    used_values.padding_bottom = box_model.padding.bottom;
+    used_values.inset_left = box_model.inset.left;
+    used_values.inset_right = box_model.inset.right;
+    used_values.inset_top = box_model.inset.top;
+    used_values.inset_bottom = box_model.inset.bottom;
+
+    // NOTE: The committed offset has the relative position inset applied, which commit() would apply a second time.
+    auto offset = paintable_box.offset();
+    if (box.computed_values().position() == CSS::Positioning::Relative)
+        offset.translate_by(-box_model.inset.left, -box_model.inset.top);
+    used_values.offset = offset;
+
+    return used_values;
 }
 
 // https://drafts.csswg.org/css-overflow-3/#scrollable-overflow-region
@@ -163,8 +240,7 @@ void LayoutState::resolve_relative_positions()
 {
     // This function resolves relative position offsets of fragments that belong to inline paintables.
     // It runs *after* the paint tree has been constructed, so it modifies paintable node & fragment offsets directly.
-    for (auto& it : used_values_per_layout_node) {
-        auto& used_values = *it.value;
+    for (auto& used_values : m_used_values) {
         auto& node = const_cast<NodeWithStyle&>(used_values.node());
 
         for (auto& paintable : node.paintables()) {
@@ -238,6 +314,40 @@ void LayoutState::commit(Box& root)
         return TraversalDecision::Continue;
     });
 
+    commit_used_values(root, inline_nodes, nullptr);
+}
+
+void LayoutState::commit_subtree(Box& root)
+{
+    // The containing block chain of `root` was populated from the paintables of a previous layout pass. Those boxes
+    // keep their paintables, so take their used values out of the way of the commit. They stay allocated, since the
+    // used values inside the subtree still point at them.
+    m_used_values.remove_all_matching([&](UsedValues& used_values) {
+        if (root.is_inclusive_ancestor_of(used_values.node()))
+            return false;
+        forget_used_values(used_values);
+        return true;
+    });
+
+    GC::Ptr<Painting::Paintable> old_root_paintable = root.first_paintable();
+    VERIFY(old_root_paintable && old_root_paintable->parent());
+
+    // Only detach the paintables inside the subtree; the rest of the paint tree stays as it is.
+    HashTable<Layout::InlineNode*> inline_nodes;
+    root.for_each_in_inclusive_subtree([&](Node& node) {
+        node.clear_paintables();
+        if (auto* dom_node = node.dom_node())
+            dom_node->clear_paintable();
+        if (auto* inline_node = as_if<InlineNode>(node))
+            inline_nodes.set(inline_node);
+        return TraversalDecision::Continue;
+    });
+
+    commit_used_values(root, inline_nodes, old_root_paintable);
+}
+
+void LayoutState::commit_used_values(Box& root, HashTable<InlineNode*> const& inline_nodes, GC::Ptr<Painting::Paintable> paintable_to_replace)
+{
     HashTable<Layout::TextNode*> text_nodes;
     HashTable<Painting::PaintableWithLines*> inline_node_paintables;
 
@@ -256,7 +366,7 @@ void LayoutState::commit(Box& root)
                 auto& inline_node = const_cast<InlineNode&>(static_cast<InlineNode const&>(*parent));
                 auto line_paintable = inline_node.create_paintable_for_line_with_index(line_index);
                 line_paintable->add_fragment(fragment);
-                if (auto const* used_values = used_values_per_layout_node.get(inline_node).value_or(nullptr))
+                if (auto const* used_values = try_get(inline_node))
                     transfer_box_model_metrics(line_paintable->box_model(), *used_values);
                 if (!inline_node_paintables.contains(line_paintable.ptr())) {
                     inline_node_paintables.set(line_paintable.ptr());
@@ -268,8 +378,7 @@ void LayoutState::commit(Box& root)
         return false;
     };
 
-    for (auto& it : used_values_per_layout_node) {
-        auto& used_values = *it.value;
+    for (auto& used_values : m_used_values) {
         auto& node = used_values.node();
 
         auto paintable = node.create_paintable();
@@ -324,15 +433,14 @@ void LayoutState::commit(Box& root)
         auto line_paintable = inline_node->create_paintable_for_line_with_index(0);
         inline_node->add_paintable(line_paintable);
         inline_node_paintables.set(line_paintable.ptr());
-        if (auto const* used_values = used_values_per_layout_node.get(*inline_node).value_or(nullptr))
+        if (auto const* used_values = try_get(*inline_node))
             transfer_box_model_metrics(line_paintable->box_model(), *used_values);
     }
 
     // Resolve relative positions for regular boxes (not line box fragments):
     // NOTE: This needs to occur before fragments are transferred into the corresponding inline paintables, because
     //       after this transfer, the containing_line_box_fragment will no longer be valid.
-    for (auto& it : used_values_per_layout_node) {
-        auto& used_values = *it.value;
+    for (auto& used_values : m_used_values) {
         auto& node = const_cast<NodeWithStyle&>(used_values.node());
 
         if (!node.is_box())
@@ -370,6 +478,9 @@ void LayoutState::commit(Box& root)
 
     build_paint_tree(root);
 
+    if (paintable_to_replace)
+        paintable_to_replace->parent()->replace_child(*root.first_paintable(), *paintable_to_replace);
+
     resolve_relative_positions();
 
     // Measure size of paintables created for inline nodes.
@@ -384,16 +495,16 @@ void LayoutState::commit(Box& root)
             if (paintable.line_index() != line_index)
                 return TraversalDecision::Continue;
 
-            auto used_values = used_values_per_layout_node.get(paintable.layout_node_with_style_and_box_metrics());
-            if (&paintable != paintable_with_lines && used_values.has_value())
-                size.set_width(size.width() + used_values.value()->margin_box_left() + used_values.value()->margin_box_right());
+            auto const* used_values = try_get(paintable.layout_node_with_style_and_box_metrics());
+            if (&paintable != paintable_with_lines && used_values)
+                size.set_width(size.width() + used_values->margin_box_left() + used_values->margin_box_right());
 
             auto const& fragments = paintable.fragments();
             if (!fragments.is_empty()) {
                 if (!offset.has_value() || (fragments.first().offset().x() < offset->x()))
                     offset = fragments.first().offset();
-                if (&paintable == paintable_with_lines->first_child() && used_values.has_value())
-                    offset->translate_by(-used_values.value()->margin_box_left(), 0);
+                if (&paintable == paintable_with_lines->first_child() && used_values)
+                    offset->translate_by(-used_values->margin_box_left(), 0);
             }
             for (auto const& fragment : fragments)
                 size.set_width(size.width() + fragment.width());
@@ -421,8 +532,7 @@ void LayoutState::commit(Box& root)
     }
 
     // Measure overflow in scroll containers.
-    for (auto& it : used_values_per_layout_node) {
-        auto& used_values = *it.value;
+    for (auto& used_values : m_used_values) {
         auto const* box = as_if<Box>(used_values.node());
         if (!box)
             continue;
@@ -436,8 +546,7 @@ void LayoutState::commit(Box& root)
             paintable_box.set_scroll_offset(paintable_box.scroll_offset());
     }
 
-    for (auto& it : used_values_per_layout_node) {
-        auto& used_values = *it.value;
+    for (auto& used_values : m_used_values) {
         auto& node = used_values.node();
         for (auto& paintable : node.paintables()) {
             auto* paintable_box = as_if<Painting::PaintableBox>(paintable);
@@ -6,7 +6,9 @@
 
 #pragma once
 
+#include <AK/BumpAllocator.h>
 #include <AK/HashMap.h>
+#include <AK/Noncopyable.h>
 #include <LibGfx/Path.h>
 #include <LibGfx/Point.h>
 #include <LibWeb/Layout/Box.h>
@@ -55,6 +57,18 @@ struct StaticPositionRect {
 };
 
 struct LayoutState {
+    AK_MAKE_NONCOPYABLE(LayoutState);
+    AK_MAKE_NONMOVABLE(LayoutState);
+
+public:
+    // Used values of the nodes in the subtree of `root` are addressed by their layout index, in an array as large as the
+    // subtree. This is for layout passes, which visit most of it. Nodes outside of it are looked up by node instead.
+    explicit LayoutState(Node const& root);
+
+    // Throwaway states (such as those used for intrinsic sizing) only visit a small part of the tree, and there are many
+    // of them, so they look up all used values by node.
+    LayoutState();
+
     struct UsedValues {
         NodeWithStyle const& node() const { return *m_node; }
         NodeWithStyle& node() { return const_cast<NodeWithStyle&>(*m_node); }
@@ -201,13 +215,34 @@ struct LayoutState {
     // Commits the used values produced by layout and builds a paintable tree.
     void commit(Box& root);
 
+    // Commits the used values of a relayout scoped to the subtree of `root`, replacing only that part of the existing
+    // paintable tree.
+    void commit_subtree(Box& root);
+
+    // Creates used values for `box` and its containing block chain from the paintables of the previous layout pass.
+    UsedValues& populate_from_paintable(Box const&);
+
     UsedValues& get_mutable(NodeWithStyle const&);
     UsedValues const& get(NodeWithStyle const&) const;
 
-    OrderedHashMap<GC::Ref<Layout::Node const>, NonnullOwnPtr<UsedValues>> used_values_per_layout_node;
+    UsedValues* try_get(Node const&) const;
 
 private:
+    Optional<size_t> index_in_subtree(Node const&) const;
+    UsedValues& create_used_values(Node const&);
+    void forget_used_values(UsedValues const&);
+
+    void commit_used_values(Box& root, HashTable<InlineNode*> const& inline_nodes, GC::Ptr<Painting::Paintable> paintable_to_replace);
     void resolve_relative_positions();
+
+    UniformBumpAllocator<UsedValues, false, 32 * KiB> m_used_values_allocator;
+
+    u32 m_first_layout_index { 0 };
+    Vector<UsedValues*> m_used_values_by_layout_index;
+    HashMap<GC::Ref<Node const>, UsedValues*> m_used_values_by_node;
+
+    // Every used values entry in the order it was created, which is the order commit() visits them in.
+    Vector<UsedValues&> m_used_values;
 };
 
 inline CSSPixels clamp_to_max_dimension_value(CSSPixels value)
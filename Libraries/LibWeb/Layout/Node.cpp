@@ -1357,8 +1357,20 @@ void NodeWithStyleAndBoxModelMetrics::visit_edges(Cell::Visitor& visitor)
     visitor.visit(m_continuation_of_node);
 }
 
+u32 Node::assign_layout_indices(u32 first_index)
+{
+    m_layout_index = first_index;
+    auto next_index = first_index + 1;
+    for (auto* child = first_child(); child; child = child->next_sibling())
+        next_index = child->assign_layout_indices(next_index);
+    m_layout_subtree_end_index = next_index;
+    return next_index;
+}
+
 void Node::set_needs_layout_update(DOM::SetNeedsLayoutReason reason)
 {
+    m_is_layout_update_origin = true;
+
     if (m_needs_layout_update)
         return;
 
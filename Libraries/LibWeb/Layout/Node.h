@@ -8,6 +8,7 @@
 #pragma once
 
 #include <AK/NonnullRefPtr.h>
+#include <AK/NumericLimits.h>
 #include <AK/Vector.h>
 #include <LibJS/Heap/Cell.h>
 #include <LibWeb/CSS/StyleValues/ImageStyleValue.h>
@@ -48,7 +49,20 @@ public:
 
     bool needs_layout_update() const { return m_needs_layout_update; }
     void set_needs_layout_update(DOM::SetNeedsLayoutReason);
-    void reset_needs_layout_update() { m_needs_layout_update = false; }
+    void reset_needs_layout_update()
+    {
+        m_needs_layout_update = false;
+        m_is_layout_update_origin = false;
+    }
+
+    // True if set_needs_layout_update() was called on this node itself, rather than it being marked on behalf of a descendant.
+    bool is_layout_update_origin() const { return m_is_layout_update_origin; }
+
+    // Position of this node in tree order, assigned at the start of every layout pass. A node's subtree occupies the
+    // layout indices [layout_index(), layout_subtree_end_index()).
+    u32 layout_index() const { return m_layout_index; }
+    u32 layout_subtree_end_index() const { return m_layout_subtree_end_index; }
+    u32 assign_layout_indices(u32 first_index);
 
     bool is_generated() const { return m_generated_for.has_value(); }
     Optional<CSS::PseudoElement> generated_for_pseudo_element() const { return m_generated_for; }
@@ -228,6 +242,10 @@ private:
     bool m_has_been_wrapped_in_table_wrapper { false };
 
     bool m_needs_layout_update { false };
+    bool m_is_layout_update_origin { false };
+
+    u32 m_layout_index { NumericLimits<u32>::max() };
+    u32 m_layout_subtree_end_index { NumericLimits<u32>::max() };
 
     Optional<CSS::PseudoElement> m_generated_for {};
 
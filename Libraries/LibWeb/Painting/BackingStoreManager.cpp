@@ -52,12 +52,17 @@ BackingStoreManager::BackingStore BackingStoreManager::acquire_store_for_next_fr
     BackingStore backing_store;
     backing_store.bitmap_id = m_back_bitmap_id;
     backing_store.store = m_back_store;
+    if (m_front_store_has_frame)
+        backing_store.previous_frame_store = m_front_store;
     swap_back_and_front();
+    m_front_store_has_frame = !m_front_store.is_null();
     return backing_store;
 }
 
 void BackingStoreManager::reallocate_backing_stores(Gfx::IntSize size)
 {
+    m_front_store_has_frame = false;
+
     auto skia_backend_context = m_navigable->skia_backend_context();
 #ifdef AK_OS_MACOS
     if (skia_backend_context && s_browser_mach_port.has_value()) {
@@ -31,6 +31,10 @@ public:
     struct BackingStore {
         i32 bitmap_id { -1 };
         RefPtr<Gfx::PaintingSurface> store;
+
+        // The store holding the frame painted before this one, if there is one. Parts of the viewport that haven't
+        // changed since then can be copied from it instead of being painted again.
+        RefPtr<Gfx::PaintingSurface> previous_frame_store;
     };
 
     BackingStore acquire_store_for_next_frame();
@@ -50,6 +54,9 @@ private:
     RefPtr<Gfx::PaintingSurface> m_back_store;
     int m_next_bitmap_id { 0 };
 
+    // Whether a frame has been painted into the front store since the stores were allocated.
+    bool m_front_store_has_frame { false };
+
     RefPtr<Core::Timer> m_backing_store_shrink_timer;
 };
 
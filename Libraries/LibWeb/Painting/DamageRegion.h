@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/NonnullRefPtr.h>
+#include <AK/Vector.h>
+#include <LibGfx/PaintingSurface.h>
+#include <LibGfx/Rect.h>
+
+namespace Web::Painting {
+
+// The parts of a viewport, in device pixels, that have changed since the last frame was painted. Everything outside of
+// it still looks the same as in that frame.
+class DamageRegion {
+public:
+    static DamageRegion everything()
+    {
+        DamageRegion region;
+        region.add_everything();
+        return region;
+    }
+
+    bool is_empty() const { return !m_is_everything && m_rects.is_empty(); }
+    bool is_everything() const { return m_is_everything; }
+
+    // Only meaningful if the region is not everything.
+    Vector<Gfx::IntRect, 8> const& rects() const { return m_rects; }
+
+    size_t area() const
+    {
+        size_t area = 0;
+        for (auto const& rect : m_rects)
+            area += rect.size().area();
+        return area;
+    }
+
+    void add_everything()
+    {
+        m_is_everything = true;
+        m_rects.clear();
+    }
+
+    void add(Gfx::IntRect rect)
+    {
+        if (m_is_everything || rect.is_empty())
+            return;
+
+        // NOTE: Keep the rects disjoint, so that the area covered by the region is simply the sum of their areas.
+        for (size_t i = 0; i < m_rects.size();) {
+            if (m_rects[i].contains(rect))
+                return;
+            if (m_rects[i].intersects(rect)) {
+                rect = rect.united(m_rects.take(i));
+                i = 0;
+                continue;
+            }
+            ++i;
+        }
+
+        if (m_rects.size() < max_rect_count) {
+            m_rects.append(rect);
+            return;
+        }
+
+        // NOTE: Clipping to many small rects costs more than painting a little more than needed, so merge the new rect
+        //       into whichever one grows the least by it.
+        size_t best_index = 0;
+        size_t best_growth = NumericLimits<size_t>::max();
+        for (size_t i = 0; i < m_rects.size(); ++i) {
+            auto growth = m_rects[i].united(rect).size().area() - m_rects[i].size().area();
+            if (static_cast<size_t>(growth) < best_growth) {
+                best_index = i;
+                best_growth = growth;
+            }
+        }
+        add(m_rects.take(best_index).united(rect));
+    }
+
+    void clear()
+    {
+        m_is_everything = false;
+        m_rects.clear();
+    }
+
+private:
+    static constexpr size_t max_rect_count = 8;
+
+    bool m_is_everything { false };
+    Vector<Gfx::IntRect, 8> m_rects;
+};
+
+// Paints a frame by only replaying the display list within the damage region, and copying everything else from the
+// previous frame.
+struct PartialRepaint {
+    NonnullRefPtr<Gfx::PaintingSurface> previous_frame;
+    DamageRegion damage_region;
+
+    // Where the previous frame is copied to, which is not where it was if the viewport has been scrolled since.
+    Gfx::IntPoint previous_frame_offset;
+};
+
+}
@@ -12,9 +12,176 @@ namespace Web::Painting {
 
 void DisplayList::append(DisplayListCommand&& command, Optional<i32> scroll_frame_id, RefPtr<ClipFrame const> clip_frame)
 {
+    auto inherit_flags_from = [this](RefPtr<DisplayList> const& display_list) {
+        if (!display_list)
+            return;
+        m_has_backdrop_filters |= display_list->has_backdrop_filters();
+        m_draws_painting_surfaces |= display_list->draws_painting_surfaces();
+    };
+    command.visit(
+        [&](ApplyBackdropFilter const&) { m_has_backdrop_filters = true; },
+        [&](DrawPaintingSurface const&) { m_draws_painting_surfaces = true; },
+        [&](AddMask const& command) { inherit_flags_from(command.display_list); },
+        [&](PaintNestedDisplayList const& command) { inherit_flags_from(command.display_list); },
+        [](auto const&) {});
     m_commands.append({ scroll_frame_id, clip_frame, move(command) });
 }
 
+static bool is_identity(Gfx::FloatMatrix4x4 const& matrix)
+{
+    auto identity = Gfx::FloatMatrix4x4::identity();
+    for (size_t row = 0; row < 4; ++row) {
+        for (size_t column = 0; column < 4; ++column) {
+            if (matrix[row, column] != identity[row, column])
+                return false;
+        }
+    }
+    return true;
+}
+
+template<typename Command>
+static Optional<Gfx::IntRect> damage_rect_for(Command const& command)
+{
+    // NOTE: Glyphs may stick out of the rect of the text they belong to, e.g. when they are italic.
+    if constexpr (IsSame<Command, DrawGlyphRun>)
+        return command.rect.inflated(command.rect.height(), command.rect.height());
+    else if constexpr (IsSame<Command, DrawLine>)
+        return Gfx::IntRect::from_two_points(command.from, command.to).inflated(command.thickness * 2, command.thickness * 2);
+    else if constexpr (IsSame<Command, PaintScrollBar>)
+        return command.gutter_rect;
+    else if constexpr (requires { command.bounding_rect(); })
+        return command.bounding_rect();
+    else
+        return {};
+}
+
+bool DisplayList::add_damage_for_scrolling(DamageRegion& damage_region, ScrollStateSnapshot const& previous_scroll_state, ScrollStateSnapshot const& scroll_state, Gfx::IntPoint shift, Gfx::IntRect const& viewport_rect) const
+{
+    DevicePixelConverter device_pixel_converter { m_device_pixels_per_css_pixel };
+
+    // NOTE: This has to match how players translate commands by the offset of their scroll frame.
+    auto scroll_offset = [&](ScrollStateSnapshot const& state, Optional<i32> scroll_frame_id) -> Gfx::IntPoint {
+        if (!scroll_frame_id.has_value())
+            return {};
+        return state.cumulative_offset_for_frame_with_id(scroll_frame_id.value()).to_type<double>().scaled(m_device_pixels_per_css_pixel).to_type<int>();
+    };
+
+    // Whatever was painted in the previous frame ends up moved by the shift, and has to be painted over as well as
+    // painted where it is now.
+    auto add_damage = [&](Gfx::IntRect const& previous_rect, Gfx::IntRect const& rect) {
+        // NOTE: Anti-aliased edges may bleed into the device pixels right around the rects.
+        damage_region.add(previous_rect.translated(shift).inflated(2, 2).intersected(viewport_rect));
+        damage_region.add(rect.inflated(2, 2).intersected(viewport_rect));
+    };
+
+    // Everything a clip frame applies to is painted within its clip rects, so if they don't move along, it's enough to
+    // paint the area they confine painting to again.
+    auto clip_frame_moves_along = [&](ClipFrame const& clip_frame) {
+        bool moves_along = true;
+        Optional<Gfx::IntRect> previous_clip_rect;
+        Optional<Gfx::IntRect> clip_rect;
+        for (auto const& clip_rect_with_scroll_frame : clip_frame.clip_rects()) {
+            auto previous_css_rect = clip_rect_with_scroll_frame.rect;
+            auto css_rect = clip_rect_with_scroll_frame.rect;
+            if (auto enclosing_scroll_frame_id = clip_rect_with_scroll_frame.enclosing_scroll_frame_id; enclosing_scroll_frame_id.has_value()) {
+                previous_css_rect.translate_by(previous_scroll_state.cumulative_offset_for_frame_with_id(enclosing_scroll_frame_id.value()));
+                css_rect.translate_by(scroll_state.cumulative_offset_for_frame_with_id(enclosing_scroll_frame_id.value()));
+            }
+            auto previous_device_rect = device_pixel_converter.rounded_device_rect(previous_css_rect).to_type<int>();
+            auto device_rect = device_pixel_converter.rounded_device_rect(css_rect).to_type<int>();
+            moves_along &= previous_device_rect.translated(shift) == device_rect;
+            previous_clip_rect = previous_clip_rect.has_value() ? previous_clip_rect->intersected(previous_device_rect) : previous_device_rect;
+            clip_rect = clip_rect.has_value() ? clip_rect->intersected(device_rect) : device_rect;
+        }
+        if (!moves_along)
+            add_damage(*previous_clip_rect, *clip_rect);
+        return moves_along;
+    };
+
+    bool is_painting_canvas = true;
+    RefPtr<ClipFrame const> current_clip_frame;
+    bool current_clip_frame_moves_along = true;
+
+    // Within transforms and filters, rects in the display list no longer map onto the viewport the same way, so
+    // anything in there that doesn't move along can't be told apart from what does.
+    int nesting_level = 0;
+    Optional<int> unknown_geometry_nesting_level;
+
+    for (auto const& [scroll_frame_id, clip_frame, command] : m_commands) {
+        if (is_painting_canvas) {
+            if (auto const* fill_rect = command.get_pointer<FillRect>(); fill_rect && !scroll_frame_id.has_value() && !clip_frame && fill_rect->rect.contains(viewport_rect))
+                continue;
+            is_painting_canvas = false;
+        }
+
+        if (clip_frame != current_clip_frame) {
+            current_clip_frame = clip_frame;
+            current_clip_frame_moves_along = !clip_frame || clip_frame_moves_along(*clip_frame);
+        }
+        if (!current_clip_frame_moves_along && unknown_geometry_nesting_level.has_value())
+            return false;
+
+        auto nesting_level_change = command.visit([](auto const& command) {
+            if constexpr (requires { command.nesting_level_change; })
+                return command.nesting_level_change;
+            else
+                return 0;
+        });
+        auto enter_unknown_geometry = [&] {
+            if (!unknown_geometry_nesting_level.has_value())
+                unknown_geometry_nesting_level = nesting_level + nesting_level_change;
+        };
+
+        auto previous_offset = scroll_offset(previous_scroll_state, scroll_frame_id);
+        auto offset = scroll_offset(scroll_state, scroll_frame_id);
+        bool moves_along = offset == previous_offset.translated(shift);
+        if (auto const* paint_scroll_bar = command.get_pointer<PaintScrollBar>()) {
+            // NOTE: The thumb of a scroll bar moves with the offset of the frame it scrolls.
+            moves_along &= previous_scroll_state.own_offset_for_frame_with_id(paint_scroll_bar->scroll_frame_id) == scroll_state.own_offset_for_frame_with_id(paint_scroll_bar->scroll_frame_id);
+        }
+
+        bool can_tell_what_moved = command.visit(
+            [&](PushStackingContext const& command) {
+                if (!is_identity(command.transform.matrix)) {
+                    enter_unknown_geometry();
+                    return moves_along;
+                }
+                return moves_along || !command.clip_path.has_value();
+            },
+            [&](ApplyTransform const&) {
+                enter_unknown_geometry();
+                return moves_along;
+            },
+            [&](ApplyFilter const&) {
+                enter_unknown_geometry();
+                return true;
+            },
+            // NOTE: Translations are applied on top of the offset of the scroll frame of everything they contain.
+            [&](Translate const&) { return false; },
+            [&](auto const& command) {
+                if constexpr (requires { command.translate_by(Gfx::IntPoint {}); }) {
+                    if (moves_along)
+                        return true;
+                    if (unknown_geometry_nesting_level.has_value())
+                        return false;
+                    auto rect = damage_rect_for(command);
+                    if (!rect.has_value())
+                        return false;
+                    add_damage(rect->translated(previous_offset), rect->translated(offset));
+                }
+                return true;
+            });
+        if (!can_tell_what_moved)
+            return false;
+
+        nesting_level += nesting_level_change;
+        if (unknown_geometry_nesting_level.has_value() && nesting_level < unknown_geometry_nesting_level.value())
+            unknown_geometry_nesting_level.clear();
+    }
+
+    return true;
+}
+
 String DisplayList::dump() const
 {
     StringBuilder builder;
@@ -66,14 +233,16 @@ static bool command_is_clip_or_mask(DisplayListCommand const& command)
         });
 }
 
-void DisplayListPlayer::execute(DisplayList& display_list, ScrollStateSnapshotByDisplayList&& scroll_state_snapshot_by_display_list, RefPtr<Gfx::PaintingSurface> surface)
+void DisplayListPlayer::execute(DisplayList& display_list, ScrollStateSnapshotByDisplayList&& scroll_state_snapshot_by_display_list, RefPtr<Gfx::PaintingSurface> surface, Optional<PartialRepaint> partial_repaint)
 {
+    VERIFY(!partial_repaint.has_value() || surface);
+
     TemporaryChange change { m_scroll_state_snapshots_by_display_list, move(scroll_state_snapshot_by_display_list) };
     if (surface) {
         surface->lock_context();
     }
     auto scroll_state_snapshot = m_scroll_state_snapshots_by_display_list.get(display_list).value_or({});
-    execute_impl(display_list, scroll_state_snapshot, surface);
+    execute_impl(display_list, scroll_state_snapshot, surface, partial_repaint.has_value() ? &partial_repaint.value() : nullptr);
     if (surface) {
         surface->unlock_context();
     }
@@ -109,7 +278,7 @@ void DisplayListPlayer::remove_clip_frame(ClipFrame const& clip_frame)
     restore({});
 }
 
-void DisplayListPlayer::execute_impl(DisplayList& display_list, ScrollStateSnapshot const& scroll_state, RefPtr<Gfx::PaintingSurface> surface)
+void DisplayListPlayer::execute_impl(DisplayList& display_list, ScrollStateSnapshot const& scroll_state, RefPtr<Gfx::PaintingSurface> surface, PartialRepaint const* partial_repaint)
 {
     if (surface)
         m_surfaces.append(*surface);
@@ -125,6 +294,11 @@ void DisplayListPlayer::execute_impl(DisplayList& display_list, ScrollStateSnaps
 
     VERIFY(!m_surfaces.is_empty());
 
+    if (partial_repaint) {
+        save({});
+        prepare_for_partial_repaint(*partial_repaint);
+    }
+
     Vector<RefPtr<ClipFrame const>> clip_frames_stack;
     clip_frames_stack.append({});
     for (size_t command_index = 0; command_index < commands.size(); command_index++) {
@@ -240,6 +414,9 @@ void DisplayListPlayer::execute_impl(DisplayList& display_list, ScrollStateSnaps
         }
     }
 
+    if (partial_repaint)
+        restore({});
+
     if (surface)
         flush();
 }
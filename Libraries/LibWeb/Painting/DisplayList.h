@@ -17,6 +17,7 @@
 #include <LibWeb/CSS/Enums.h>
 #include <LibWeb/Forward.h>
 #include <LibWeb/Painting/ClipFrame.h>
+#include <LibWeb/Painting/DamageRegion.h>
 #include <LibWeb/Painting/DisplayListCommand.h>
 #include <LibWeb/Painting/ScrollState.h>
 
@@ -26,11 +27,11 @@ class DisplayListPlayer {
 public:
     virtual ~DisplayListPlayer() = default;
 
-    void execute(DisplayList&, ScrollStateSnapshotByDisplayList&&, RefPtr<Gfx::PaintingSurface>);
+    void execute(DisplayList&, ScrollStateSnapshotByDisplayList&&, RefPtr<Gfx::PaintingSurface>, Optional<PartialRepaint> = {});
 
 protected:
     Gfx::PaintingSurface& surface() const { return m_surfaces.last(); }
-    void execute_impl(DisplayList&, ScrollStateSnapshot const& scroll_state, RefPtr<Gfx::PaintingSurface>);
+    void execute_impl(DisplayList&, ScrollStateSnapshot const& scroll_state, RefPtr<Gfx::PaintingSurface>, PartialRepaint const* = nullptr);
 
     ScrollStateSnapshotByDisplayList m_scroll_state_snapshots_by_display_list;
 
@@ -73,6 +74,9 @@ private:
     virtual void apply_mask_bitmap(ApplyMaskBitmap const&) = 0;
     virtual bool would_be_fully_clipped_by_painter(Gfx::IntRect) const = 0;
 
+    // Copies everything outside of the damage region from the previous frame, then clips to the damage region.
+    virtual void prepare_for_partial_repaint(PartialRepaint const&) = 0;
+
     void apply_clip_frame(ClipFrame const&, ScrollStateSnapshot const&, DevicePixelConverter const&);
     void remove_clip_frame(ClipFrame const&);
 
@@ -97,6 +101,19 @@ public:
     AK::SegmentedVector<DisplayListCommandWithScrollAndClip, 512> const& commands() const { return m_commands; }
     double device_pixels_per_css_pixel() const { return m_device_pixels_per_css_pixel; }
 
+    // Backdrop filters read from what has been painted beneath them, which is stale outside of a damage region.
+    bool has_backdrop_filters() const { return m_has_backdrop_filters; }
+
+    // Painting surfaces (e.g. those of canvases) are snapshotted while being drawn, which can't be done from several
+    // threads at once.
+    bool draws_painting_surfaces() const { return m_draws_painting_surfaces; }
+
+    // Adds everything in the viewport that doesn't move along by the given shift (in device pixels) when going from one
+    // scroll state to the other to the damage region, such as fixed position boxes or the contents of other scroll
+    // frames. Fills at the very start of the list that cover all of the viewport are taken to be the canvas, which looks
+    // the same wherever it's moved to. Returns false if what changed can't be told apart from what only moved.
+    [[nodiscard]] bool add_damage_for_scrolling(DamageRegion&, ScrollStateSnapshot const& previous_scroll_state, ScrollStateSnapshot const& scroll_state, Gfx::IntPoint shift, Gfx::IntRect const& viewport_rect) const;
+
     String dump() const;
 
 private:
@@ -107,6 +124,8 @@ private:
 
     AK::SegmentedVector<DisplayListCommandWithScrollAndClip, 512> m_commands;
     double m_device_pixels_per_css_pixel;
+    bool m_has_backdrop_filters { false };
+    bool m_draws_painting_surfaces { false };
 };
 
 }
@@ -13,6 +13,7 @@
 #include <core/SkPath.h>
 #include <core/SkPathEffect.h>
 #include <core/SkRRect.h>
+#include <core/SkRegion.h>
 #include <core/SkSurface.h>
 #include <effects/SkDashPathEffect.h>
 #include <effects/SkGradientShader.h>
@@ -1032,4 +1033,25 @@ bool DisplayListPlayerSkia::would_be_fully_clipped_by_painter(Gfx::IntRect rect)
     return surface().canvas().quickReject(to_skia_rect(rect));
 }
 
+void DisplayListPlayerSkia::prepare_for_partial_repaint(PartialRepaint const& partial_repaint)
+{
+    VERIFY(!partial_repaint.damage_region.is_everything());
+
+    auto& canvas = surface().canvas();
+
+    SkRegion damage_region;
+    for (auto const& rect : partial_repaint.damage_region.rects())
+        damage_region.op(SkIRect::MakeXYWH(rect.x(), rect.y(), rect.width(), rect.height()), SkRegion::kUnion_Op);
+
+    canvas.save();
+    canvas.clipRegion(damage_region, SkClipOp::kDifference);
+    SkPaint paint;
+    paint.setBlendMode(SkBlendMode::kSrc);
+    canvas.drawImage(partial_repaint.previous_frame->sk_surface().makeImageSnapshot(), partial_repaint.previous_frame_offset.x(), partial_repaint.previous_frame_offset.y(), SkSamplingOptions(), &paint);
+    canvas.restore();
+
+    canvas.clipRegion(damage_region);
+    canvas.clear(SK_ColorTRANSPARENT);
+}
+
 }
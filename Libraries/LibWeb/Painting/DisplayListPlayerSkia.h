@@ -60,6 +60,7 @@ private:
     void apply_mask_bitmap(ApplyMaskBitmap const&) override;
 
     bool would_be_fully_clipped_by_painter(Gfx::IntRect) const override;
+    void prepare_for_partial_repaint(PartialRepaint const&) override;
 
     RefPtr<Gfx::SkiaBackendContext> m_context;
 
@@ -49,6 +49,14 @@ consteval static int command_nesting_level_change(T const& command)
         m_display_list.append(move(command), _scroll_frame_id, _clip_frame); \
     } while (false)
 
+void DisplayListRecorder::append_recorded_commands(ReadonlySpan<DisplayList::DisplayListCommandWithScrollAndClip> commands)
+{
+    for (auto const& [scroll_frame_id, clip_frame, command] : commands) {
+        command.visit([&](auto const& command) { m_save_nesting_level += command_nesting_level_change(command); });
+        m_display_list.append(DisplayListCommand { command }, scroll_frame_id, clip_frame);
+    }
+}
+
 void DisplayListRecorder::paint_nested_display_list(RefPtr<DisplayList> display_list, Gfx::IntRect rect)
 {
     APPEND(PaintNestedDisplayList { move(display_list), rect });
@@ -293,6 +301,13 @@ void DisplayListRecorder::pop_scroll_frame_id()
     (void)m_scroll_frame_id_stack.take_last();
 }
 
+Optional<i32> DisplayListRecorder::current_scroll_frame_id() const
+{
+    if (m_scroll_frame_id_stack.is_empty())
+        return {};
+    return m_scroll_frame_id_stack.last();
+}
+
 void DisplayListRecorder::push_clip_frame(RefPtr<ClipFrame const> clip_frame)
 {
     m_clip_frame_stack.append(clip_frame);
@@ -303,6 +318,13 @@ void DisplayListRecorder::pop_clip_frame()
     (void)m_clip_frame_stack.take_last();
 }
 
+RefPtr<ClipFrame const> DisplayListRecorder::current_clip_frame() const
+{
+    if (m_clip_frame_stack.is_empty())
+        return {};
+    return m_clip_frame_stack.last();
+}
+
 void DisplayListRecorder::push_stacking_context(PushStackingContextParams params)
 {
     APPEND(PushStackingContext {
@@ -23,6 +23,7 @@
 #include <LibWeb/Painting/BorderRadiiData.h>
 #include <LibWeb/Painting/BorderRadiusCornerClipper.h>
 #include <LibWeb/Painting/ClipFrame.h>
+#include <LibWeb/Painting/DisplayList.h>
 #include <LibWeb/Painting/GradientData.h>
 #include <LibWeb/Painting/PaintBoxShadowParams.h>
 #include <LibWeb/Painting/PaintStyle.h>
@@ -95,9 +96,11 @@ public:
 
     void push_scroll_frame_id(Optional<i32> id);
     void pop_scroll_frame_id();
+    Optional<i32> current_scroll_frame_id() const;
 
     void push_clip_frame(RefPtr<ClipFrame const>);
     void pop_clip_frame();
+    RefPtr<ClipFrame const> current_clip_frame() const;
 
     void save();
     void save_layer();
@@ -136,6 +139,11 @@ public:
     void apply_transform(Gfx::FloatPoint origin, Gfx::FloatMatrix4x4);
     void apply_mask_bitmap(Gfx::IntPoint origin, Gfx::ImmutableBitmap const&, Gfx::Bitmap::MaskKind);
 
+    // Appends commands that were recorded earlier, as they were recorded.
+    void append_recorded_commands(ReadonlySpan<DisplayList::DisplayListCommandWithScrollAndClip>);
+
+    DisplayList const& display_list() const { return m_display_list; }
+
     DisplayListRecorder(DisplayList&);
     ~DisplayListRecorder();
 
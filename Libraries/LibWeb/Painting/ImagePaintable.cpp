@@ -73,12 +73,22 @@ void ImagePaintable::paint(DisplayListRecordingContext& context, PaintPhase phas
                 context.display_list_recorder().draw_rect(enclosing_rect, Gfx::Color::Black);
                 context.display_list_recorder().draw_text(enclosing_rect, m_alt_text, *Platform::FontPlugin::the().default_font(12), Gfx::TextAlignment::Center, computed_values().color());
             }
-        } else if (auto bitmap = m_image_provider.current_image_bitmap_sized(image_rect_device_pixels.size().to_type<int>())) {
+        } else if (auto bitmap = m_image_provider.current_image_bitmap_for_painting(image_rect_device_pixels.size().to_type<int>())) {
             ScopedCornerRadiusClip corner_clip { context, image_rect_device_pixels, normalized_border_radii_data(ShrinkRadiiForBorders::Yes) };
             auto image_int_rect_device_pixels = image_rect_device_pixels.to_type<int>();
             auto bitmap_rect = bitmap->rect();
             auto scaling_mode = to_gfx_scaling_mode(computed_values().image_rendering(), bitmap_rect, image_int_rect_device_pixels);
-            auto bitmap_aspect_ratio = (float)bitmap_rect.height() / bitmap_rect.width();
+
+            // NOTE: The bitmap may have been decoded at a smaller size than the image's natural size, which is what
+            //       object-fit and object-position work with.
+            auto natural_rect = bitmap_rect;
+            if (!m_is_svg_image) {
+                auto intrinsic_width = m_image_provider.intrinsic_width();
+                auto intrinsic_height = m_image_provider.intrinsic_height();
+                if (intrinsic_width.has_value() && intrinsic_height.has_value())
+                    natural_rect.set_size(intrinsic_width->to_int(), intrinsic_height->to_int());
+            }
+            auto natural_aspect_ratio = (float)natural_rect.height() / natural_rect.width();
             auto image_aspect_ratio = (float)image_rect.height() / (float)image_rect.width();
 
             auto scale_x = 0.0f;
@@ -87,7 +97,7 @@ void ImagePaintable::paint(DisplayListRecordingContext& context, PaintPhase phas
             // https://drafts.csswg.org/css-images/#the-object-fit
             auto object_fit = m_is_svg_image ? CSS::ObjectFit::Contain : computed_values().object_fit();
             if (object_fit == CSS::ObjectFit::ScaleDown) {
-                if (bitmap_rect.width() > image_rect.width() || bitmap_rect.height() > image_rect.height()) {
+                if (natural_rect.width() > image_rect.width() || natural_rect.height() > image_rect.height()) {
                     object_fit = CSS::ObjectFit::Contain;
                 } else {
                     object_fit = CSS::ObjectFit::None;
@@ -96,24 +106,24 @@ void ImagePaintable::paint(DisplayListRecordingContext& context, PaintPhase phas
 
             switch (object_fit) {
             case CSS::ObjectFit::Fill:
-                scale_x = (float)image_rect.width() / bitmap_rect.width();
-                scale_y = (float)image_rect.height() / bitmap_rect.height();
+                scale_x = (float)image_rect.width() / natural_rect.width();
+                scale_y = (float)image_rect.height() / natural_rect.height();
                 break;
             case CSS::ObjectFit::Contain:
-                if (bitmap_aspect_ratio >= image_aspect_ratio) {
-                    scale_x = (float)image_rect.height() / bitmap_rect.height();
+                if (natural_aspect_ratio >= image_aspect_ratio) {
+                    scale_x = (float)image_rect.height() / natural_rect.height();
                     scale_y = scale_x;
                 } else {
-                    scale_x = (float)image_rect.width() / bitmap_rect.width();
+                    scale_x = (float)image_rect.width() / natural_rect.width();
                     scale_y = scale_x;
                 }
                 break;
             case CSS::ObjectFit::Cover:
-                if (bitmap_aspect_ratio >= image_aspect_ratio) {
-                    scale_x = (float)image_rect.width() / bitmap_rect.width();
+                if (natural_aspect_ratio >= image_aspect_ratio) {
+                    scale_x = (float)image_rect.width() / natural_rect.width();
                     scale_y = scale_x;
                 } else {
-                    scale_x = (float)image_rect.height() / bitmap_rect.height();
+                    scale_x = (float)image_rect.height() / natural_rect.height();
                     scale_y = scale_x;
                 }
                 break;
@@ -124,8 +134,8 @@ void ImagePaintable::paint(DisplayListRecordingContext& context, PaintPhase phas
                 scale_y = 1;
             }
 
-            auto scaled_bitmap_width = CSSPixels::nearest_value_for(bitmap_rect.width() * scale_x);
-            auto scaled_bitmap_height = CSSPixels::nearest_value_for(bitmap_rect.height() * scale_y);
+            auto scaled_bitmap_width = CSSPixels::nearest_value_for(natural_rect.width() * scale_x);
+            auto scaled_bitmap_height = CSSPixels::nearest_value_for(natural_rect.height() * scale_y);
 
             auto residual_horizontal = image_rect.width() - scaled_bitmap_width;
             auto residual_vertical = image_rect.height() - scaled_bitmap_height;
@@ -161,6 +171,11 @@ void ImagePaintable::paint(DisplayListRecordingContext& context, PaintPhase phas
 
 void ImagePaintable::did_set_viewport_rect(CSSPixelRect const& viewport_rect)
 {
+    // NOTE: A paintable that has been replaced by a new layout, or whose element is no longer rendered, keeps being told
+    //       about the viewport until it's collected. Leave it to the current paintable, if any, to say what is visible.
+    if (auto dom_node = this->dom_node(); dom_node && dom_node->paintable() != this)
+        return;
+
     const_cast<Layout::ImageProvider&>(m_image_provider).set_visible_in_viewport(viewport_rect.intersects(absolute_rect()));
 }
 
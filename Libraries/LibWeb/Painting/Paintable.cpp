@@ -196,22 +196,59 @@ void Paintable::paint_inspector_overlay(DisplayListRecordingContext& context) co
     }
 }
 
+static void invalidate_commands_recorded_in_enclosing_stacking_context(Paintable const* paintable)
+{
+    for (; paintable; paintable = paintable->parent()) {
+        if (auto const* paintable_box = as_if<PaintableBox>(*paintable); paintable_box && paintable_box->stacking_context()) {
+            paintable_box->stacking_context()->invalidate_recorded_commands();
+            return;
+        }
+    }
+}
+
+void Paintable::invalidate_recorded_commands() const
+{
+    invalidate_commands_recorded_in_enclosing_stacking_context(this);
+
+    // NOTE: Inline content is painted as fragments of its containing block, which may be in another stacking context.
+    invalidate_commands_recorded_in_enclosing_stacking_context(containing_block());
+}
+
 void Paintable::set_needs_display(InvalidateDisplayList should_invalidate_display_list)
 {
     auto& document = const_cast<DOM::Document&>(this->document());
+
     if (should_invalidate_display_list == InvalidateDisplayList::Yes)
-        document.invalidate_display_list();
+        document.invalidate_display_list_for(*this);
 
     auto* containing_block = this->containing_block();
-    if (!containing_block)
+    if (!containing_block || !is<Painting::PaintableWithLines>(*containing_block)) {
+        if (should_invalidate_display_list == InvalidateDisplayList::Yes)
+            document.set_needs_display(InvalidateDisplayList::No);
         return;
+    }
 
-    if (!is<Painting::PaintableWithLines>(*containing_block))
+    // NOTE: Fragments are positioned relative to the contents of their containing block, which are moved around by
+    //       its own scroll offset if it has one.
+    if (containing_block->own_scroll_frame()) {
+        document.set_needs_display(InvalidateDisplayList::No);
         return;
+    }
+
+    bool did_set_needs_display = false;
     static_cast<Painting::PaintableWithLines const&>(*containing_block).for_each_fragment([&](auto& fragment) {
-        document.set_needs_display(fragment.absolute_rect(), InvalidateDisplayList::No);
+        did_set_needs_display = true;
+        auto rect = containing_block->absolute_rect_to_viewport_rect(fragment.absolute_rect());
+        if (!rect.has_value()) {
+            document.set_needs_display(InvalidateDisplayList::No);
+            return IterationDecision::Break;
+        }
+        document.set_needs_display(*rect, InvalidateDisplayList::No);
         return IterationDecision::Continue;
     });
+
+    if (!did_set_needs_display && should_invalidate_display_list == InvalidateDisplayList::Yes)
+        document.set_needs_display(InvalidateDisplayList::No);
 }
 
 CSSPixelPoint Paintable::box_type_agnostic_position() const
@@ -112,6 +112,9 @@ public:
 
     virtual void set_needs_display(InvalidateDisplayList = InvalidateDisplayList::Yes);
 
+    // Makes the stacking contexts this is painted in record their commands again the next time they're painted.
+    void invalidate_recorded_commands() const;
+
     PaintableBox* containing_block() const;
 
     template<typename T>
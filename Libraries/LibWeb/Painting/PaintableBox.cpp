@@ -1090,6 +1090,10 @@ Paintable::DispatchEventOfSameName PaintableBox::handle_mousemove(Badge<EventHan
     if (previous_draw_enlarged_vertical_scrollbar != m_draw_enlarged_vertical_scrollbar)
         set_needs_display();
 
+    if (previous_draw_enlarged_horizontal_scrollbar != m_draw_enlarged_horizontal_scrollbar
+        || previous_draw_enlarged_vertical_scrollbar != m_draw_enlarged_vertical_scrollbar)
+        invalidate_hit_test_bounds();
+
     if (m_draw_enlarged_horizontal_scrollbar || m_draw_enlarged_vertical_scrollbar)
         return Paintable::DispatchEventOfSameName::No;
 
@@ -1188,6 +1192,7 @@ TraversalDecision PaintableBox::hit_test_scrollbars(CSSPixelPoint position, Func
     if (m_draw_enlarged_horizontal_scrollbar) {
         self.m_draw_enlarged_horizontal_scrollbar = false;
         self.set_needs_display();
+        self.invalidate_hit_test_bounds();
     }
 
     if (self.scrollbar_contains_mouse_position(ScrollDirection::Vertical, position))
@@ -1196,6 +1201,7 @@ TraversalDecision PaintableBox::hit_test_scrollbars(CSSPixelPoint position, Func
     if (m_draw_enlarged_vertical_scrollbar) {
         self.m_draw_enlarged_vertical_scrollbar = false;
         self.set_needs_display();
+        self.invalidate_hit_test_bounds();
     }
 
     return TraversalDecision::Continue;
@@ -1285,11 +1291,80 @@ Optional<HitTestResult> PaintableBox::hit_test(CSSPixelPoint position, HitTestTy
     return result;
 }
 
+bool PaintableBox::may_be_hit_at(CSSPixelPoint position) const
+{
+    auto bounds = hit_test_bounds();
+    if (!bounds.has_value())
+        return true;
+    return bounds->contains(adjust_position_for_cumulative_scroll_offset(position));
+}
+
+void PaintableBox::invalidate_hit_test_bounds()
+{
+    for (auto* paintable = static_cast<Paintable*>(this); paintable; paintable = paintable->parent()) {
+        if (auto* paintable_box = as_if<PaintableBox>(*paintable))
+            paintable_box->m_has_computed_hit_test_bounds = false;
+    }
+}
+
+Optional<CSSPixelRect> PaintableBox::hit_test_bounds() const
+{
+    if (!m_has_computed_hit_test_bounds) {
+        m_hit_test_bounds = compute_hit_test_bounds();
+        m_has_computed_hit_test_bounds = true;
+    }
+    return m_hit_test_bounds;
+}
+
+Optional<CSSPixelRect> PaintableBox::compute_hit_test_bounds() const
+{
+    // Transforms and sticky positioning move boxes around without the paint tree changing, and SVG graphics are hit
+    // tested against their geometry rather than their box. Don't try to bound any of those.
+    if (has_css_transform() || is_sticky_position() || is_svg_paintable())
+        return {};
+
+    // An enlarged scrollbar must keep being hit tested so it notices the mouse leaving.
+    if (m_draw_enlarged_horizontal_scrollbar || m_draw_enlarged_vertical_scrollbar)
+        return {};
+
+    auto bounds = absolute_border_box_rect();
+
+    // Descendants of a box that clips its overflow can only be hit inside of it.
+    auto clips_overflow = [](CSS::Overflow overflow) {
+        return overflow == CSS::Overflow::Hidden || overflow == CSS::Overflow::Scroll || overflow == CSS::Overflow::Auto;
+    };
+    if (clips_overflow(computed_values().overflow_x()) && clips_overflow(computed_values().overflow_y()))
+        return bounds;
+
+    if (auto const* paintable_with_lines = as_if<PaintableWithLines>(*this)) {
+        for (auto const& fragment : paintable_with_lines->fragments())
+            bounds.unite(fragment.absolute_rect());
+    }
+
+    // NOTE: This visits the same children as hit_test_children().
+    for (auto const* child = first_child(); child; child = child->next_sibling()) {
+        if (child->layout_node().is_positioned() && child->computed_values().z_index().value_or(0) == 0)
+            continue;
+        if (child->is_svg_paintable())
+            return {};
+        auto const* child_box = as_if<PaintableBox>(*child);
+        if (!child_box)
+            continue;
+        auto child_bounds = child_box->hit_test_bounds();
+        if (!child_bounds.has_value())
+            return {};
+        bounds.unite(*child_bounds);
+    }
+    return bounds;
+}
+
 TraversalDecision PaintableBox::hit_test_children(CSSPixelPoint position, HitTestType type, Function<TraversalDecision(HitTestResult)> const& callback) const
 {
     for (auto const* child = last_child(); child; child = child->previous_sibling()) {
         if (child->layout_node().is_positioned() && child->computed_values().z_index().value_or(0) == 0)
             continue;
+        if (auto const* child_box = as_if<PaintableBox>(*child); type == HitTestType::Exact && child_box && !child_box->may_be_hit_at(position))
+            continue;
         if (child->hit_test(position, type, callback) == TraversalDecision::Break)
             return TraversalDecision::Break;
     }
@@ -1415,7 +1490,36 @@ TraversalDecision PaintableWithLines::hit_test(CSSPixelPoint position, HitTestTy
 
 void PaintableBox::set_needs_display(InvalidateDisplayList should_invalidate_display_list)
 {
-    document().set_needs_display(absolute_rect(), should_invalidate_display_list);
+    // NOTE: The viewport, and the backgrounds of the root element and the body that may be propagated to it, cover
+    //       all of the canvas. Changes that affect the document as a whole are also signaled through the viewport.
+    auto const& layout_node = this->layout_node();
+    if (layout_node.is_viewport() || layout_node.is_root_element() || layout_node.is_body()) {
+        document().set_needs_display(should_invalidate_display_list);
+        return;
+    }
+
+    if (should_invalidate_display_list == InvalidateDisplayList::Yes)
+        document().invalidate_display_list_for(*this);
+
+    if (auto rect = absolute_rect_to_viewport_rect(absolute_paint_rect()); rect.has_value())
+        document().set_needs_display(*rect, InvalidateDisplayList::No);
+    else
+        document().set_needs_display(InvalidateDisplayList::No);
+}
+
+Optional<CSSPixelRect> PaintableBox::absolute_rect_to_viewport_rect(CSSPixelRect const& rect) const
+{
+    for (auto const* paintable = static_cast<Paintable const*>(this); paintable; paintable = paintable->parent()) {
+        if (paintable->is_svg_paintable())
+            return {};
+        auto const* box = as_if<PaintableBox>(*paintable);
+        if (!box)
+            continue;
+        // NOTE: Filters may spread what a box paints beyond its own rect.
+        if (box->has_css_transform() || box->computed_values().filter().has_filters())
+            return {};
+    }
+    return rect.translated(cumulative_offset_of_enclosing_scroll_frame());
 }
 
 Optional<CSSPixelRect> PaintableBox::get_masking_area() const
@@ -1498,6 +1602,9 @@ void PaintableBox::resolve_paint_properties()
 {
     Base::resolve_paint_properties();
 
+    // Paint-only properties like transforms feed into the hit test bounds, so have them computed again.
+    m_has_computed_hit_test_bounds = false;
+
     auto const& computed_values = this->computed_values();
     auto const& layout_node = this->layout_node();
 
@@ -136,6 +136,10 @@ public:
 
     virtual void set_needs_display(InvalidateDisplayList = InvalidateDisplayList::Yes) override;
 
+    // Maps a rect this box paints into, relative to the document, to where it ends up in the viewport. Returns nothing
+    // if that depends on more than scroll offsets, e.g. because this box or one of its ancestors is transformed.
+    Optional<CSSPixelRect> absolute_rect_to_viewport_rect(CSSPixelRect const&) const;
+
     void apply_scroll_offset(DisplayListRecordingContext&) const;
     void reset_scroll_offset(DisplayListRecordingContext&) const;
 
@@ -147,6 +151,10 @@ public:
     [[nodiscard]] TraversalDecision hit_test_children(CSSPixelPoint, HitTestType, Function<TraversalDecision(HitTestResult)> const&) const;
     [[nodiscard]] TraversalDecision hit_test_continuation(Function<TraversalDecision(HitTestResult)> const& callback) const;
 
+    // Returns false if an exact hit test at `position` cannot hit this box or anything that its hit_test() visits.
+    [[nodiscard]] bool may_be_hit_at(CSSPixelPoint position) const;
+    void invalidate_hit_test_bounds();
+
     virtual bool handle_mousewheel(Badge<EventHandler>, CSSPixelPoint, unsigned buttons, unsigned modifiers, int wheel_delta_x, int wheel_delta_y) override;
 
     enum class ConflictingElementKind {
@@ -312,6 +320,9 @@ private:
     bool scrollbar_contains_mouse_position(ScrollDirection, CSSPixelPoint);
     void scroll_to_mouse_position(CSSPixelPoint);
 
+    Optional<CSSPixelRect> hit_test_bounds() const;
+    Optional<CSSPixelRect> compute_hit_test_bounds() const;
+
     OwnPtr<StackingContext> m_stacking_context;
 
     Optional<OverflowData> m_overflow_data;
@@ -322,6 +333,11 @@ private:
     Optional<CSSPixelRect> mutable m_absolute_rect;
     Optional<CSSPixelRect> mutable m_absolute_paint_rect;
 
+    // Bounding rect of everything an exact hit test can find through this box, in the coordinate space of its enclosing
+    // scroll frame. An empty value after computing means the subtree can't be bounded, and is always hit tested.
+    Optional<CSSPixelRect> mutable m_hit_test_bounds;
+    bool mutable m_has_computed_hit_test_bounds { false };
+
     RefPtr<ScrollFrame const> m_enclosing_scroll_frame;
     RefPtr<ScrollFrame const> m_own_scroll_frame;
     RefPtr<ClipFrame const> m_enclosing_clip_frame;
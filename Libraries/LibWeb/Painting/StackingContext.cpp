@@ -45,6 +45,56 @@ StackingContext::StackingContext(PaintableBox& paintable, StackingContext* paren
         m_parent->m_children.append(this);
 }
 
+struct StackingContext::RecordedCommands {
+    struct ChildSplice {
+        // The number of our own commands that are painted before the child.
+        size_t command_index { 0 };
+        StackingContext const* child { nullptr };
+
+        // Our own commands set the scroll frame and clip frame that the child is painted in, e.g. by applying our
+        // scroll offset or overflow clip. Replaying commands doesn't push these on the recorder, so we remember them.
+        Optional<i32> scroll_frame_id;
+        RefPtr<ClipFrame const> clip_frame;
+    };
+
+    double device_pixels_per_css_pixel { 0 };
+    bool should_show_line_box_borders { false };
+    bool should_paint_overlay { false };
+
+    Vector<DisplayList::DisplayListCommandWithScrollAndClip> commands;
+    Vector<ChildSplice> child_splices;
+};
+
+struct StackingContext::Recording {
+    NonnullOwnPtr<RecordedCommands> recorded_commands;
+
+    // The first command in the display list that has not been copied into our recorded commands yet.
+    size_t next_command_index { 0 };
+
+    void copy_commands_up_to(DisplayList const& display_list, size_t end)
+    {
+        auto const& commands = display_list.commands();
+        recorded_commands->commands.ensure_capacity(recorded_commands->commands.size() + end - next_command_index);
+        for (size_t i = next_command_index; i < end; ++i)
+            recorded_commands->commands.unchecked_append(commands[i]);
+        next_command_index = end;
+    }
+};
+
+StackingContext::~StackingContext() = default;
+
+void StackingContext::invalidate_recorded_commands() const
+{
+    m_recorded_commands = nullptr;
+}
+
+void StackingContext::invalidate_recorded_commands_in_subtree() const
+{
+    invalidate_recorded_commands();
+    for (auto const* child : m_children)
+        child->invalidate_recorded_commands_in_subtree();
+}
+
 void StackingContext::sort()
 {
     quick_sort(m_children, [](auto& a, auto& b) {
@@ -196,11 +246,28 @@ void StackingContext::paint_descendants(DisplayListRecordingContext& context, Pa
     });
 }
 
-void StackingContext::paint_child(DisplayListRecordingContext& context, StackingContext const& child)
+void StackingContext::paint_child(DisplayListRecordingContext& context, StackingContext const& child) const
 {
     VERIFY(!child.paintable_box().layout_node().is_svg_box());
     const_cast<StackingContext&>(child).set_last_paint_generation_id(context.paint_generation_id());
+
+    auto& recorder = context.display_list_recorder();
+    auto const& display_list = recorder.display_list();
+    if (m_recording) {
+        m_recording->copy_commands_up_to(display_list, display_list.commands().size());
+        m_recording->recorded_commands->child_splices.append({
+            .command_index = m_recording->recorded_commands->commands.size(),
+            .child = &child,
+            .scroll_frame_id = recorder.current_scroll_frame_id(),
+            .clip_frame = recorder.current_clip_frame(),
+        });
+    }
+
     child.paint(context);
+
+    // NOTE: The child records its own commands, so leave them out of ours.
+    if (m_recording)
+        m_recording->next_command_index = display_list.commands().size();
 }
 
 void StackingContext::paint_internal(DisplayListRecordingContext& context) const
@@ -293,9 +360,62 @@ Gfx::AffineTransform StackingContext::affine_transform_matrix() const
 
 void StackingContext::paint(DisplayListRecordingContext& context) const
 {
-    auto opacity = paintable_box().computed_values().opacity();
-    if (opacity == 0.0f)
+    if (paintable_box().computed_values().opacity() == 0.0f)
+        return;
+
+    if (can_reuse_recorded_commands(context)) {
+        paint_recorded_commands(context);
         return;
+    }
+
+    auto const& display_list = context.display_list_recorder().display_list();
+    auto recorded_commands = make<RecordedCommands>();
+    recorded_commands->device_pixels_per_css_pixel = context.device_pixels_per_css_pixel();
+    recorded_commands->should_show_line_box_borders = context.should_show_line_box_borders();
+    recorded_commands->should_paint_overlay = context.should_paint_overlay();
+    Recording recording { move(recorded_commands), display_list.commands().size() };
+
+    {
+        TemporaryChange change_recording { m_recording, &recording };
+        record(context);
+    }
+
+    recording.copy_commands_up_to(display_list, display_list.commands().size());
+    m_recorded_commands = move(recording.recorded_commands);
+}
+
+bool StackingContext::can_reuse_recorded_commands(DisplayListRecordingContext const& context) const
+{
+    return m_recorded_commands
+        && m_recorded_commands->device_pixels_per_css_pixel == context.device_pixels_per_css_pixel()
+        && m_recorded_commands->should_show_line_box_borders == context.should_show_line_box_borders()
+        && m_recorded_commands->should_paint_overlay == context.should_paint_overlay();
+}
+
+void StackingContext::paint_recorded_commands(DisplayListRecordingContext& context) const
+{
+    auto& recorder = context.display_list_recorder();
+    TemporaryChange save_nesting_level(recorder.m_save_nesting_level, 0);
+
+    auto commands = m_recorded_commands->commands.span();
+    size_t next_command_index = 0;
+    for (auto const& splice : m_recorded_commands->child_splices) {
+        recorder.append_recorded_commands(commands.slice(next_command_index, splice.command_index - next_command_index));
+        recorder.push_scroll_frame_id(splice.scroll_frame_id);
+        recorder.push_clip_frame(splice.clip_frame);
+        paint_child(context, *splice.child);
+        recorder.pop_clip_frame();
+        recorder.pop_scroll_frame_id();
+        next_command_index = splice.command_index;
+    }
+    recorder.append_recorded_commands(commands.slice(next_command_index));
+
+    VERIFY(recorder.m_save_nesting_level == 0);
+}
+
+void StackingContext::record(DisplayListRecordingContext& context) const
+{
+    auto opacity = paintable_box().computed_values().opacity();
 
     TemporaryChange save_nesting_level(context.display_list_recorder().m_save_nesting_level, 0);
     ScopeGuard verify_save_and_restore_are_balanced([&] {
@@ -382,6 +502,11 @@ TraversalDecision StackingContext::hit_test(CSSPixelPoint position, HitTestType
     auto const offset_position = position.translated(-transform_origin).to_type<float>();
     auto const transformed_position = inverse_transform.map(offset_position).to_type<CSSPixels>() + transform_origin;
 
+    // Skip boxes whose hit test bounds rule out the position entirely.
+    auto can_be_hit = [&](PaintableBox const& paintable_box) {
+        return type != HitTestType::Exact || paintable_box.may_be_hit_at(transformed_position);
+    };
+
     // NOTE: Hit testing basically happens in reverse painting order.
     // https://www.w3.org/TR/CSS22/visuren.html#z-index
 
@@ -399,7 +524,7 @@ TraversalDecision StackingContext::hit_test(CSSPixelPoint position, HitTestType
         if (paintable_box->stacking_context()) {
             if (paintable_box->stacking_context()->hit_test(transformed_position, type, callback) == TraversalDecision::Break)
                 return TraversalDecision::Break;
-        } else {
+        } else if (can_be_hit(*paintable_box)) {
             if (paintable_box->hit_test(transformed_position, type, callback) == TraversalDecision::Break)
                 return TraversalDecision::Break;
         }
@@ -409,6 +534,8 @@ TraversalDecision StackingContext::hit_test(CSSPixelPoint position, HitTestType
     if (paintable_box().layout_node().children_are_inline() && is<Layout::BlockContainer>(paintable_box().layout_node())) {
         for (auto const* paintable = paintable_box().last_child(); paintable; paintable = paintable->previous_sibling()) {
             if (paintable->is_inline() && !paintable->is_absolutely_positioned() && !paintable->has_stacking_context()) {
+                if (auto const* paintable_box = as_if<PaintableBox>(*paintable); paintable_box && !can_be_hit(*paintable_box))
+                    continue;
                 if (paintable->hit_test(transformed_position, type, callback) == TraversalDecision::Break)
                     return TraversalDecision::Break;
             }
@@ -417,6 +544,8 @@ TraversalDecision StackingContext::hit_test(CSSPixelPoint position, HitTestType
 
     // 4. the non-positioned floats.
     for (auto const& paintable_box : m_non_positioned_floating_descendants.in_reverse()) {
+        if (!can_be_hit(*paintable_box))
+            continue;
         if (paintable_box->hit_test(transformed_position, type, callback) == TraversalDecision::Break)
             return TraversalDecision::Break;
     }
@@ -428,7 +557,7 @@ TraversalDecision StackingContext::hit_test(CSSPixelPoint position, HitTestType
                 continue;
 
             auto const& paintable_box = as<PaintableBox>(*child);
-            if (!paintable_box.is_absolutely_positioned() && !paintable_box.is_floating() && !paintable_box.stacking_context()) {
+            if (!paintable_box.is_absolutely_positioned() && !paintable_box.is_floating() && !paintable_box.stacking_context() && can_be_hit(paintable_box)) {
                 if (paintable_box.hit_test(transformed_position, type, callback) == TraversalDecision::Break)
                     return TraversalDecision::Break;
             }
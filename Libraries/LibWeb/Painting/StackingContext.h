@@ -18,6 +18,7 @@ class WEB_API StackingContext {
 
 public:
     StackingContext(PaintableBox&, StackingContext* parent, size_t index_in_tree_order);
+    ~StackingContext();
 
     StackingContext* parent() { return m_parent; }
     StackingContext const* parent() const { return m_parent; }
@@ -47,7 +48,16 @@ public:
 
     void set_last_paint_generation_id(u64 generation_id);
 
+    // Forgets the commands recorded the last time this stacking context was painted, so that they are recorded again
+    // the next time. This has to be done whenever anything painted in this stacking context (but not in one of its
+    // children) changes.
+    void invalidate_recorded_commands() const;
+    void invalidate_recorded_commands_in_subtree() const;
+
 private:
+    struct RecordedCommands;
+    struct Recording;
+
     GC::Ref<PaintableBox> m_paintable;
     StackingContext* const m_parent { nullptr };
     Vector<StackingContext*> m_children;
@@ -57,7 +67,16 @@ private:
     Vector<GC::Ref<PaintableBox const>> m_positioned_descendants_and_stacking_contexts_with_stack_level_0;
     Vector<GC::Ref<PaintableBox const>> m_non_positioned_floating_descendants;
 
-    static void paint_child(DisplayListRecordingContext&, StackingContext const&);
+    // The commands of child stacking contexts are not part of the commands recorded for their parent. Instead, the
+    // children are painted again wherever they were spliced in, so that they can reuse their own recorded commands.
+    mutable OwnPtr<RecordedCommands> m_recorded_commands;
+    mutable Recording* m_recording { nullptr };
+
+    bool can_reuse_recorded_commands(DisplayListRecordingContext const&) const;
+    void paint_recorded_commands(DisplayListRecordingContext&) const;
+    void record(DisplayListRecordingContext&) const;
+
+    void paint_child(DisplayListRecordingContext&, StackingContext const&) const;
     void paint_internal(DisplayListRecordingContext&) const;
 };
 
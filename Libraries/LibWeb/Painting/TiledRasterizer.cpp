@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/ScopeGuard.h>
+#include <LibCore/System.h>
+#include <LibGfx/PaintingSurface.h>
+#include <LibThreading/MutexProtected.h>
+#include <LibWeb/Painting/DisplayListPlayerSkia.h>
+#include <LibWeb/Painting/TiledRasterizer.h>
+
+#include <core/SkCanvas.h>
+
+namespace Web::Painting {
+
+class TiledRasterizer::WorkerPool {
+public:
+    // NOTE: Rendering threads are all started from the main thread, so this doesn't race with itself. The pool is never
+    //       destroyed, so that its workers stay around for as long as any rendering thread may need them.
+    static ErrorOr<WorkerPool*> the(size_t worker_count)
+    {
+        if (!s_the)
+            s_the = TRY(create(worker_count)).leak_ptr();
+        return s_the;
+    }
+
+    Vector<Worker> take_idle_workers(size_t max_count)
+    {
+        return m_idle_workers.with_locked([&](auto& idle_workers) {
+            Vector<Worker> workers;
+            auto count = min(max_count, idle_workers.size());
+            workers.ensure_capacity(count);
+            for (size_t i = 0; i < count; ++i)
+                workers.unchecked_append(idle_workers.take_last());
+            return workers;
+        });
+    }
+
+    void return_workers(Vector<Worker>&& workers)
+    {
+        m_idle_workers.with_locked([&](auto& idle_workers) {
+            idle_workers.extend(move(workers));
+        });
+    }
+
+private:
+    static ErrorOr<NonnullOwnPtr<WorkerPool>> create(size_t worker_count)
+    {
+        Vector<Worker> workers;
+        TRY(workers.try_ensure_capacity(worker_count));
+        for (size_t i = 0; i < worker_count; ++i) {
+            auto thread = TRY(Threading::WorkerThread<Error>::create("Rasterizer"sv));
+            workers.unchecked_append({ make<DisplayListPlayerSkia>(), move(thread) });
+        }
+        return adopt_own(*new WorkerPool(move(workers)));
+    }
+
+    explicit WorkerPool(Vector<Worker>&& workers)
+        : m_idle_workers(move(workers))
+    {
+    }
+
+    static inline WorkerPool* s_the { nullptr };
+
+    Threading::MutexProtected<Vector<Worker>> m_idle_workers;
+};
+
+ErrorOr<OwnPtr<TiledRasterizer>> TiledRasterizer::create()
+{
+    auto core_count = Core::System::hardware_concurrency();
+    if (core_count < 2)
+        return nullptr;
+
+    auto* worker_pool = TRY(WorkerPool::the(core_count - 1));
+    return adopt_own(*new TiledRasterizer(*worker_pool, make<DisplayListPlayerSkia>()));
+}
+
+TiledRasterizer::TiledRasterizer(WorkerPool& worker_pool, NonnullOwnPtr<DisplayListPlayerSkia> player)
+    : m_worker_pool(worker_pool)
+    , m_player(move(player))
+{
+}
+
+TiledRasterizer::~TiledRasterizer() = default;
+
+bool TiledRasterizer::rasterize(DisplayList& display_list, ScrollStateSnapshotByDisplayList const& scroll_state_snapshot_by_display_list, Gfx::PaintingSurface& surface)
+{
+    // NOTE: Backdrop filters read from what has been painted around them, which may be in another tile that is still
+    //       being painted.
+    if (display_list.has_backdrop_filters() || display_list.draws_painting_surfaces())
+        return false;
+
+    auto height = surface.size().height();
+    auto max_tile_count = static_cast<size_t>(height / minimum_tile_height);
+    if (max_tile_count < 2)
+        return false;
+
+    // NOTE: Other rendering threads may be using some or all of the workers, in which case we make do with fewer tiles.
+    auto workers = m_worker_pool.take_idle_workers(max_tile_count - 1);
+    ScopeGuard return_workers = [&] { m_worker_pool.return_workers(move(workers)); };
+
+    auto tile_count = workers.size() + 1;
+    if (tile_count < 2)
+        return false;
+
+    struct Tile {
+        int y { 0 };
+        NonnullRefPtr<Gfx::PaintingSurface> surface;
+    };
+    Vector<Tile> tiles;
+    tiles.ensure_capacity(tile_count);
+    for (size_t i = 0; i < tile_count; ++i) {
+        auto top = static_cast<int>(height * i / tile_count);
+        auto bottom = static_cast<int>(height * (i + 1) / tile_count);
+        auto tile_surface = surface.wrap_rows(top, bottom - top);
+        if (!tile_surface)
+            return false;
+        tiles.unchecked_append({ top, tile_surface.release_nonnull() });
+    }
+
+    // NOTE: The tiles paint into the surface's pixels without going through its canvas, so make sure nothing holds on to
+    //       its old contents.
+    surface.notify_content_will_change();
+
+    auto paint_tile = [&](DisplayListPlayerSkia& player, Tile& tile) {
+        // NOTE: Each tile only covers part of the surface, so anything in the display list that is painted entirely
+        //       outside of it is culled by its player as being fully clipped.
+        tile.surface->canvas().translate(0, -tile.y);
+        player.execute(display_list, ScrollStateSnapshotByDisplayList { scroll_state_snapshot_by_display_list }, tile.surface);
+    };
+
+    for (size_t i = 0; i < tile_count - 1; ++i) {
+        auto& worker = workers[i];
+        auto did_start = worker.thread->start_task([&paint_tile, &worker, &tile = tiles[i]]() -> ErrorOr<void> {
+            paint_tile(*worker.player, tile);
+            return {};
+        });
+        VERIFY(did_start);
+    }
+
+    paint_tile(*m_player, tiles.last());
+
+    for (size_t i = 0; i < tile_count - 1; ++i)
+        MUST(workers[i].thread->wait_until_task_is_finished());
+
+    surface.flush();
+    return true;
+}
+
+}
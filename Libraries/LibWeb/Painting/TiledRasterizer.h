@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Error.h>
+#include <AK/NonnullOwnPtr.h>
+#include <AK/Noncopyable.h>
+#include <AK/Vector.h>
+#include <LibGfx/Forward.h>
+#include <LibThreading/WorkerThread.h>
+#include <LibWeb/Forward.h>
+
+namespace Web::Painting {
+
+// Rasterizes display lists into CPU-backed surfaces on several threads at once, by splitting the surface into horizontal
+// tiles that span its entire width and playing the display list into each of them on a separate thread. Tiles are views
+// onto the rows of the surface they belong to, so there is nothing left to stitch together once they have been painted.
+//
+// The worker threads are shared by all tiled rasterizers in the process, so rendering several navigables at the same
+// time doesn't start more threads than there are cores. A rasterizer paints with whichever workers are idle when it
+// starts a frame.
+class TiledRasterizer {
+    AK_MAKE_NONCOPYABLE(TiledRasterizer);
+    AK_MAKE_NONMOVABLE(TiledRasterizer);
+
+public:
+    // Returns null if there aren't enough cores for painting in parallel to be worthwhile.
+    static ErrorOr<OwnPtr<TiledRasterizer>> create();
+    ~TiledRasterizer();
+
+    // Returns false without painting anything if the display list can't be split into tiles, in which case it has to be
+    // played as a whole instead.
+    [[nodiscard]] bool rasterize(DisplayList&, ScrollStateSnapshotByDisplayList const&, Gfx::PaintingSurface&);
+
+private:
+    struct Worker {
+        NonnullOwnPtr<DisplayListPlayerSkia> player;
+        NonnullOwnPtr<Threading::WorkerThread<Error>> thread;
+    };
+    class WorkerPool;
+
+    TiledRasterizer(WorkerPool&, NonnullOwnPtr<DisplayListPlayerSkia>);
+
+    // Tiles any shorter than this are not worth the overhead of painting everything that straddles them again.
+    static constexpr int minimum_tile_height = 128;
+
+    WorkerPool& m_worker_pool;
+
+    // The last tile is painted by the calling thread, so that it isn't left idle while waiting for the workers.
+    NonnullOwnPtr<DisplayListPlayerSkia> m_player;
+};
+
+}
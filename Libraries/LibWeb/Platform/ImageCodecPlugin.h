@@ -7,11 +7,14 @@
 
 #pragma once
 
+#include <AK/Function.h>
+#include <AK/RefCounted.h>
 #include <AK/RefPtr.h>
 #include <AK/Vector.h>
 #include <LibCore/Promise.h>
 #include <LibGfx/ColorSpace.h>
 #include <LibGfx/Forward.h>
+#include <LibGfx/Size.h>
 #include <LibWeb/Export.h>
 
 namespace Web::Platform {
@@ -21,11 +24,61 @@ struct Frame {
     size_t duration { 0 };
 };
 
+// Decodes the remaining frames of an animated image whose frames are decoded lazily. The image decoder holds on to the
+// encoded image for as long as this object is alive.
+class WEB_API AnimationFrameDecoder : public RefCounted<AnimationFrameDecoder> {
+public:
+    virtual ~AnimationFrameDecoder() = default;
+
+    // Only one request is in flight at a time; a request made while another one is in flight may replace it.
+    virtual void request_frames(size_t start_frame_index, size_t count) = 0;
+
+    // Frames that could not be decoded have a null bitmap.
+    Function<void(size_t start_frame_index, Vector<Frame>&)> on_frames_decoded;
+
+    // Invoked instead if no more frames can be decoded, e.g. because the image decoder has gone away. This may happen
+    // from within request_frames().
+    Function<void()> on_failure;
+
+    // The color space of the image, which all of its frames are in.
+    Gfx::ColorSpace color_space;
+};
+
 struct DecodedImage {
     bool is_animated { false };
     u32 loop_count { 0 };
+    u32 frame_count { 0 };
+    // The size of the image, which its frames may have been decoded at a fraction of.
+    Gfx::IntSize natural_size;
     Vector<Frame> frames;
     Gfx::ColorSpace color_space;
+
+    // Set if fewer than frame_count frames were decoded.
+    RefPtr<AnimationFrameDecoder> frame_decoder;
+};
+
+enum class AnimationFrameDecoding {
+    Eager,
+    Lazy,
+};
+
+// Decodes an image while its encoded data is still arriving, e.g. over the network, so that what has arrived of it can
+// be shown in the meantime. The image decoder gives up on the image if this goes away before it's finished.
+class WEB_API IncrementalImageDecoder : public RefCounted<IncrementalImageDecoder> {
+public:
+    virtual ~IncrementalImageDecoder() = default;
+
+    virtual ErrorOr<void> append_encoded_data(ReadonlyBytes) = 0;
+
+    // The encoded data appended so far. This is only available until the decode is finished.
+    virtual ReadonlyBytes encoded_data() const = 0;
+
+    // Decodes the whole image, once all of its encoded data has been appended.
+    virtual NonnullRefPtr<Core::Promise<DecodedImage>> finish(ESCAPING Function<ErrorOr<void>(DecodedImage&)> on_resolved, ESCAPING Function<void(Error&)> on_rejected, Optional<Gfx::IntSize> ideal_size = {}, AnimationFrameDecoding = AnimationFrameDecoding::Eager) = 0;
+
+    // Invoked with what can be shown of the image so far as more of its encoded data arrives, for the image formats that
+    // can be shown in part.
+    Function<void(NonnullRefPtr<Gfx::Bitmap>, Gfx::ColorSpace const&)> on_partial_image_decoded;
 };
 
 class WEB_API ImageCodecPlugin {
@@ -35,7 +88,10 @@ public:
 
     virtual ~ImageCodecPlugin();
 
-    virtual NonnullRefPtr<Core::Promise<DecodedImage>> decode_image(ReadonlyBytes, ESCAPING Function<ErrorOr<void>(DecodedImage&)> on_resolved, ESCAPING Function<void(Error&)> on_rejected) = 0;
+    virtual NonnullRefPtr<Core::Promise<DecodedImage>> decode_image(ReadonlyBytes, ESCAPING Function<ErrorOr<void>(DecodedImage&)> on_resolved, ESCAPING Function<void(Error&)> on_rejected, Optional<Gfx::IntSize> ideal_size = {}, AnimationFrameDecoding = AnimationFrameDecoding::Eager) = 0;
+
+    // Returns null if the image decoder is unavailable.
+    virtual RefPtr<IncrementalImageDecoder> start_incremental_decode() = 0;
 };
 
 }
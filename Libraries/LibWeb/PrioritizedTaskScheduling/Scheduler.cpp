@@ -0,0 +1,524 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/BinarySearch.h>
+#include <LibWeb/Bindings/Intrinsics.h>
+#include <LibWeb/Bindings/SchedulerPrototype.h>
+#include <LibWeb/HTML/EventLoop/EventLoop.h>
+#include <LibWeb/HTML/Scripting/Agent.h>
+#include <LibWeb/HTML/Scripting/TemporaryExecutionContext.h>
+#include <LibWeb/HTML/Window.h>
+#include <LibWeb/HTML/WindowOrWorkerGlobalScope.h>
+#include <LibWeb/PrioritizedTaskScheduling/Scheduler.h>
+#include <LibWeb/PrioritizedTaskScheduling/TaskSignal.h>
+#include <LibWeb/WebIDL/AbstractOperations.h>
+#include <LibWeb/WebIDL/Promise.h>
+
+namespace Web::PrioritizedTaskScheduling {
+
+GC_DEFINE_ALLOCATOR(Scheduler);
+GC_DEFINE_ALLOCATOR(SchedulerTaskQueue);
+GC_DEFINE_ALLOCATOR(SchedulingState);
+GC_DEFINE_ALLOCATOR(TaskHandle);
+
+void SchedulingState::visit_edges(Visitor& visitor)
+{
+    Base::visit_edges(visitor);
+    visitor.visit(m_abort_source);
+    visitor.visit(m_priority_source);
+}
+
+SchedulerTaskQueue::SchedulerTaskQueue(Bindings::TaskPriority priority, bool is_continuation, GC::Ref<GC::Function<void()>> removal_steps)
+    : m_priority(priority)
+    , m_is_continuation(is_continuation)
+    , m_removal_steps(removal_steps)
+{
+}
+
+void SchedulerTaskQueue::visit_edges(Visitor& visitor)
+{
+    Base::visit_edges(visitor);
+    for (size_t i = m_head; i < m_tasks.size(); ++i)
+        visitor.visit(m_tasks[i].steps);
+    visitor.visit(m_removal_steps);
+}
+
+static u8 effective_priority_of(Bindings::TaskPriority priority, bool is_continuation)
+{
+    // https://wicg.github.io/scheduling-apis/#scheduler-task-queue-effective-priority
+    // Continuations run before other tasks of the same priority, but after all of those of a higher priority.
+    u8 value = 0;
+    switch (priority) {
+    case Bindings::TaskPriority::Background:
+        value = 0;
+        break;
+    case Bindings::TaskPriority::UserVisible:
+        value = 2;
+        break;
+    case Bindings::TaskPriority::UserBlocking:
+        value = 4;
+        break;
+    }
+    return is_continuation ? value + 1 : value;
+}
+
+static HTML::Task::Priority event_loop_priority_for(Bindings::TaskPriority priority)
+{
+    switch (priority) {
+    case Bindings::TaskPriority::UserBlocking:
+        return HTML::Task::Priority::UserBlocking;
+    case Bindings::TaskPriority::UserVisible:
+        return HTML::Task::Priority::Normal;
+    case Bindings::TaskPriority::Background:
+        return HTML::Task::Priority::Background;
+    }
+    VERIFY_NOT_REACHED();
+}
+
+u8 SchedulerTaskQueue::effective_priority() const
+{
+    return effective_priority_of(m_priority, m_is_continuation);
+}
+
+void SchedulerTaskQueue::append(SchedulerTask task)
+{
+    VERIFY(m_tasks.is_empty() || m_tasks.last().enqueue_order < task.enqueue_order);
+    m_tasks.append(move(task));
+    ++m_size;
+}
+
+SchedulerTaskQueue::SchedulerTask SchedulerTaskQueue::take_first()
+{
+    auto task = m_tasks[m_head++];
+    --m_size;
+    skip_removed_tasks();
+    return task;
+}
+
+bool SchedulerTaskQueue::remove(u64 enqueue_order)
+{
+    size_t index = 0;
+    auto* task = binary_search(m_tasks.span().slice(m_head), enqueue_order, &index, [](u64 enqueue_order, SchedulerTask const& task) {
+        if (enqueue_order == task.enqueue_order)
+            return 0;
+        return enqueue_order < task.enqueue_order ? -1 : 1;
+    });
+    if (!task || !task->steps)
+        return false;
+
+    task->steps = nullptr;
+    --m_size;
+    if (index == 0)
+        skip_removed_tasks();
+    return true;
+}
+
+// Moves the head past removed tasks, so that it's always at a task that is still in the queue, and drops the tasks
+// before it once there are enough of them.
+void SchedulerTaskQueue::skip_removed_tasks()
+{
+    while (m_head < m_tasks.size() && !m_tasks[m_head].steps)
+        ++m_head;
+
+    if (m_head == m_tasks.size()) {
+        m_tasks.clear_with_capacity();
+        m_head = 0;
+    } else if (m_head >= 64 && m_head >= m_tasks.size() / 2) {
+        m_tasks.remove(0, m_head);
+        m_head = 0;
+    }
+}
+
+void TaskHandle::visit_edges(Visitor& visitor)
+{
+    Base::visit_edges(visitor);
+    visitor.visit(m_queue);
+    visitor.visit(m_abort_steps);
+    visitor.visit(m_task_complete_steps);
+}
+
+GC::Ref<Scheduler> Scheduler::create(JS::Realm& realm)
+{
+    return realm.create<Scheduler>(realm);
+}
+
+Scheduler::Scheduler(JS::Realm& realm)
+    : PlatformObject(realm)
+{
+}
+
+Scheduler::~Scheduler() = default;
+
+void Scheduler::initialize(JS::Realm& realm)
+{
+    WEB_SET_PROTOTYPE_FOR_INTERFACE(Scheduler);
+    Base::initialize(realm);
+}
+
+void Scheduler::visit_edges(Cell::Visitor& visitor)
+{
+    Base::visit_edges(visitor);
+    visitor.visit(m_static_priority_task_queues);
+    visitor.visit(m_dynamic_priority_task_queues);
+    visitor.visit(m_dynamic_priority_continuation_task_queues);
+}
+
+// https://wicg.github.io/scheduling-apis/#dom-scheduler-posttask
+GC::Ref<WebIDL::Promise> Scheduler::post_task(GC::Ref<WebIDL::CallbackType> callback, SchedulerPostTaskOptions const& options)
+{
+    // The postTask(callback, options) method steps are to return the result of scheduling a postTask task for this
+    // given callback and options.
+
+    // https://wicg.github.io/scheduling-apis/#schedule-a-posttask-task
+    auto& realm = this->realm();
+
+    // 1. Let result be a new promise.
+    auto result = WebIDL::create_promise(realm);
+
+    // 2. Let signal be options["signal"] if options["signal"] exists, or otherwise null.
+    auto signal = options.signal;
+
+    // 3. If signal is not null and it is aborted, then reject result with signal’s abort reason and return result.
+    if (signal && signal->aborted()) {
+        WebIDL::reject_promise(realm, result, signal->reason());
+        return result;
+    }
+
+    // 4. Let state be a new scheduling state.
+    auto state = heap().allocate<SchedulingState>();
+
+    // 5. Set state’s abort source to signal.
+    state->set_abort_source(signal);
+
+    // 6. If options["priority"] exists, then set state’s priority source to the result of creating a fixed priority
+    //    unabortable task signal given options["priority"].
+    if (options.priority.has_value())
+        state->set_priority_source(TaskSignal::create_fixed_priority_unabortable_task_signal(realm, *options.priority));
+    // 7. Otherwise if signal is not null and implements the TaskSignal interface, then set state’s priority source to
+    //    signal.
+    else if (auto* task_signal = as_if<TaskSignal>(signal.ptr()))
+        state->set_priority_source(task_signal);
+
+    // 8. If state’s priority source is null, then set state’s priority source to the result of creating a fixed
+    //    priority unabortable task signal given "user-visible".
+    if (!state->priority_source())
+        state->set_priority_source(TaskSignal::create_fixed_priority_unabortable_task_signal(realm, Bindings::TaskPriority::UserVisible));
+
+    // 9. Let handle be the result of creating a task handle given result and signal.
+    auto handle = create_a_task_handle(result, signal);
+
+    // 10. If signal is not null, then add handle’s abort steps to signal.
+    if (signal)
+        handle->set_abort_algorithm_id(signal->add_abort_algorithm([handle] { handle->run_abort_steps(); }));
+
+    // 11. Let enqueueSteps be the following steps:
+    auto enqueue_steps = GC::create_function(heap(), [self = GC::Ref { *this }, state, handle, callback, result] {
+        // 1. Set handle’s queue to the result of selecting the scheduler task queue for scheduler given state’s
+        //    priority source and false.
+        handle->set_queue(self->select_the_scheduler_task_queue(*state->priority_source(), false));
+
+        // 2. Schedule a task to invoke an algorithm for scheduler given handle and the following steps:
+        self->schedule_a_task_to_invoke_an_algorithm(handle, [self, state, callback, result] {
+            auto& realm = self->realm();
+
+            // 1. Let event loop be the scheduler’s relevant agent's event loop.
+            auto& event_loop = *HTML::relevant_agent(*self).event_loop;
+
+            // 2. Set event loop’s current scheduling state to state.
+            event_loop.set_current_scheduling_state(state);
+
+            // 3. Let callbackResult be the result of invoking callback with « » and "rethrow". If that threw an
+            //    exception, then reject result with that. Otherwise, resolve result with callbackResult.
+            auto callback_result = WebIDL::invoke_callback(*callback, {}, WebIDL::ExceptionBehavior::Rethrow, {});
+
+            HTML::TemporaryExecutionContext context(realm, HTML::TemporaryExecutionContext::CallbacksEnabled::Yes);
+            if (callback_result.is_error())
+                WebIDL::reject_promise(realm, result, callback_result.release_value());
+            else
+                WebIDL::resolve_promise(realm, result, callback_result.release_value());
+
+            // 4. Set event loop’s current scheduling state to null.
+            event_loop.set_current_scheduling_state(nullptr);
+        });
+    });
+
+    // 12. Let delay be options["delay"].
+    auto delay = options.delay;
+
+    // 13. If delay is greater than 0, then run steps after a timeout given scheduler’s relevant global object,
+    //     "scheduler-postTask", delay, and the following steps:
+    if (delay > 0) {
+        auto& window_or_worker = as<HTML::WindowOrWorkerGlobalScopeMixin>(HTML::relevant_global_object(*this));
+        auto timeout = static_cast<i32>(min(delay, static_cast<WebIDL::UnsignedLongLong>(NumericLimits<i32>::max())));
+
+        window_or_worker.run_steps_after_a_timeout(timeout, [signal, enqueue_steps] {
+            // 1. If signal is not null and signal is aborted, then abort these steps.
+            if (signal && signal->aborted())
+                return;
+
+            // 2. Run enqueueSteps.
+            enqueue_steps->function()();
+        });
+    }
+    // 14. Otherwise, run enqueueSteps.
+    else {
+        enqueue_steps->function()();
+    }
+
+    // 15. Return result.
+    return result;
+}
+
+// https://wicg.github.io/scheduling-apis/#dom-scheduler-yield
+GC::Ref<WebIDL::Promise> Scheduler::yield()
+{
+    auto& realm = this->realm();
+
+    // 1. Let inheritedState be the scheduler’s relevant agent's event loop’s current scheduling state.
+    // FIXME: The spec has the state carried over into the continuations of async functions too, which would need the
+    //        promise jobs to know which state was current when they were queued.
+    auto inherited_state = HTML::relevant_agent(*this).event_loop->current_scheduling_state();
+
+    // 2. Let abortSource be inheritedState’s abort source if inheritedState is not null, or otherwise null.
+    GC::Ptr<DOM::AbortSignal> abort_source = inherited_state ? inherited_state->abort_source() : nullptr;
+
+    // 3. If abortSource is not null and abortSource is aborted, then return a promise rejected with abortSource’s
+    //    abort reason.
+    if (abort_source && abort_source->aborted())
+        return WebIDL::create_rejected_promise(realm, abort_source->reason());
+
+    // 4. Let prioritySource be inheritedState’s priority source if inheritedState is not null, or otherwise null.
+    GC::Ptr<TaskSignal> priority_source = inherited_state ? inherited_state->priority_source() : nullptr;
+
+    // 5. If prioritySource is null, then set prioritySource to the result of creating a fixed priority unabortable
+    //    task signal given "user-visible".
+    if (!priority_source)
+        priority_source = TaskSignal::create_fixed_priority_unabortable_task_signal(realm, Bindings::TaskPriority::UserVisible);
+
+    // 6. Let result be a new promise.
+    auto result = WebIDL::create_promise(realm);
+
+    // 7. Let handle be the result of creating a task handle given result and abortSource.
+    auto handle = create_a_task_handle(result, abort_source);
+
+    // 8. If abortSource is not null, then add handle’s abort steps to abortSource.
+    if (abort_source)
+        handle->set_abort_algorithm_id(abort_source->add_abort_algorithm([handle] { handle->run_abort_steps(); }));
+
+    // 9. Set handle’s queue to the result of selecting the scheduler task queue for this given prioritySource and true.
+    handle->set_queue(select_the_scheduler_task_queue(*priority_source, true));
+
+    // 10. Schedule a task to invoke an algorithm for this given handle and the following steps:
+    schedule_a_task_to_invoke_an_algorithm(handle, [&realm, result] {
+        // 1. Resolve result.
+        HTML::TemporaryExecutionContext context(realm, HTML::TemporaryExecutionContext::CallbacksEnabled::Yes);
+        WebIDL::resolve_promise(realm, result);
+    });
+
+    // 11. Return result.
+    return result;
+}
+
+// https://wicg.github.io/scheduling-apis/#create-a-task-handle
+GC::Ref<TaskHandle> Scheduler::create_a_task_handle(GC::Ref<WebIDL::Promise> promise, GC::Ptr<DOM::AbortSignal> signal)
+{
+    // 1. Let handle be a new task handle.
+    // 2. Set handle’s task to null.
+    // 3. Set handle’s queue to null.
+    auto handle = heap().allocate<TaskHandle>();
+
+    // 4. Set handle’s abort steps to the following steps:
+    handle->set_abort_steps(GC::create_function(heap(), [self = GC::Ref { *this }, handle, promise, signal] {
+        // 1. Reject promise with signal’s abort reason.
+        WebIDL::reject_promise(self->realm(), promise, signal->reason());
+
+        // 2. If task is not null, then
+        if (auto task = handle->task(); task.has_value()) {
+            // 1. Remove task from queue.
+            // NOTE: The task we queued on the event loop for it stays behind. It either runs another scheduler task of
+            //       the same priority a little early, or nothing at all, which is cheaper than finding it among all of
+            //       the event loop's tasks.
+            handle->queue()->remove(*task);
+
+            // 2. If queue is empty, then run queue’s removal steps.
+            if (handle->queue()->is_empty())
+                handle->queue()->run_removal_steps();
+        }
+    }));
+
+    // 5. Set handle’s task complete steps to the following steps:
+    handle->set_task_complete_steps(GC::create_function(heap(), [handle, signal] {
+        // 1. If signal is not null, then remove handle’s abort steps from signal.
+        if (signal && handle->abort_algorithm_id().has_value())
+            signal->remove_abort_algorithm(*handle->abort_algorithm_id());
+
+        // 2. If handle’s queue is empty, then run handle’s queue’s removal steps.
+        if (handle->queue()->is_empty())
+            handle->queue()->run_removal_steps();
+    }));
+
+    // 6. Return handle.
+    return handle;
+}
+
+// https://wicg.github.io/scheduling-apis/#scheduler-select-the-scheduler-task-queue
+GC::Ref<SchedulerTaskQueue> Scheduler::select_the_scheduler_task_queue(TaskSignal& signal, bool is_continuation)
+{
+    // 1. If signal does not have fixed priority, then:
+    if (!signal.has_fixed_priority()) {
+        auto& queues = is_continuation ? m_dynamic_priority_continuation_task_queues : m_dynamic_priority_task_queues;
+
+        // 1. If scheduler’s dynamic priority task queue map does not contain (signal, isContinuation), then:
+        if (auto queue = queues.get(signal); queue.has_value())
+            return *queue;
+
+        // 1. Let queue be the result of creating a scheduler task queue given signal’s priority, isContinuation,
+        //    and the following steps:
+        auto queue = heap().allocate<SchedulerTaskQueue>(signal.priority(), is_continuation, GC::create_function(heap(), [self = GC::Ref { *this }, signal = GC::Ref { signal }, is_continuation] {
+            // 1. Remove scheduler’s dynamic priority task queue map[(signal, isContinuation)].
+            auto& queues = is_continuation ? self->m_dynamic_priority_continuation_task_queues : self->m_dynamic_priority_task_queues;
+            queues.remove(signal);
+        }));
+
+        // 2. Set dynamic priority task queue map[(signal, isContinuation)] to queue.
+        queues.set(signal, queue);
+
+        // 3. Add a priority change algorithm to signal that runs the following steps:
+        signal.add_priority_change_algorithm([self = GC::Ref { *this }, signal = GC::Ref { signal }, queue] {
+            // 1. Set queue’s priority to signal’s priority.
+            auto previous_priority = queue->priority();
+            queue->set_priority(signal->priority());
+
+            // NOTE: The tasks we queued on the event loop for the queue's tasks have to follow suit.
+            self->requeue_event_loop_tasks(queue, previous_priority);
+        });
+
+        // 2. Return dynamic priority task queue map[(signal, isContinuation)].
+        return queue;
+    }
+
+    // 2. Otherwise:
+    // 1. Let priority be signal’s priority.
+    auto priority = signal.priority();
+    auto key = effective_priority_of(priority, is_continuation);
+
+    // 2. If scheduler’s static priority task queue map does not contain (priority, isContinuation), then:
+    if (auto queue = m_static_priority_task_queues.get(key); queue.has_value())
+        return *queue;
+
+    // 1. Let queue be the result of creating a scheduler task queue given priority, isContinuation, and the following
+    //    steps:
+    auto queue = heap().allocate<SchedulerTaskQueue>(priority, is_continuation, GC::create_function(heap(), [self = GC::Ref { *this }, key] {
+        // 1. Remove scheduler’s static priority task queue map[(priority, isContinuation)].
+        self->m_static_priority_task_queues.remove(key);
+    }));
+
+    // 2. Set static priority task queue map[(priority, isContinuation)] to queue.
+    m_static_priority_task_queues.set(key, queue);
+
+    // 3. Return static priority task queue map[(priority, isContinuation)].
+    return queue;
+}
+
+// https://wicg.github.io/scheduling-apis/#schedule-a-task-to-invoke-an-algorithm
+void Scheduler::schedule_a_task_to_invoke_an_algorithm(GC::Ref<TaskHandle> handle, Function<void()> algorithm)
+{
+    // 1. Let global be the relevant global object for scheduler.
+    // 2. Let document be global’s associated Document if global is a Window object; otherwise null.
+    // 3. Let event loop be the scheduler’s relevant agent's event loop.
+    // NOTE: These are used by queue_an_event_loop_task() below.
+
+    // 4. Set handle’s task to the result of queuing a scheduler task on handle’s queue given the posted task task
+    //    source, document, and the following steps:
+    auto steps = GC::create_function(heap(), [handle, algorithm = move(algorithm)] {
+        // 1. Run algorithm.
+        algorithm();
+
+        // 2. Run handle’s task complete steps.
+        handle->run_task_complete_steps();
+    });
+
+    // https://wicg.github.io/scheduling-apis/#queue-a-scheduler-task
+    // 1. Let task be a new task.
+    // 2. Set task’s steps to steps.
+    // 3. Set task’s source to source.
+    // 4. Set task’s document to document.
+    // 5. Set task’s script evaluation environment settings object set to an empty set.
+    // 6. Set task’s enqueue order to scheduler’s next enqueue order.
+    // 7. Increment scheduler’s next enqueue order by 1.
+    auto enqueue_order = m_next_enqueue_order++;
+
+    // 8. Append task to queue.
+    auto& queue = *handle->queue();
+    queue.append({ enqueue_order, steps });
+    handle->set_task(enqueue_order);
+
+    // NOTE: The event loop would pick the scheduler task queue to take a task from along with all of its own task
+    //       queues. Instead, each scheduler task gets a task on the event loop's posted task task source, with the
+    //       event loop's priority that is closest to that of the scheduler task queue. Those tasks are interchangeable
+    //       among those of the same priority, and each runs whichever scheduler task of its priority should run next.
+    queue_an_event_loop_task(event_loop_priority_for(queue.priority()));
+}
+
+void Scheduler::queue_an_event_loop_task(HTML::Task::Priority priority)
+{
+    auto& global = HTML::relevant_global_object(*this);
+    GC::Ptr<DOM::Document> document;
+    if (auto* window = as_if<HTML::Window>(global))
+        document = &window->associated_document();
+
+    auto task = HTML::Task::create(vm(), HTML::Task::Source::PostedTask, document, GC::create_function(heap(), [self = GC::Ref { *this }, priority] {
+        self->run_the_next_scheduler_task(priority);
+    }));
+    task->set_priority(priority);
+    HTML::relevant_agent(*this).event_loop->task_queue().add(task);
+}
+
+void Scheduler::requeue_event_loop_tasks(SchedulerTaskQueue const& queue, Bindings::TaskPriority previous_priority)
+{
+    auto previous_event_loop_priority = event_loop_priority_for(previous_priority);
+    auto event_loop_priority = event_loop_priority_for(queue.priority());
+    if (previous_event_loop_priority == event_loop_priority)
+        return;
+
+    // NOTE: The event loop tasks at the previous priority stay behind, just like those of aborted tasks.
+    for (size_t i = 0; i < queue.size(); ++i)
+        queue_an_event_loop_task(event_loop_priority);
+}
+
+// Takes the scheduler task that the event loop would pick next among those whose queue has the given priority on the
+// event loop, which is the oldest one in the queue with the highest effective priority, and runs it.
+void Scheduler::run_the_next_scheduler_task(HTML::Task::Priority priority)
+{
+    GC::Ptr<SchedulerTaskQueue> chosen_queue;
+    auto consider = [&](SchedulerTaskQueue& queue) {
+        if (queue.is_empty() || event_loop_priority_for(queue.priority()) != priority)
+            return;
+        if (chosen_queue) {
+            if (queue.effective_priority() < chosen_queue->effective_priority())
+                return;
+            if (queue.effective_priority() == chosen_queue->effective_priority() && queue.first().enqueue_order > chosen_queue->first().enqueue_order)
+                return;
+        }
+        chosen_queue = queue;
+    };
+    for (auto& it : m_static_priority_task_queues)
+        consider(it.value);
+    for (auto& it : m_dynamic_priority_task_queues)
+        consider(it.value);
+    for (auto& it : m_dynamic_priority_continuation_task_queues)
+        consider(it.value);
+
+    // NOTE: There are at least as many of our event loop tasks of each priority as there are scheduler tasks. Those of
+    //       aborted tasks, or of tasks whose priority changed, find nothing left to run here.
+    if (!chosen_queue)
+        return;
+
+    auto task = chosen_queue->take_first();
+    task.steps->function()();
+}
+
+}
@@ -0,0 +1,191 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/HashMap.h>
+#include <LibGC/Function.h>
+#include <LibWeb/Bindings/PlatformObject.h>
+#include <LibWeb/Bindings/SchedulerPrototype.h>
+#include <LibWeb/DOM/AbortSignal.h>
+#include <LibWeb/HTML/EventLoop/Task.h>
+#include <LibWeb/WebIDL/Types.h>
+
+namespace Web::PrioritizedTaskScheduling {
+
+// https://wicg.github.io/scheduling-apis/#dictdef-schedulerposttaskoptions
+struct SchedulerPostTaskOptions {
+    GC::Ptr<DOM::AbortSignal> signal;
+    Optional<Bindings::TaskPriority> priority;
+    WebIDL::UnsignedLongLong delay { 0 };
+};
+
+// https://wicg.github.io/scheduling-apis/#scheduling-state
+class SchedulingState final : public JS::Cell {
+    GC_CELL(SchedulingState, JS::Cell);
+    GC_DECLARE_ALLOCATOR(SchedulingState);
+
+public:
+    GC::Ptr<DOM::AbortSignal> abort_source() const { return m_abort_source; }
+    void set_abort_source(GC::Ptr<DOM::AbortSignal> abort_source) { m_abort_source = abort_source; }
+
+    GC::Ptr<TaskSignal> priority_source() const { return m_priority_source; }
+    void set_priority_source(GC::Ptr<TaskSignal> priority_source) { m_priority_source = priority_source; }
+
+private:
+    SchedulingState() = default;
+
+    virtual void visit_edges(Visitor&) override;
+
+    // https://wicg.github.io/scheduling-apis/#scheduling-state-abort-source
+    GC::Ptr<DOM::AbortSignal> m_abort_source;
+
+    // https://wicg.github.io/scheduling-apis/#scheduling-state-priority-source
+    GC::Ptr<TaskSignal> m_priority_source;
+};
+
+// https://wicg.github.io/scheduling-apis/#scheduler-task-queue
+class SchedulerTaskQueue final : public JS::Cell {
+    GC_CELL(SchedulerTaskQueue, JS::Cell);
+    GC_DECLARE_ALLOCATOR(SchedulerTaskQueue);
+
+public:
+    // https://wicg.github.io/scheduling-apis/#scheduler-task
+    struct SchedulerTask {
+        u64 enqueue_order { 0 };
+        // NOTE: This is null for tasks that have been removed from the queue, but not dropped from it yet.
+        GC::Ptr<GC::Function<void()>> steps;
+    };
+
+    Bindings::TaskPriority priority() const { return m_priority; }
+    void set_priority(Bindings::TaskPriority priority) { m_priority = priority; }
+
+    bool is_continuation() const { return m_is_continuation; }
+
+    // https://wicg.github.io/scheduling-apis/#scheduler-task-queue-effective-priority
+    u8 effective_priority() const;
+
+    bool is_empty() const { return m_size == 0; }
+    size_t size() const { return m_size; }
+    SchedulerTask const& first() const { return m_tasks[m_head]; }
+
+    void append(SchedulerTask);
+    SchedulerTask take_first();
+    bool remove(u64 enqueue_order);
+
+    void run_removal_steps() { m_removal_steps->function()(); }
+
+private:
+    SchedulerTaskQueue(Bindings::TaskPriority, bool is_continuation, GC::Ref<GC::Function<void()>> removal_steps);
+
+    virtual void visit_edges(Visitor&) override;
+
+    // https://wicg.github.io/scheduling-apis/#scheduler-task-queue-priority
+    Bindings::TaskPriority m_priority;
+
+    // https://wicg.github.io/scheduling-apis/#scheduler-task-queue-is-continuation
+    bool m_is_continuation { false };
+
+    void skip_removed_tasks();
+
+    // https://wicg.github.io/scheduling-apis/#scheduler-task-queue-tasks
+    // NOTE: Tasks are only ever appended with an enqueue order greater than that of all those before them, so keeping
+    //       them in a list sorts them by enqueue order. Tasks before the head have already been taken, and removed
+    //       tasks stay in the list without steps. Both are only dropped every once in a while, so that neither taking
+    //       nor removing a task has to move all those after it.
+    Vector<SchedulerTask> m_tasks;
+    size_t m_head { 0 };
+    size_t m_size { 0 };
+
+    // https://wicg.github.io/scheduling-apis/#scheduler-task-queue-removal-steps
+    GC::Ref<GC::Function<void()>> m_removal_steps;
+};
+
+// https://wicg.github.io/scheduling-apis/#task-handle
+class TaskHandle final : public JS::Cell {
+    GC_CELL(TaskHandle, JS::Cell);
+    GC_DECLARE_ALLOCATOR(TaskHandle);
+
+public:
+    // The enqueue order of the handle's scheduler task, if it has been queued.
+    Optional<u64> task() const { return m_task; }
+    void set_task(Optional<u64> task) { m_task = task; }
+
+    GC::Ptr<SchedulerTaskQueue> queue() const { return m_queue; }
+    void set_queue(GC::Ptr<SchedulerTaskQueue> queue) { m_queue = queue; }
+
+    void set_abort_steps(GC::Ref<GC::Function<void()>> abort_steps) { m_abort_steps = abort_steps; }
+    void run_abort_steps() { m_abort_steps->function()(); }
+
+    void set_task_complete_steps(GC::Ref<GC::Function<void()>> task_complete_steps) { m_task_complete_steps = task_complete_steps; }
+    void run_task_complete_steps() { m_task_complete_steps->function()(); }
+
+    Optional<DOM::AbortSignal::AbortAlgorithmID> abort_algorithm_id() const { return m_abort_algorithm_id; }
+    void set_abort_algorithm_id(Optional<DOM::AbortSignal::AbortAlgorithmID> id) { m_abort_algorithm_id = id; }
+
+private:
+    TaskHandle() = default;
+
+    virtual void visit_edges(Visitor&) override;
+
+    // https://wicg.github.io/scheduling-apis/#task-handle-task
+    Optional<u64> m_task;
+
+    // https://wicg.github.io/scheduling-apis/#task-handle-queue
+    GC::Ptr<SchedulerTaskQueue> m_queue;
+
+    // https://wicg.github.io/scheduling-apis/#task-handle-abort-steps
+    GC::Ptr<GC::Function<void()>> m_abort_steps;
+
+    // https://wicg.github.io/scheduling-apis/#task-handle-task-complete-steps
+    GC::Ptr<GC::Function<void()>> m_task_complete_steps;
+
+    Optional<DOM::AbortSignal::AbortAlgorithmID> m_abort_algorithm_id;
+};
+
+// https://wicg.github.io/scheduling-apis/#scheduler
+class Scheduler final : public Bindings::PlatformObject {
+    WEB_PLATFORM_OBJECT(Scheduler, Bindings::PlatformObject);
+    GC_DECLARE_ALLOCATOR(Scheduler);
+
+public:
+    [[nodiscard]] static GC::Ref<Scheduler> create(JS::Realm&);
+
+    virtual ~Scheduler() override;
+
+    GC::Ref<WebIDL::Promise> post_task(GC::Ref<WebIDL::CallbackType> callback, SchedulerPostTaskOptions const& options);
+    GC::Ref<WebIDL::Promise> yield();
+
+private:
+    explicit Scheduler(JS::Realm&);
+
+    virtual void initialize(JS::Realm&) override;
+    virtual void visit_edges(Cell::Visitor&) override;
+
+    GC::Ref<TaskHandle> create_a_task_handle(GC::Ref<WebIDL::Promise>, GC::Ptr<DOM::AbortSignal>);
+    GC::Ref<SchedulerTaskQueue> select_the_scheduler_task_queue(TaskSignal&, bool is_continuation);
+    void schedule_a_task_to_invoke_an_algorithm(GC::Ref<TaskHandle>, Function<void()> algorithm);
+
+    void queue_an_event_loop_task(HTML::Task::Priority);
+    void requeue_event_loop_tasks(SchedulerTaskQueue const&, Bindings::TaskPriority previous_priority);
+    void run_the_next_scheduler_task(HTML::Task::Priority);
+
+    // https://wicg.github.io/scheduling-apis/#scheduler-static-priority-task-queue-map
+    // NOTE: This is keyed on the effective priority of the queues, which tells apart each pair of priority and whether
+    //       the queue is for continuations.
+    HashMap<u8, GC::Ref<SchedulerTaskQueue>> m_static_priority_task_queues;
+
+    // https://wicg.github.io/scheduling-apis/#scheduler-dynamic-priority-task-queue-map
+    // NOTE: This is split into separate maps for continuations and everything else, so that each can be keyed on the
+    //       signal alone.
+    HashMap<GC::Ref<TaskSignal>, GC::Ref<SchedulerTaskQueue>> m_dynamic_priority_task_queues;
+    HashMap<GC::Ref<TaskSignal>, GC::Ref<SchedulerTaskQueue>> m_dynamic_priority_continuation_task_queues;
+
+    // https://wicg.github.io/scheduling-apis/#scheduler-next-enqueue-order
+    u64 m_next_enqueue_order { 1 };
+};
+
+}
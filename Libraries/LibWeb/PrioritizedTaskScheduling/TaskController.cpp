@@ -0,0 +1,46 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibWeb/Bindings/Intrinsics.h>
+#include <LibWeb/Bindings/TaskControllerPrototype.h>
+#include <LibWeb/PrioritizedTaskScheduling/TaskController.h>
+
+namespace Web::PrioritizedTaskScheduling {
+
+GC_DEFINE_ALLOCATOR(TaskController);
+
+// https://wicg.github.io/scheduling-apis/#dom-taskcontroller-taskcontroller
+WebIDL::ExceptionOr<GC::Ref<TaskController>> TaskController::construct_impl(JS::Realm& realm, TaskControllerInit const& init)
+{
+    // 1. Let signal be a new TaskSignal object.
+    // 2. Set signal’s priority to init["priority"].
+    auto signal = TaskSignal::create(realm, init.priority);
+
+    // 3. Set this’s signal to signal.
+    return realm.create<TaskController>(realm, signal);
+}
+
+TaskController::TaskController(JS::Realm& realm, GC::Ref<TaskSignal> signal)
+    : AbortController(realm, signal)
+{
+}
+
+TaskController::~TaskController() = default;
+
+void TaskController::initialize(JS::Realm& realm)
+{
+    WEB_SET_PROTOTYPE_FOR_INTERFACE(TaskController);
+    Base::initialize(realm);
+}
+
+// https://wicg.github.io/scheduling-apis/#dom-taskcontroller-setpriority
+WebIDL::ExceptionOr<void> TaskController::set_priority(Bindings::TaskPriority priority)
+{
+    // The setPriority(priority) method steps are to signal priority change on this’s signal given priority.
+    return task_signal().signal_priority_change(priority);
+}
+
+}
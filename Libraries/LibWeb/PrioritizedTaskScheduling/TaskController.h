@@ -0,0 +1,40 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <LibWeb/Bindings/SchedulerPrototype.h>
+#include <LibWeb/DOM/AbortController.h>
+#include <LibWeb/PrioritizedTaskScheduling/TaskSignal.h>
+
+namespace Web::PrioritizedTaskScheduling {
+
+// https://wicg.github.io/scheduling-apis/#dictdef-taskcontrollerinit
+struct TaskControllerInit {
+    Bindings::TaskPriority priority { Bindings::TaskPriority::UserVisible };
+};
+
+// https://wicg.github.io/scheduling-apis/#taskcontroller
+class TaskController final : public DOM::AbortController {
+    WEB_PLATFORM_OBJECT(TaskController, DOM::AbortController);
+    GC_DECLARE_ALLOCATOR(TaskController);
+
+public:
+    static WebIDL::ExceptionOr<GC::Ref<TaskController>> construct_impl(JS::Realm&, TaskControllerInit const&);
+
+    virtual ~TaskController() override;
+
+    WebIDL::ExceptionOr<void> set_priority(Bindings::TaskPriority);
+
+private:
+    TaskController(JS::Realm&, GC::Ref<TaskSignal>);
+
+    virtual void initialize(JS::Realm&) override;
+
+    TaskSignal& task_signal() const { return as<TaskSignal>(*signal()); }
+};
+
+}
@@ -0,0 +1,39 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibWeb/Bindings/Intrinsics.h>
+#include <LibWeb/Bindings/TaskPriorityChangeEventPrototype.h>
+#include <LibWeb/PrioritizedTaskScheduling/TaskPriorityChangeEvent.h>
+
+namespace Web::PrioritizedTaskScheduling {
+
+GC_DEFINE_ALLOCATOR(TaskPriorityChangeEvent);
+
+GC::Ref<TaskPriorityChangeEvent> TaskPriorityChangeEvent::create(JS::Realm& realm, FlyString const& event_name, TaskPriorityChangeEventInit const& event_init)
+{
+    return realm.create<TaskPriorityChangeEvent>(realm, event_name, event_init);
+}
+
+GC::Ref<TaskPriorityChangeEvent> TaskPriorityChangeEvent::construct_impl(JS::Realm& realm, FlyString const& event_name, TaskPriorityChangeEventInit const& event_init)
+{
+    return create(realm, event_name, event_init);
+}
+
+TaskPriorityChangeEvent::TaskPriorityChangeEvent(JS::Realm& realm, FlyString const& event_name, TaskPriorityChangeEventInit const& event_init)
+    : DOM::Event(realm, event_name, event_init)
+    , m_previous_priority(event_init.previous_priority)
+{
+}
+
+TaskPriorityChangeEvent::~TaskPriorityChangeEvent() = default;
+
+void TaskPriorityChangeEvent::initialize(JS::Realm& realm)
+{
+    WEB_SET_PROTOTYPE_FOR_INTERFACE(TaskPriorityChangeEvent);
+    Base::initialize(realm);
+}
+
+}
@@ -0,0 +1,41 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <LibWeb/Bindings/SchedulerPrototype.h>
+#include <LibWeb/DOM/Event.h>
+
+namespace Web::PrioritizedTaskScheduling {
+
+// https://wicg.github.io/scheduling-apis/#dictdef-taskprioritychangeeventinit
+struct TaskPriorityChangeEventInit final : public DOM::EventInit {
+    Bindings::TaskPriority previous_priority;
+};
+
+// https://wicg.github.io/scheduling-apis/#taskprioritychangeevent
+class TaskPriorityChangeEvent final : public DOM::Event {
+    WEB_PLATFORM_OBJECT(TaskPriorityChangeEvent, DOM::Event);
+    GC_DECLARE_ALLOCATOR(TaskPriorityChangeEvent);
+
+public:
+    [[nodiscard]] static GC::Ref<TaskPriorityChangeEvent> create(JS::Realm&, FlyString const& event_name, TaskPriorityChangeEventInit const& event_init);
+    [[nodiscard]] static GC::Ref<TaskPriorityChangeEvent> construct_impl(JS::Realm&, FlyString const& event_name, TaskPriorityChangeEventInit const& event_init);
+
+    virtual ~TaskPriorityChangeEvent() override;
+
+    // https://wicg.github.io/scheduling-apis/#dom-taskprioritychangeevent-previouspriority
+    Bindings::TaskPriority previous_priority() const { return m_previous_priority; }
+
+private:
+    TaskPriorityChangeEvent(JS::Realm&, FlyString const& event_name, TaskPriorityChangeEventInit const& event_init);
+
+    virtual void initialize(JS::Realm&) override;
+
+    Bindings::TaskPriority m_previous_priority;
+};
+
+}
@@ -0,0 +1,183 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibJS/Runtime/Error.h>
+#include <LibWeb/Bindings/Intrinsics.h>
+#include <LibWeb/Bindings/TaskSignalPrototype.h>
+#include <LibWeb/HTML/EventNames.h>
+#include <LibWeb/PrioritizedTaskScheduling/TaskPriorityChangeEvent.h>
+#include <LibWeb/PrioritizedTaskScheduling/TaskSignal.h>
+
+namespace Web::PrioritizedTaskScheduling {
+
+GC_DEFINE_ALLOCATOR(TaskSignal);
+
+GC::Ref<TaskSignal> TaskSignal::create(JS::Realm& realm, Bindings::TaskPriority priority)
+{
+    auto signal = realm.create<TaskSignal>(realm);
+    signal->m_priority = priority;
+    return signal;
+}
+
+TaskSignal::TaskSignal(JS::Realm& realm)
+    : AbortSignal(realm)
+{
+}
+
+TaskSignal::~TaskSignal() = default;
+
+void TaskSignal::initialize(JS::Realm& realm)
+{
+    WEB_SET_PROTOTYPE_FOR_INTERFACE(TaskSignal);
+    Base::initialize(realm);
+}
+
+void TaskSignal::visit_edges(Cell::Visitor& visitor)
+{
+    Base::visit_edges(visitor);
+    visitor.visit(m_priority_change_algorithms);
+    visitor.visit(m_source_signal);
+    visitor.visit(m_priority_dependent_signals);
+}
+
+// https://wicg.github.io/scheduling-apis/#dom-tasksignal-any
+WebIDL::ExceptionOr<GC::Ref<TaskSignal>> TaskSignal::any(JS::VM& vm, Vector<GC::Root<DOM::AbortSignal>> const& signals, TaskSignalAnyInit const& init)
+{
+    Variant<Bindings::TaskPriority, GC::Ref<TaskSignal>> priority = Bindings::TaskPriority::UserVisible;
+    if (auto const* signal = init.priority.get_pointer<GC::Root<TaskSignal>>()) {
+        priority = GC::Ref { **signal };
+    } else {
+        // NOTE: This is what converting the string to a TaskPriority would do, if the bindings could do it for us.
+        auto const& string = init.priority.get<String>();
+        if (string == "user-blocking"sv)
+            priority = Bindings::TaskPriority::UserBlocking;
+        else if (string == "background"sv)
+            priority = Bindings::TaskPriority::Background;
+        else if (string != "user-visible"sv)
+            return vm.throw_completion<JS::TypeError>(JS::ErrorType::InvalidEnumerationValue, string, "TaskPriority");
+    }
+
+    // The static any(signals, init) method steps are to return the result of creating a dependent task signal from
+    // signals, init, and the current realm.
+    return create_dependent_task_signal(*vm.current_realm(), signals, priority);
+}
+
+// https://wicg.github.io/scheduling-apis/#create-a-dependent-task-signal
+WebIDL::ExceptionOr<GC::Ref<TaskSignal>> TaskSignal::create_dependent_task_signal(JS::Realm& realm, Vector<GC::Root<DOM::AbortSignal>> const& signals, Variant<Bindings::TaskPriority, GC::Ref<TaskSignal>> priority)
+{
+    // 1. Let resultSignal be the result of creating a dependent signal from signals using the TaskSignal interface and realm.
+    auto result_signal = realm.create<TaskSignal>(realm);
+    result_signal->make_dependent_on(signals);
+
+    // 2. Set resultSignal’s dependent to true.
+    result_signal->set_dependent(true);
+
+    priority.visit(
+        // 3. If init["priority"] is a TaskPriority, then:
+        [&](Bindings::TaskPriority priority) {
+            // 1. Set resultSignal’s priority to init["priority"].
+            result_signal->m_priority = priority;
+        },
+        // 4. Otherwise:
+        [&](GC::Ref<TaskSignal> source_signal) {
+            // 1. Let sourceSignal be init["priority"].
+            // 2. Set resultSignal’s priority to sourceSignal’s priority.
+            result_signal->m_priority = source_signal->priority();
+
+            // 3. If sourceSignal does not have fixed priority, then:
+            if (!source_signal->has_fixed_priority()) {
+                // 1. If sourceSignal’s dependent is true, then set sourceSignal to sourceSignal’s source signal.
+                if (source_signal->dependent())
+                    source_signal = *source_signal->m_source_signal;
+
+                // 2. Assert: sourceSignal is not dependent.
+                VERIFY(!source_signal->dependent());
+
+                // 3. Set resultSignal’s source signal to sourceSignal.
+                result_signal->m_source_signal = source_signal;
+
+                // 4. Append resultSignal to sourceSignal’s dependent signals.
+                source_signal->m_priority_dependent_signals.append(result_signal);
+            }
+        });
+
+    // 5. Return resultSignal.
+    return result_signal;
+}
+
+// https://wicg.github.io/scheduling-apis/#create-a-fixed-priority-unabortable-task-signal
+GC::Ref<TaskSignal> TaskSignal::create_fixed_priority_unabortable_task_signal(JS::Realm& realm, Bindings::TaskPriority priority)
+{
+    // 1. Let init be a new TaskSignalAnyInit.
+    // 2. Set init["priority"] to priority.
+    // 3. Return the result of creating a dependent task signal from « », init, and realm.
+    return MUST(create_dependent_task_signal(realm, {}, priority));
+}
+
+// https://wicg.github.io/scheduling-apis/#tasksignal-add-a-priority-change-algorithm
+void TaskSignal::add_priority_change_algorithm(Function<void()> algorithm)
+{
+    // To add a priority change algorithm algorithm to a TaskSignal object signal, append algorithm to signal’s
+    // priority change algorithms.
+    m_priority_change_algorithms.append(GC::create_function(heap(), move(algorithm)));
+}
+
+// https://wicg.github.io/scheduling-apis/#tasksignal-signal-priority-change
+WebIDL::ExceptionOr<void> TaskSignal::signal_priority_change(Bindings::TaskPriority priority)
+{
+    // 1. If signal’s priority changing is true, then throw a "NotAllowedError" DOMException.
+    if (m_priority_changing)
+        return WebIDL::NotAllowedError::create(realm(), "The priority of this signal is already being changed"_utf16);
+
+    // 2. If signal’s priority equals priority then return.
+    if (m_priority == priority)
+        return {};
+
+    // 3. Set signal’s priority changing to true.
+    m_priority_changing = true;
+
+    // 4. Let previousPriority be signal’s priority.
+    auto previous_priority = m_priority;
+
+    // 5. Set signal’s priority to priority.
+    m_priority = priority;
+
+    // 6. For each algorithm of signal’s priority change algorithms, run algorithm.
+    for (auto const& algorithm : m_priority_change_algorithms)
+        algorithm->function()();
+
+    // 7. Fire an event named prioritychange at signal using TaskPriorityChangeEvent, with its previousPriority attribute
+    //    initialized to previousPriority.
+    TaskPriorityChangeEventInit event_init;
+    event_init.previous_priority = previous_priority;
+    dispatch_event(TaskPriorityChangeEvent::create(realm(), HTML::EventNames::prioritychange, event_init));
+
+    // 8. For each dependentSignal of signal’s dependent signals, signal priority change on dependentSignal with priority.
+    for (auto const& dependent_signal : m_priority_dependent_signals) {
+        if (auto result = dependent_signal->signal_priority_change(priority); result.is_error()) {
+            m_priority_changing = false;
+            return result.release_error();
+        }
+    }
+
+    // 9. Set signal’s priority changing to false.
+    m_priority_changing = false;
+    return {};
+}
+
+// https://wicg.github.io/scheduling-apis/#dom-tasksignal-onprioritychange
+void TaskSignal::set_onprioritychange(WebIDL::CallbackType* event_handler)
+{
+    set_event_handler_attribute(HTML::EventNames::prioritychange, event_handler);
+}
+
+// https://wicg.github.io/scheduling-apis/#dom-tasksignal-onprioritychange
+WebIDL::CallbackType* TaskSignal::onprioritychange()
+{
+    return event_handler_attribute(HTML::EventNames::prioritychange);
+}
+
+}
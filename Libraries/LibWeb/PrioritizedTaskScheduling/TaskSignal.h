@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <LibGC/Function.h>
+#include <LibWeb/Bindings/SchedulerPrototype.h>
+#include <LibWeb/DOM/AbortSignal.h>
+
+namespace Web::PrioritizedTaskScheduling {
+
+// https://wicg.github.io/scheduling-apis/#dictdef-tasksignalanyinit
+struct TaskSignalAnyInit {
+    Variant<GC::Root<TaskSignal>, String> priority { "user-visible"_string };
+};
+
+// https://wicg.github.io/scheduling-apis/#tasksignal
+class TaskSignal final : public DOM::AbortSignal {
+    WEB_PLATFORM_OBJECT(TaskSignal, DOM::AbortSignal);
+    GC_DECLARE_ALLOCATOR(TaskSignal);
+
+public:
+    [[nodiscard]] static GC::Ref<TaskSignal> create(JS::Realm&, Bindings::TaskPriority);
+
+    static WebIDL::ExceptionOr<GC::Ref<TaskSignal>> any(JS::VM&, Vector<GC::Root<DOM::AbortSignal>> const&, TaskSignalAnyInit const&);
+
+    static WebIDL::ExceptionOr<GC::Ref<TaskSignal>> create_dependent_task_signal(JS::Realm&, Vector<GC::Root<DOM::AbortSignal>> const&, Variant<Bindings::TaskPriority, GC::Ref<TaskSignal>> priority);
+    static GC::Ref<TaskSignal> create_fixed_priority_unabortable_task_signal(JS::Realm&, Bindings::TaskPriority);
+
+    virtual ~TaskSignal() override;
+
+    // https://wicg.github.io/scheduling-apis/#dom-tasksignal-priority
+    Bindings::TaskPriority priority() const { return m_priority; }
+
+    // https://wicg.github.io/scheduling-apis/#tasksignal-has-fixed-priority
+    // A TaskSignal has fixed priority if it is a dependent signal with a null source signal.
+    bool has_fixed_priority() const { return dependent() && !m_source_signal; }
+
+    void add_priority_change_algorithm(Function<void()>);
+    WebIDL::ExceptionOr<void> signal_priority_change(Bindings::TaskPriority);
+
+    void set_onprioritychange(WebIDL::CallbackType*);
+    WebIDL::CallbackType* onprioritychange();
+
+private:
+    explicit TaskSignal(JS::Realm&);
+
+    virtual void initialize(JS::Realm&) override;
+    virtual void visit_edges(Cell::Visitor&) override;
+
+    // https://wicg.github.io/scheduling-apis/#tasksignal-priority
+    Bindings::TaskPriority m_priority { Bindings::TaskPriority::UserVisible };
+
+    // https://wicg.github.io/scheduling-apis/#tasksignal-priority-changing
+    bool m_priority_changing { false };
+
+    // https://wicg.github.io/scheduling-apis/#tasksignal-priority-change-algorithms
+    Vector<GC::Ref<GC::Function<void()>>> m_priority_change_algorithms;
+
+    // https://wicg.github.io/scheduling-apis/#tasksignal-source-signal
+    // A TaskSignal object has an associated source signal (a weak TaskSignal that the object is dependent on for its
+    // priority), which is initially null.
+    GC::Ptr<TaskSignal> m_source_signal;
+
+    // https://wicg.github.io/scheduling-apis/#tasksignal-dependent-signals
+    // A TaskSignal object has associated dependent signals (a weak set of TaskSignal objects that are dependent on the
+    // object for their priority), which is initially empty.
+    Vector<GC::Ptr<TaskSignal>> m_priority_dependent_signals;
+};
+
+}
@@ -327,6 +327,10 @@ libweb_js_bindings(NavigationTiming/PerformanceTiming)
 libweb_js_bindings(PerformanceTimeline/PerformanceEntry)
 libweb_js_bindings(PerformanceTimeline/PerformanceObserver)
 libweb_js_bindings(PerformanceTimeline/PerformanceObserverEntryList)
+libweb_js_bindings(PrioritizedTaskScheduling/Scheduler)
+libweb_js_bindings(PrioritizedTaskScheduling/TaskController)
+libweb_js_bindings(PrioritizedTaskScheduling/TaskPriorityChangeEvent)
+libweb_js_bindings(PrioritizedTaskScheduling/TaskSignal)
 libweb_js_bindings(RequestIdleCallback/IdleDeadline)
 libweb_js_bindings(ResizeObserver/ResizeObserver)
 libweb_js_bindings(ResizeObserver/ResizeObserverEntry)
@@ -31,13 +31,81 @@ void ImageCodecPlugin::set_client(NonnullRefPtr<ImageDecoderClient::Client> clie
 
 ImageCodecPlugin::~ImageCodecPlugin() = default;
 
-NonnullRefPtr<Core::Promise<Web::Platform::DecodedImage>> ImageCodecPlugin::decode_image(ReadonlyBytes bytes, Function<ErrorOr<void>(Web::Platform::DecodedImage&)> on_resolved, Function<void(Error&)> on_rejected)
+class AnimationFrameDecoder final : public Web::Platform::AnimationFrameDecoder {
+public:
+    AnimationFrameDecoder(NonnullRefPtr<ImageDecoderClient::Client> client, i64 animation_session_id)
+        : m_client(move(client))
+        , m_animation_session_id(animation_session_id)
+    {
+    }
+
+    virtual ~AnimationFrameDecoder() override
+    {
+        m_client->end_animation_session(m_animation_session_id);
+    }
+
+    virtual void request_frames(size_t start_frame_index, size_t count) override
+    {
+        m_client->decode_animation_frames(
+            m_animation_session_id, start_frame_index, count,
+            [this](u32 first_frame_index, Vector<RefPtr<Gfx::Bitmap>> bitmaps, Vector<u32> durations) {
+                if (!on_frames_decoded)
+                    return;
+
+                Vector<Web::Platform::Frame> frames;
+                frames.ensure_capacity(bitmaps.size());
+                for (size_t i = 0; i < bitmaps.size(); ++i)
+                    frames.empend(move(bitmaps[i]), durations[i]);
+                on_frames_decoded(first_frame_index, frames);
+            },
+            [this] {
+                if (on_failure)
+                    on_failure();
+            });
+    }
+
+private:
+    NonnullRefPtr<ImageDecoderClient::Client> m_client;
+    i64 m_animation_session_id { 0 };
+};
+
+static NonnullRefPtr<Core::Promise<Web::Platform::DecodedImage>> create_promise(Function<ErrorOr<void>(Web::Platform::DecodedImage&)> on_resolved, Function<void(Error&)> on_rejected)
 {
     auto promise = Core::Promise<Web::Platform::DecodedImage>::construct();
     if (on_resolved)
         promise->on_resolution = move(on_resolved);
     if (on_rejected)
         promise->on_rejection = move(on_rejected);
+    return promise;
+}
+
+static void resolve_promise(Core::Promise<Web::Platform::DecodedImage>& promise, NonnullRefPtr<ImageDecoderClient::Client> client, ImageDecoderClient::DecodedImage& result)
+{
+    // FIXME: Remove this codec plugin and just use the ImageDecoderClient directly to avoid these copies
+    Web::Platform::DecodedImage decoded_image;
+    decoded_image.is_animated = result.is_animated;
+    decoded_image.loop_count = result.loop_count;
+    decoded_image.frame_count = result.frame_count;
+    decoded_image.natural_size = result.natural_size;
+    for (auto& frame : result.frames) {
+        decoded_image.frames.empend(move(frame.bitmap), frame.duration);
+    }
+    decoded_image.color_space = move(result.color_space);
+    if (result.animation_session_id.has_value()) {
+        decoded_image.frame_decoder = adopt_ref(*new AnimationFrameDecoder(move(client), *result.animation_session_id));
+        decoded_image.frame_decoder->color_space = decoded_image.color_space;
+    }
+    promise.resolve(move(decoded_image));
+}
+
+static ImageDecoderClient::AnimationFrameDecoding to_client_animation_frame_decoding(Web::Platform::AnimationFrameDecoding animation_frame_decoding)
+{
+    return animation_frame_decoding == Web::Platform::AnimationFrameDecoding::Lazy ? ImageDecoderClient::AnimationFrameDecoding::Lazy : ImageDecoderClient::AnimationFrameDecoding::Eager;
+}
+
+NonnullRefPtr<Core::Promise<Web::Platform::DecodedImage>> ImageCodecPlugin::decode_image(ReadonlyBytes bytes, Function<ErrorOr<void>(Web::Platform::DecodedImage&)> on_resolved, Function<void(Error&)> on_rejected, Optional<Gfx::IntSize> ideal_size, Web::Platform::AnimationFrameDecoding animation_frame_decoding)
+{
+    auto promise = create_promise(move(on_resolved), move(on_rejected));
 
     if (!m_client) {
         promise->reject(Error::from_string_literal("ImageDecoderClient is disconnected"));
@@ -46,23 +114,90 @@ NonnullRefPtr<Core::Promise<Web::Platform::DecodedImage>> ImageCodecPlugin::deco
 
     auto image_decoder_promise = m_client->decode_image(
         bytes,
-        [promise](ImageDecoderClient::DecodedImage& result) -> ErrorOr<void> {
-            // FIXME: Remove this codec plugin and just use the ImageDecoderClient directly to avoid these copies
-            Web::Platform::DecodedImage decoded_image;
-            decoded_image.is_animated = result.is_animated;
-            decoded_image.loop_count = result.loop_count;
-            for (auto& frame : result.frames) {
-                decoded_image.frames.empend(move(frame.bitmap), frame.duration);
-            }
-            decoded_image.color_space = move(result.color_space);
-            promise->resolve(move(decoded_image));
+        [promise, client = NonnullRefPtr { *m_client }](ImageDecoderClient::DecodedImage& result) -> ErrorOr<void> {
+            resolve_promise(*promise, client, result);
             return {};
         },
         [promise](auto& error) {
             promise->reject(Error::copy(error));
-        });
+        },
+        ideal_size, {}, to_client_animation_frame_decoding(animation_frame_decoding));
 
     return promise;
 }
 
+class IncrementalImageDecoder final : public Web::Platform::IncrementalImageDecoder {
+public:
+    static RefPtr<IncrementalImageDecoder> start(NonnullRefPtr<ImageDecoderClient::Client> client)
+    {
+        auto decoder = adopt_ref(*new IncrementalImageDecoder(client));
+
+        // NOTE: The client forgets about this callback once we're finished or canceled, so it can't outlive us.
+        auto image_id = client->start_incremental_decode({}, [decoder = decoder.ptr()](NonnullRefPtr<Gfx::Bitmap> bitmap, Gfx::ColorSpace color_space) {
+            if (decoder->on_partial_image_decoded)
+                decoder->on_partial_image_decoded(move(bitmap), color_space);
+        });
+        if (!image_id.has_value())
+            return nullptr;
+
+        decoder->m_image_id = *image_id;
+        return decoder;
+    }
+
+    virtual ~IncrementalImageDecoder() override
+    {
+        if (m_image_id.has_value() && !m_is_finished)
+            m_client->cancel_incremental_decode(*m_image_id);
+    }
+
+    virtual ErrorOr<void> append_encoded_data(ReadonlyBytes bytes) override
+    {
+        VERIFY(!m_is_finished);
+        return m_client->append_encoded_data(*m_image_id, bytes);
+    }
+
+    virtual ReadonlyBytes encoded_data() const override
+    {
+        VERIFY(!m_is_finished);
+        return m_client->encoded_data(*m_image_id);
+    }
+
+    virtual NonnullRefPtr<Core::Promise<Web::Platform::DecodedImage>> finish(Function<ErrorOr<void>(Web::Platform::DecodedImage&)> on_resolved, Function<void(Error&)> on_rejected, Optional<Gfx::IntSize> ideal_size, Web::Platform::AnimationFrameDecoding animation_frame_decoding) override
+    {
+        VERIFY(!m_is_finished);
+        m_is_finished = true;
+
+        auto promise = create_promise(move(on_resolved), move(on_rejected));
+        m_client->finish_incremental_decode(
+            *m_image_id,
+            [promise, client = m_client](ImageDecoderClient::DecodedImage& result) -> ErrorOr<void> {
+                resolve_promise(*promise, client, result);
+                return {};
+            },
+            [promise](auto& error) {
+                promise->reject(Error::copy(error));
+            },
+            ideal_size, to_client_animation_frame_decoding(animation_frame_decoding));
+
+        return promise;
+    }
+
+private:
+    explicit IncrementalImageDecoder(NonnullRefPtr<ImageDecoderClient::Client> client)
+        : m_client(move(client))
+    {
+    }
+
+    NonnullRefPtr<ImageDecoderClient::Client> m_client;
+    Optional<i64> m_image_id;
+    bool m_is_finished { false };
+};
+
+RefPtr<Web::Platform::IncrementalImageDecoder> ImageCodecPlugin::start_incremental_decode()
+{
+    if (!m_client)
+        return nullptr;
+    return IncrementalImageDecoder::start(*m_client);
+}
+
 }
@@ -30,6 +30,18 @@ void ConnectionFromClient::die()
     }
     m_pending_jobs.clear();
 
+    for (auto& [_, session] : m_animation_sessions) {
+        if (session.pending_job)
+            session.pending_job->cancel();
+    }
+    m_animation_sessions.clear();
+
+    for (auto& [_, decode] : m_incremental_decodes) {
+        if (decode.pending_job)
+            decode.pending_job->cancel();
+    }
+    m_incremental_decodes.clear();
+
     auto client_id = this->client_id();
     s_connections.remove(client_id);
     s_client_ids.deallocate(client_id);
@@ -101,9 +113,27 @@ static void decode_image_to_bitmaps_and_durations_with_decoder(Gfx::ImageDecoder
     }
 }
 
-static ErrorOr<ConnectionFromClient::DecodeResult> decode_image_to_details(Core::AnonymousBuffer const& encoded_buffer, Optional<Gfx::IntSize> ideal_size, Optional<ByteString> const& known_mime_type)
+static void decode_animation_frames_with_decoder(Gfx::ImageDecoder const& decoder, Optional<Gfx::IntSize> ideal_size, u32 start_frame_index, u32 count, Vector<RefPtr<Gfx::Bitmap>>& bitmaps, Vector<u32>& durations)
 {
-    auto decoder = TRY(Gfx::ImageDecoder::try_create_for_raw_bytes(ReadonlyBytes { encoded_buffer.data<u8>(), encoded_buffer.size() }, known_mime_type));
+    auto end_frame_index = min(static_cast<size_t>(start_frame_index) + count, decoder.frame_count());
+    for (size_t i = start_frame_index; i < end_frame_index; ++i) {
+        auto frame_or_error = decoder.frame(i, ideal_size);
+        if (frame_or_error.is_error()) {
+            bitmaps.append({});
+            durations.append(0);
+        } else {
+            auto frame = frame_or_error.release_value();
+            bitmaps.append(frame.image);
+            durations.append(frame.duration);
+        }
+    }
+}
+
+// NOTE: The encoded data may only take up the beginning of the buffer, if the client sent it to us as it arrived.
+static ErrorOr<ConnectionFromClient::DecodeResult> decode_image_to_details(Core::AnonymousBuffer encoded_buffer, size_t encoded_size, Optional<Gfx::IntSize> ideal_size, Optional<ByteString> const& known_mime_type, bool decode_animation_frames_lazily)
+{
+    VERIFY(encoded_size <= encoded_buffer.size());
+    auto decoder = TRY(Gfx::ImageDecoder::try_create_for_raw_bytes(ReadonlyBytes { encoded_buffer.data<u8>(), encoded_size }, known_mime_type));
 
     if (!decoder)
         return Error::from_string_literal("Could not find suitable image decoder plugin for data");
@@ -114,6 +144,8 @@ static ErrorOr<ConnectionFromClient::DecodeResult> decode_image_to_details(Core:
     ConnectionFromClient::DecodeResult result;
     result.is_animated = decoder->is_animated();
     result.loop_count = decoder->loop_count();
+    result.frame_count = decoder->frame_count();
+    result.natural_size = decoder->size();
 
     if (auto maybe_icc_data = decoder->color_space(); !maybe_icc_data.is_error())
         result.color_profile = maybe_icc_data.value();
@@ -134,7 +166,17 @@ static ErrorOr<ConnectionFromClient::DecodeResult> decode_image_to_details(Core:
         }
     }
 
-    decode_image_to_bitmaps_and_durations_with_decoder(*decoder, move(ideal_size), bitmaps, result.durations);
+    // NOTE: When decoding animation frames lazily, we only decode the first frame for now, and hold on to the decoder so
+    //       that the client can ask for the rest as it needs them.
+    if (decode_animation_frames_lazily && result.is_animated && result.frame_count > 1) {
+        decode_animation_frames_with_decoder(*decoder, ideal_size, 0, 1, bitmaps, result.durations);
+        if (bitmaps.is_empty() || !bitmaps.first())
+            return Error::from_string_literal("Could not decode image");
+
+        result.animation_decoder = make<ConnectionFromClient::AnimationDecoder>(move(encoded_buffer), decoder.release_nonnull());
+    } else {
+        decode_image_to_bitmaps_and_durations_with_decoder(*decoder, move(ideal_size), bitmaps, result.durations);
+    }
 
     if (bitmaps.is_empty())
         return Error::from_string_literal("Could not decode image");
@@ -144,14 +186,22 @@ static ErrorOr<ConnectionFromClient::DecodeResult> decode_image_to_details(Core:
     return result;
 }
 
-NonnullRefPtr<ConnectionFromClient::Job> ConnectionFromClient::make_decode_image_job(i64 image_id, Core::AnonymousBuffer encoded_buffer, Optional<Gfx::IntSize> ideal_size, Optional<ByteString> mime_type)
+NonnullRefPtr<ConnectionFromClient::Job> ConnectionFromClient::make_decode_image_job(i64 image_id, Core::AnonymousBuffer encoded_buffer, size_t encoded_size, Optional<Gfx::IntSize> ideal_size, Optional<ByteString> mime_type, bool decode_animation_frames_lazily)
 {
     return Job::construct(
-        [encoded_buffer = move(encoded_buffer), ideal_size = move(ideal_size), mime_type = move(mime_type)](auto&) -> ErrorOr<DecodeResult> {
-            return TRY(decode_image_to_details(encoded_buffer, ideal_size, mime_type));
+        [encoded_buffer = move(encoded_buffer), encoded_size, ideal_size, mime_type = move(mime_type), decode_animation_frames_lazily](auto&) mutable -> ErrorOr<DecodeResult> {
+            return TRY(decode_image_to_details(move(encoded_buffer), encoded_size, ideal_size, mime_type, decode_animation_frames_lazily));
         },
-        [strong_this = NonnullRefPtr(*this), image_id](DecodeResult result) -> ErrorOr<void> {
-            strong_this->async_did_decode_image(image_id, result.is_animated, result.loop_count, move(result.bitmaps), move(result.durations), result.scale, move(result.color_profile));
+        [strong_this = NonnullRefPtr(*this), image_id, ideal_size](DecodeResult result) -> ErrorOr<void> {
+            if (result.animation_decoder) {
+                strong_this->m_animation_sessions.set(image_id, AnimationSession {
+                                                                    .animation_decoder = move(result.animation_decoder),
+                                                                    .ideal_size = ideal_size,
+                                                                    .pending_job = {},
+                                                                    .queued_request = {},
+                                                                });
+            }
+            strong_this->async_did_decode_image(image_id, result.is_animated, result.loop_count, result.frame_count, result.natural_size, move(result.bitmaps), move(result.durations), result.scale, move(result.color_profile));
             strong_this->m_pending_jobs.remove(image_id);
             return {};
         },
@@ -162,7 +212,7 @@ NonnullRefPtr<ConnectionFromClient::Job> ConnectionFromClient::make_decode_image
         });
 }
 
-Messages::ImageDecoderServer::DecodeImageResponse ConnectionFromClient::decode_image(Core::AnonymousBuffer encoded_buffer, Optional<Gfx::IntSize> ideal_size, Optional<ByteString> mime_type)
+Messages::ImageDecoderServer::DecodeImageResponse ConnectionFromClient::decode_image(Core::AnonymousBuffer encoded_buffer, Optional<Gfx::IntSize> ideal_size, Optional<ByteString> mime_type, bool decode_animation_frames_lazily)
 {
     auto image_id = m_next_image_id++;
 
@@ -172,7 +222,8 @@ Messages::ImageDecoderServer::DecodeImageResponse ConnectionFromClient::decode_i
         return image_id;
     }
 
-    m_pending_jobs.set(image_id, make_decode_image_job(image_id, move(encoded_buffer), ideal_size, move(mime_type)));
+    auto encoded_size = encoded_buffer.size();
+    m_pending_jobs.set(image_id, make_decode_image_job(image_id, move(encoded_buffer), encoded_size, ideal_size, move(mime_type), decode_animation_frames_lazily));
 
     return image_id;
 }
@@ -182,6 +233,194 @@ void ConnectionFromClient::cancel_decoding(i64 image_id)
     if (auto job = m_pending_jobs.take(image_id); job.has_value()) {
         job.value()->cancel();
     }
+
+    if (auto decode = m_incremental_decodes.take(image_id); decode.has_value()) {
+        if (decode->pending_job)
+            decode->pending_job->cancel();
+    }
+}
+
+void ConnectionFromClient::start_incremental_decode(i64 image_id, Optional<ByteString> mime_type)
+{
+    // NOTE: The client picks the IDs of incremental decodes, so that it doesn't have to wait for us to start one. They are
+    //       negative, so that they can't clash with the IDs we pick.
+    if (image_id >= 0 || m_incremental_decodes.contains(image_id) || m_pending_jobs.contains(image_id)) {
+        did_misbehave("Invalid ID for incremental decode");
+        return;
+    }
+
+    m_incremental_decodes.set(image_id, IncrementalDecode { .mime_type = move(mime_type) });
+}
+
+void ConnectionFromClient::set_encoded_data_buffer(i64 image_id, Core::AnonymousBuffer buffer)
+{
+    auto decode = m_incremental_decodes.get(image_id);
+    if (!decode.has_value()) {
+        dbgln_if(IMAGE_DECODER_DEBUG, "No incremental decode for image {}", image_id);
+        return;
+    }
+
+    if (!buffer.is_valid() || buffer.size() < decode->encoded_size) {
+        did_misbehave("Invalid buffer for incremental decode");
+        return;
+    }
+
+    // NOTE: A partial job that is still running holds on to the previous buffer, which has the same data in it.
+    decode->encoded_buffer = move(buffer);
+}
+
+void ConnectionFromClient::did_append_encoded_data(i64 image_id, u64 encoded_size)
+{
+    auto decode = m_incremental_decodes.get(image_id);
+    if (!decode.has_value()) {
+        dbgln_if(IMAGE_DECODER_DEBUG, "No incremental decode for image {}", image_id);
+        return;
+    }
+
+    if (encoded_size < decode->encoded_size || !decode->encoded_buffer.is_valid() || encoded_size > decode->encoded_buffer.size()) {
+        did_misbehave("Invalid size for incremental decode");
+        return;
+    }
+
+    decode->encoded_size = encoded_size;
+    start_partial_job_if_needed(image_id, *decode);
+}
+
+static ErrorOr<ConnectionFromClient::PartialImage> decode_partial_image(OwnPtr<Gfx::IncrementalImageDecoder> decoder, ReadonlyBytes encoded_data)
+{
+    if (!decoder) {
+        decoder = TRY(Gfx::IncrementalImageDecoder::try_create_for_format_of(encoded_data));
+        if (!decoder)
+            return ConnectionFromClient::PartialImage {};
+    }
+
+    TRY(decoder->decode_more(encoded_data));
+
+    ConnectionFromClient::PartialImage image;
+    // NOTE: This copies what the decoder has drawn so far, as it keeps drawing into its bitmap.
+    if (auto bitmap = decoder->bitmap())
+        image.bitmap = bitmap->to_shareable_bitmap();
+    if (auto maybe_color_space = decoder->color_space(); !maybe_color_space.is_error())
+        image.color_profile = maybe_color_space.release_value();
+    image.decoder = move(decoder);
+    return image;
+}
+
+void ConnectionFromClient::start_partial_job_if_needed(i64 image_id, IncrementalDecode& decode)
+{
+    if (decode.pending_job || !decode.can_decode_partially)
+        return;
+
+    auto growth = decode.encoded_size - decode.size_at_last_partial_decode;
+    if (growth < max(minimum_growth_between_partial_decodes, decode.size_at_last_partial_decode / 4))
+        return;
+    decode.size_at_last_partial_decode = decode.encoded_size;
+
+    // NOTE: The client only ever appends to the buffer, so the part of it that we decode doesn't change under us.
+    decode.pending_job = PartialJob::construct(
+        [decoder = move(decode.decoder), encoded_buffer = decode.encoded_buffer, encoded_size = decode.encoded_size](auto&) mutable -> ErrorOr<PartialImage> {
+            // NOTE: Not being able to decode part of an image is to be expected, e.g. if it turns out to be corrupt before
+            //       we get to the end of it. There's simply nothing more to show for it then.
+            auto image = decode_partial_image(move(decoder), ReadonlyBytes { encoded_buffer.data<u8>(), encoded_size });
+            if (image.is_error())
+                return PartialImage {};
+            return image.release_value();
+        },
+        [strong_this = NonnullRefPtr(*this), image_id](PartialImage image) -> ErrorOr<void> {
+            auto decode = strong_this->m_incremental_decodes.get(image_id);
+            if (!decode.has_value())
+                return {};
+
+            decode->pending_job = nullptr;
+            decode->decoder = move(image.decoder);
+            if (!decode->decoder)
+                decode->can_decode_partially = false;
+            if (image.bitmap.is_valid())
+                strong_this->async_did_decode_partial_image(image_id, move(image.bitmap), move(image.color_profile));
+
+            strong_this->start_partial_job_if_needed(image_id, *decode);
+            return {};
+        },
+        // NOTE: This job only fails when it's canceled along with its incremental decode. This may be called on the
+        //       background thread, so there is nothing we can safely do here.
+        [](Error) {});
+}
+
+void ConnectionFromClient::finish_incremental_decode(i64 image_id, Optional<Gfx::IntSize> ideal_size, bool decode_animation_frames_lazily)
+{
+    auto decode = m_incremental_decodes.take(image_id);
+    if (!decode.has_value()) {
+        dbgln_if(IMAGE_DECODER_DEBUG, "No incremental decode for image {}", image_id);
+        return;
+    }
+
+    if (decode->pending_job)
+        decode->pending_job->cancel();
+
+    if (decode->encoded_size == 0) {
+        async_did_fail_to_decode_image(image_id, "No encoded data"_string);
+        return;
+    }
+
+    // NOTE: We decode the image straight from the buffer that the client has been sending its data in.
+    m_pending_jobs.set(image_id, make_decode_image_job(image_id, move(decode->encoded_buffer), decode->encoded_size, ideal_size, move(decode->mime_type), decode_animation_frames_lazily));
+}
+
+void ConnectionFromClient::decode_animation_frames(i64 image_id, u32 start_frame_index, u32 count)
+{
+    auto session = m_animation_sessions.get(image_id);
+    if (!session.has_value()) {
+        dbgln_if(IMAGE_DECODER_DEBUG, "No animation session for image {}", image_id);
+        return;
+    }
+
+    // NOTE: The decoder can only decode one batch of frames at a time. If it's busy, we only remember the most recent
+    //       request, as the client will have moved on from any earlier ones by the time we get to them.
+    if (session->pending_job) {
+        session->queued_request = FrameRequest { start_frame_index, count };
+        return;
+    }
+
+    start_frame_job(image_id, *session, { start_frame_index, count });
+}
+
+void ConnectionFromClient::start_frame_job(i64 image_id, AnimationSession& session, FrameRequest request)
+{
+    VERIFY(session.animation_decoder);
+
+    session.pending_job = FrameJob::construct(
+        [animation_decoder = session.animation_decoder.release_nonnull(), ideal_size = session.ideal_size, request](auto&) mutable -> ErrorOr<AnimationFrames> {
+            Vector<RefPtr<Gfx::Bitmap>> bitmaps;
+            Vector<u32> durations;
+            decode_animation_frames_with_decoder(*animation_decoder->decoder, ideal_size, request.start_frame_index, request.count, bitmaps, durations);
+            return AnimationFrames { Gfx::BitmapSequence { move(bitmaps) }, move(durations), move(animation_decoder) };
+        },
+        [strong_this = NonnullRefPtr(*this), image_id, request](AnimationFrames frames) -> ErrorOr<void> {
+            auto session = strong_this->m_animation_sessions.get(image_id);
+            if (!session.has_value())
+                return {};
+
+            session->animation_decoder = move(frames.animation_decoder);
+            session->pending_job = nullptr;
+            strong_this->async_did_decode_animation_frames(image_id, request.start_frame_index, move(frames.bitmaps), move(frames.durations));
+
+            if (auto queued_request = session->queued_request; queued_request.has_value()) {
+                session->queued_request.clear();
+                strong_this->start_frame_job(image_id, *session, *queued_request);
+            }
+            return {};
+        },
+        // NOTE: Frames that fail to decode are sent as null bitmaps, so this job only fails when it's canceled along with
+        //       its session. This may be called on the background thread, so there is nothing we can safely do here.
+        [](Error) {});
+}
+
+void ConnectionFromClient::end_animation_session(i64 image_id)
+{
+    if (auto session = m_animation_sessions.take(image_id); session.has_value()) {
+        if (session->pending_job)
+            session->pending_job->cancel();
+    }
 }
 
 }
@@ -12,6 +12,8 @@
 #include <ImageDecoder/ImageDecoderServerEndpoint.h>
 #include <LibGfx/BitmapSequence.h>
 #include <LibGfx/ColorSpace.h>
+#include <LibGfx/ImageFormats/ImageDecoder.h>
+#include <LibGfx/ShareableBitmap.h>
 #include <LibIPC/ConnectionFromClient.h>
 #include <LibThreading/BackgroundAction.h>
 
@@ -26,31 +28,102 @@ public:
 
     virtual void die() override;
 
+    // The decoder of an animated image whose frames are decoded on demand, along with the encoded data it decodes from.
+    struct AnimationDecoder {
+        Core::AnonymousBuffer encoded_buffer;
+        NonnullRefPtr<Gfx::ImageDecoder> decoder;
+    };
+
     struct DecodeResult {
         bool is_animated = false;
         u32 loop_count = 0;
+        u32 frame_count = 0;
+        Gfx::IntSize natural_size;
         Gfx::FloatPoint scale { 1, 1 };
         Gfx::BitmapSequence bitmaps;
         Vector<u32> durations;
         Gfx::ColorSpace color_profile;
+        OwnPtr<AnimationDecoder> animation_decoder;
+    };
+
+    struct AnimationFrames {
+        Gfx::BitmapSequence bitmaps;
+        Vector<u32> durations;
+        NonnullOwnPtr<AnimationDecoder> animation_decoder;
+    };
+
+    struct PartialImage {
+        Gfx::ShareableBitmap bitmap;
+        Gfx::ColorSpace color_profile;
+
+        // The decoder is handed back once it has decoded what it could, so that it can pick up from there next time.
+        OwnPtr<Gfx::IncrementalImageDecoder> decoder;
     };
 
 private:
     using Job = Threading::BackgroundAction<DecodeResult>;
+    using FrameJob = Threading::BackgroundAction<AnimationFrames>;
+    using PartialJob = Threading::BackgroundAction<PartialImage>;
+
+    struct FrameRequest {
+        u32 start_frame_index { 0 };
+        u32 count { 0 };
+    };
+
+    // An animated image that the client is decoding frames of as it needs them.
+    struct AnimationSession {
+        // NOTE: This is null while a frame job is using the decoder on the background thread.
+        OwnPtr<AnimationDecoder> animation_decoder;
+        Optional<Gfx::IntSize> ideal_size;
+        RefPtr<FrameJob> pending_job;
+        Optional<FrameRequest> queued_request;
+    };
+
+    // An image whose encoded data the client is still sending us, e.g. as it's being downloaded. Now and then, we decode
+    // what we can of it, so that the client can show that in the meantime.
+    struct IncrementalDecode {
+        Optional<ByteString> mime_type;
+
+        // The client appends the encoded data to a buffer that it shares with us, and tells us how much of it there is.
+        // When the buffer runs out of room, the client sends us a larger one with the data copied over.
+        Core::AnonymousBuffer encoded_buffer;
+        size_t encoded_size { 0 };
+
+        // NOTE: The decoder is null while a partial job is using it on the background thread, and once we've found that
+        //       the image can't be shown in part.
+        OwnPtr<Gfx::IncrementalImageDecoder> decoder;
+        bool can_decode_partially { true };
+        size_t size_at_last_partial_decode { 0 };
+        RefPtr<PartialJob> pending_job;
+    };
+
+    // The decoder picks up where it left off, but handing the client what we have of the image means copying all of it,
+    // so we wait for its data to have grown by this much, or by a quarter, whichever is more, before doing so again.
+    static constexpr size_t minimum_growth_between_partial_decodes = 32 * KiB;
 
     explicit ConnectionFromClient(NonnullOwnPtr<IPC::Transport>);
 
-    virtual Messages::ImageDecoderServer::DecodeImageResponse decode_image(Core::AnonymousBuffer, Optional<Gfx::IntSize> ideal_size, Optional<ByteString> mime_type) override;
+    virtual Messages::ImageDecoderServer::DecodeImageResponse decode_image(Core::AnonymousBuffer, Optional<Gfx::IntSize> ideal_size, Optional<ByteString> mime_type, bool decode_animation_frames_lazily) override;
     virtual void cancel_decoding(i64 image_id) override;
+    virtual void start_incremental_decode(i64 image_id, Optional<ByteString> mime_type) override;
+    virtual void set_encoded_data_buffer(i64 image_id, Core::AnonymousBuffer) override;
+    virtual void did_append_encoded_data(i64 image_id, u64 encoded_size) override;
+    virtual void finish_incremental_decode(i64 image_id, Optional<Gfx::IntSize> ideal_size, bool decode_animation_frames_lazily) override;
+    virtual void decode_animation_frames(i64 image_id, u32 start_frame_index, u32 count) override;
+    virtual void end_animation_session(i64 image_id) override;
     virtual Messages::ImageDecoderServer::ConnectNewClientsResponse connect_new_clients(size_t count) override;
     virtual Messages::ImageDecoderServer::InitTransportResponse init_transport(int peer_pid) override;
 
     ErrorOr<IPC::File> connect_new_client();
 
-    NonnullRefPtr<Job> make_decode_image_job(i64 image_id, Core::AnonymousBuffer, Optional<Gfx::IntSize> ideal_size, Optional<ByteString> mime_type);
+    NonnullRefPtr<Job> make_decode_image_job(i64 image_id, Core::AnonymousBuffer, size_t encoded_size, Optional<Gfx::IntSize> ideal_size, Optional<ByteString> mime_type, bool decode_animation_frames_lazily);
+    void start_frame_job(i64 image_id, AnimationSession&, FrameRequest);
+    void start_partial_job_if_needed(i64 image_id, IncrementalDecode&);
 
     i64 m_next_image_id { 0 };
     HashMap<i64, NonnullRefPtr<Job>> m_pending_jobs;
+    HashMap<i64, AnimationSession> m_animation_sessions;
+    HashMap<i64, IncrementalDecode> m_incremental_decodes;
 };
 
 }
@@ -0,0 +1,47 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibTest/TestCase.h>
+
+#include <AK/FindFirstOfASCII.h>
+#include <AK/StringView.h>
+#include <AK/Utf16View.h>
+
+static ReadonlySpan<char> needles(StringView characters)
+{
+    return { characters.characters_without_null_termination(), characters.length() };
+}
+
+TEST_CASE(bytes)
+{
+    auto haystack = "The quick brown fox jumps over the lazy dog <and then some>"sv.bytes();
+
+    EXPECT_EQ(find_first_of_ascii(haystack, 0, needles("<"sv)), 44u);
+    EXPECT_EQ(find_first_of_ascii(haystack, 0, needles("<&z"sv)), 37u);
+    EXPECT_EQ(find_first_of_ascii(haystack, 45, needles("<>"sv)), 58u);
+    EXPECT_EQ(find_first_of_ascii(haystack, 59, needles("<>"sv)), OptionalNone {});
+    EXPECT_EQ(find_first_of_ascii(haystack, 0, needles("#"sv)), OptionalNone {});
+}
+
+TEST_CASE(match_in_every_lane)
+{
+    Array<u8, 37> haystack;
+    for (size_t position = 0; position < haystack.size(); ++position) {
+        haystack.fill('a');
+        haystack[position] = '\n';
+        EXPECT_EQ(find_first_of_ascii(ReadonlyBytes { haystack }, 0, needles("\n"sv)), position);
+        EXPECT_EQ(find_first_of_ascii(ReadonlyBytes { haystack }, position + 1, needles("\n"sv)), OptionalNone {});
+    }
+}
+
+TEST_CASE(utf16)
+{
+    // U+0161 shares its low byte with 'a', which must not count as a match.
+    Utf16View view { u"šššššššššša"sv };
+
+    EXPECT_EQ(find_first_of_ascii(view.utf16_span(), 0, needles("a"sv)), 10u);
+    EXPECT_EQ(find_first_of_ascii(view.utf16_span(), 0, needles("b"sv)), OptionalNone {});
+}
@@ -366,6 +366,35 @@ TEST_CASE(test_jpeg_grayscale_with_weird_mcu_and_reset_marker)
     TRY_OR_FAIL(expect_single_frame_of_size(*plugin_decoder, { 320, 240 }));
 }
 
+TEST_CASE(test_jpeg_ideal_size)
+{
+    auto file = TRY_OR_FAIL(Core::MappedFile::map(TEST_INPUT("jpg/several_scans.jpg"sv)));
+    auto plugin_decoder = TRY_OR_FAIL(Gfx::JPEGImageDecoderPlugin::create(file->bytes()));
+
+    EXPECT_EQ(plugin_decoder->size(), Gfx::IntSize(592, 800));
+    auto frame = TRY_OR_FAIL(plugin_decoder->frame(0, Gfx::IntSize { 140, 190 }));
+    EXPECT_EQ(frame.image->size(), Gfx::IntSize(148, 200));
+    EXPECT_EQ(plugin_decoder->size(), Gfx::IntSize(592, 800));
+}
+
+TEST_CASE(test_jpeg_incremental_decode)
+{
+    auto file = TRY_OR_FAIL(Core::MappedFile::map(TEST_INPUT("jpg/several_scans.jpg"sv)));
+    auto decoder = TRY_OR_FAIL(Gfx::IncrementalImageDecoder::try_create_for_format_of(file->bytes()));
+    EXPECT(decoder);
+
+    TRY_OR_FAIL(decoder->decode_more(file->bytes().trim(file->size() / 4)));
+    TRY_OR_FAIL(decoder->decode_more(file->bytes().trim(file->size() / 2)));
+    auto bitmap = decoder->bitmap();
+    EXPECT(bitmap);
+    EXPECT_EQ(bitmap->size(), Gfx::IntSize(592, 800));
+
+    TRY_OR_FAIL(decoder->decode_more(file->bytes()));
+    auto plugin_decoder = TRY_OR_FAIL(Gfx::JPEGImageDecoderPlugin::create(file->bytes()));
+    auto frame = TRY_OR_FAIL(plugin_decoder->frame(0));
+    EXPECT_EQ(decoder->bitmap()->get_pixel(296, 400), frame.image->get_pixel(296, 400));
+}
+
 TEST_CASE(test_jpeg_malformed_header)
 {
     Array test_inputs = {
@@ -404,6 +433,35 @@ TEST_CASE(test_png)
     TRY_OR_FAIL(expect_single_frame(*plugin_decoder));
 }
 
+TEST_CASE(test_png_ideal_size)
+{
+    auto file = TRY_OR_FAIL(Core::MappedFile::map(TEST_INPUT("png/buggie.png"sv)));
+    auto plugin_decoder = TRY_OR_FAIL(Gfx::PNGImageDecoderPlugin::create(file->bytes()));
+
+    auto frame = TRY_OR_FAIL(plugin_decoder->frame(0, Gfx::IntSize { 32, 69 }));
+    EXPECT_EQ(frame.image->size(), Gfx::IntSize(32, 69));
+    EXPECT_EQ(plugin_decoder->size(), Gfx::IntSize(64, 138));
+}
+
+TEST_CASE(test_png_incremental_decode)
+{
+    auto file = TRY_OR_FAIL(Core::MappedFile::map(TEST_INPUT("png/buggie.png"sv)));
+    auto decoder = TRY_OR_FAIL(Gfx::IncrementalImageDecoder::try_create_for_format_of(file->bytes()));
+    EXPECT(decoder);
+
+    TRY_OR_FAIL(decoder->decode_more(file->bytes().trim(file->size() / 4)));
+    TRY_OR_FAIL(decoder->decode_more(file->bytes().trim(file->size() / 2)));
+    auto bitmap = decoder->bitmap();
+    EXPECT(bitmap);
+    EXPECT_EQ(bitmap->size(), Gfx::IntSize(64, 138));
+    EXPECT_EQ(bitmap->get_pixel(32, 137).alpha(), 0);
+
+    TRY_OR_FAIL(decoder->decode_more(file->bytes()));
+    auto plugin_decoder = TRY_OR_FAIL(Gfx::PNGImageDecoderPlugin::create(file->bytes()));
+    auto frame = TRY_OR_FAIL(plugin_decoder->frame(0));
+    EXPECT_EQ(decoder->bitmap()->get_pixel(32, 137), frame.image->get_pixel(32, 137));
+}
+
 TEST_CASE(test_apng)
 {
     auto file = TRY_OR_FAIL(Core::MappedFile::map(TEST_INPUT("png/apng-1-frame.png"sv)));
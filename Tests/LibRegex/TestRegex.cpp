@@ -1379,3 +1379,88 @@ TEST_CASE(account_for_opcode_size_calculating_incoming_jump_edges)
         EXPECT_EQ(result.matches.first().view.to_byte_string(), "aa"sv);
     }
 }
+
+TEST_CASE(literal_prefilter)
+{
+    struct Test {
+        StringView pattern;
+        StringView subject;
+        size_t expected_match_count;
+    };
+
+    Array tests {
+        // Literal prefix, spanning several vector-sized chunks.
+        Test { "needle"sv, "haystack haystack haystack haystack needle haystack needle"sv, 2u },
+        Test { "needle"sv, "haystack haystack haystack haystack needl"sv, 0u },
+        Test { "ne+dle"sv, "nedle neeeedle nedl needle"sv, 3u },
+        // Partial prefix matches should not be skipped over.
+        Test { "aab"sv, "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaab"sv, 1u },
+        // Small sets of starting characters.
+        Test { "[xyz]\\d"sv, "aaaaaaaaaaaaaaaaaaaaaaaa x1 bbbbbbbbbbbbbbbbbbbbbbbbbbbb y2 z"sv, 2u },
+        Test { "(?:foo|bar)"sv, "------------------------------foo----------------bar"sv, 2u },
+        // Captures and lookaheads in front of the literal.
+        Test { "(ab)c"sv, "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxabcxxxabc"sv, 2u },
+        Test { "(?=ab)abc"sv, "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxabcxxxabd"sv, 1u },
+        // A later anchor must not turn the prefix into a start-of-line match.
+        Test { "a^b"sv, "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxab"sv, 0u },
+    };
+
+    auto options = ECMAScriptOptions { ECMAScriptFlags::Global };
+    options.reset_flag((ECMAScriptFlags)regex::AllFlags::Internal_Stateful);
+
+    for (auto& test : tests) {
+        Regex<ECMA262> re(test.pattern, options);
+        EXPECT_EQ(re.match(test.subject).matches.size(), test.expected_match_count);
+
+        auto subject = Utf16String::from_utf8(test.subject);
+        EXPECT_EQ(re.match(Utf16View { subject }).matches.size(), test.expected_match_count);
+    }
+
+    {
+        // Non-ASCII code units in a UTF-16 subject around the candidate position.
+        Regex<ECMA262> re("ab"sv, options);
+        auto subject = Utf16String::from_utf8("éééééééééééabéab"sv);
+        auto result = re.match(Utf16View { subject });
+        EXPECT_EQ(result.matches.size(), 2u);
+        EXPECT_EQ(result.matches[0].column, 11u);
+    }
+}
+
+TEST_CASE(required_literal_prefilter)
+{
+    struct Test {
+        StringView pattern;
+        Optional<StringView> expected_required_literal;
+        StringView subject;
+        size_t expected_match_count;
+    };
+
+    Array tests {
+        // Literals that every match contains somewhere after its start.
+        Test { "\\w+@example\\.com"sv, "@example.com"sv, "bob@example.com, alice@example.org, carol@example.com"sv, 2u },
+        Test { "[a-z]+ing\\b"sv, "ing"sv, "sing a song of singing, ingot"sv, 2u },
+        Test { "(?:cat|dog)food"sv, "food"sv, "catfood dogfood birdfood"sv, 2u },
+        Test { "\\d+px"sv, "px"sv, "10px 2em 300px"sv, 2u },
+        Test { "\\d+px"sv, "px"sv, "1111111111111111111111111111111111111111111111111111111111111111 px"sv, 0u },
+        Test { "a(?:bc)+d"sv, "abc"sv, "xxabcbcdxx abcd abd"sv, 2u },
+        // Nothing that every match has to contain.
+        Test { "foo|bar"sv, OptionalNone {}, "foo bar baz"sv, 2u },
+        Test { "(?!foo)\\w+bar"sv, OptionalNone {}, "foobar xbar"sv, 2u },
+    };
+
+    auto options = ECMAScriptOptions { ECMAScriptFlags::Global };
+    options.reset_flag((ECMAScriptFlags)regex::AllFlags::Internal_Stateful);
+
+    for (auto& test : tests) {
+        Regex<ECMA262> re(test.pattern, options);
+        auto const& required_literal = re.parser_result.optimization_data.required_literal;
+        EXPECT_EQ(required_literal.has_value(), test.expected_required_literal.has_value());
+        if (required_literal.has_value() && test.expected_required_literal.has_value())
+            EXPECT_EQ(required_literal->view(), *test.expected_required_literal);
+
+        EXPECT_EQ(re.match(test.subject).matches.size(), test.expected_match_count);
+
+        auto subject = Utf16String::from_utf8(test.subject);
+        EXPECT_EQ(re.match(Utf16View { subject }).matches.size(), test.expected_match_count);
+    }
+}
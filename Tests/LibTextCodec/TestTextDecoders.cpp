@@ -4,7 +4,10 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/Array.h>
 #include <AK/String.h>
+#include <AK/StringBuilder.h>
+#include <AK/Utf16View.h>
 #include <AK/Vector.h>
 #include <LibTest/TestCase.h>
 #include <LibTextCodec/Decoder.h>
@@ -48,3 +51,63 @@ TEST_CASE(test_utf16le_decode)
     auto utf8 = MUST(decoder.to_utf8(test_string));
     EXPECT_EQ(utf8, "säk😀"sv);
 }
+
+static String decode_in_chunks(StringView encoding, StringView input, size_t chunk_size)
+{
+    auto decoder = TextCodec::decoder_for_exact_name(encoding);
+    VERIFY(decoder.has_value());
+
+    TextCodec::DecoderStreamState state;
+    StringBuilder builder;
+    for (size_t offset = 0; offset < input.length(); offset += chunk_size) {
+        auto chunk = input.substring_view(offset, min(chunk_size, input.length() - offset));
+        MUST(decoder->decode_chunk_into(state, chunk, builder, false));
+    }
+    MUST(decoder->decode_chunk_into(state, {}, builder, true));
+    return builder.to_string_without_validation();
+}
+
+TEST_CASE(test_single_byte_decode_into)
+{
+    auto decoder = TextCodec::decoder_for_exact_name("windows-1251"sv);
+    VERIFY(decoder.has_value());
+
+    // "Hi, Привет!" in windows-1251
+    auto test_string = "Hi, \xcf\xf0\xe8\xe2\xe5\xf2!"sv;
+
+    StringBuilder utf8_builder;
+    MUST(decoder->decode_into(test_string, utf8_builder));
+    EXPECT_EQ(utf8_builder.string_view(), "Hi, Привет!"sv);
+
+    StringBuilder utf16_builder(StringBuilder::Mode::UTF16);
+    MUST(decoder->decode_into(test_string, utf16_builder));
+    EXPECT_EQ(utf16_builder.utf16_string_view(), u"Hi, Привет!"sv);
+}
+
+TEST_CASE(test_streaming_decode)
+{
+    // Every split point must produce the same output as decoding the input in one go.
+    struct TestCase {
+        StringView encoding;
+        StringView input;
+        StringView expected;
+    };
+    Array test_cases {
+        TestCase { "utf-8"sv, "a\xc3\xa4\xe2\x82\xac\xf0\x9f\x98\x80z"sv, "aä€😀z"sv },
+        TestCase { "utf-16le"sv, "s\x00\xe4\x00=\xd8\x00\xde"sv, "sä😀"sv },
+        TestCase { "utf-16be"sv, "\x00s\xd8=\xde\x00"sv, "s😀"sv },
+        TestCase { "shift_jis"sv, "a\x82\xa0\x88\x9f"sv, "aあ亜"sv },
+        TestCase { "gb18030"sv, "a\x81\x30\x81\x30\xc4\xe3"sv, "a\xc2\x80你"sv },
+        TestCase { "euc-jp"sv, "\x8f\xb0\xa1\xa4\xa2"sv, "丂あ"sv },
+        TestCase { "iso-2022-jp"sv, "a\x1b$B$\"\x1b(Bb"sv, "aあb"sv },
+    };
+
+    for (auto const& test_case : test_cases) {
+        auto decoder = TextCodec::decoder_for_exact_name(test_case.encoding);
+        VERIFY(decoder.has_value());
+        EXPECT_EQ(MUST(decoder->to_utf8(test_case.input)), test_case.expected);
+
+        for (size_t chunk_size = 1; chunk_size <= test_case.input.length(); ++chunk_size)
+            EXPECT_EQ(decode_in_chunks(test_case.encoding, test_case.input, chunk_size), test_case.expected);
+    }
+}
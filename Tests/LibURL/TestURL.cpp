@@ -263,6 +263,47 @@ TEST_CASE(equality)
     EXPECT_NE(URL::Parser::basic_parse("http://serenityos.org/index.html"sv), URL::Parser::basic_parse("http://serenityos.org/test.html"sv));
 }
 
+TEST_CASE(canonical_ascii_url)
+{
+    // These URLs are serialized exactly as written, so each component is a slice of the input.
+    {
+        auto url = URL::Parser::basic_parse("https://example.com:8080/path/to/script.js?v=2&x=y#section?a#b"sv);
+        EXPECT(url.has_value());
+        EXPECT_EQ(url->scheme(), "https");
+        EXPECT_EQ(url->serialized_host(), "example.com");
+        EXPECT_EQ(url->port_or_default(), 8080);
+        EXPECT_EQ(url->path_segment_count(), 3u);
+        EXPECT_EQ(url->serialize_path(), "/path/to/script.js");
+        EXPECT_EQ(url->query(), "v=2&x=y");
+        EXPECT_EQ(url->fragment(), "section?a#b");
+        EXPECT_EQ(url->serialize(), "https://example.com:8080/path/to/script.js?v=2&x=y#section?a#b");
+        EXPECT_EQ(url->serialize(URL::ExcludeFragment::Yes), "https://example.com:8080/path/to/script.js?v=2&x=y");
+    }
+    {
+        auto url = URL::Parser::basic_parse("http://example.com?q"sv);
+        EXPECT(url.has_value());
+        EXPECT_EQ(url->serialize_path(), "/");
+        EXPECT_EQ(url->query(), "q");
+        EXPECT_EQ(url->serialize(), "http://example.com/?q");
+    }
+
+    // These look similar, but are not serialized as written.
+    EXPECT_EQ(URL::Parser::basic_parse("http://example.com:80/"sv)->serialize(), "http://example.com/");
+    EXPECT_EQ(URL::Parser::basic_parse("http://example.com:080/"sv)->serialize(), "http://example.com/");
+    EXPECT_EQ(URL::Parser::basic_parse("http://example.com:/"sv)->serialize(), "http://example.com/");
+    EXPECT_EQ(URL::Parser::basic_parse("http://0x7f.1/"sv)->serialize(), "http://127.0.0.1/");
+    EXPECT_EQ(URL::Parser::basic_parse("http://example.com/a/./b/../c"sv)->serialize(), "http://example.com/a/c");
+    EXPECT_EQ(URL::Parser::basic_parse("http://example.com/a\\b"sv)->serialize(), "http://example.com/a/b");
+    EXPECT_EQ(URL::Parser::basic_parse("http://example.com/{a}?'#`"sv)->serialize(), "http://example.com/%7Ba%7D?%27#%60");
+
+    // Modifying a parsed URL must not leave a stale serialization behind.
+    auto url = URL::Parser::basic_parse("https://example.com/index.html#top"sv).release_value();
+    url.set_query("a=b"_string);
+    EXPECT_EQ(url.serialize(), "https://example.com/index.html?a=b#top");
+    url.set_fragment({});
+    EXPECT_EQ(url.serialize(), "https://example.com/index.html?a=b");
+}
+
 #ifndef AK_OS_WINDOWS
 TEST_CASE(create_with_file_scheme)
 {
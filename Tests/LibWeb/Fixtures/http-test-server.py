@@ -17,6 +17,7 @@ Description:
 
 Endpoints:
     - POST /echo <json body>, Creates an echo response for later use. See "Echo" class below for body properties.
+    - GET /echo-hits/<path>, Returns how many times the echo response for GET <path> has been requested.
 """
 
 
@@ -28,6 +29,7 @@ class Echo:
     body: Optional[str]
     delay_ms: Optional[int]
     reason_phrase: Optional[str]
+    hits: int
 
 
 # In-memory store for echo responses
@@ -43,6 +45,8 @@ class TestHTTPRequestHandler(http.server.SimpleHTTPRequestHandler):
             # Remove "/static/" prefix and use built-in method
             self.path = self.path[7:]
             return super().do_GET()
+        elif self.path.startswith("/echo-hits/"):
+            self.handle_echo_hits()
         else:
             self.handle_echo()
 
@@ -60,6 +64,7 @@ class TestHTTPRequestHandler(http.server.SimpleHTTPRequestHandler):
             echo.delay_ms = data.get("delay_ms", None)
             echo.headers = data.get("headers", None)
             echo.reason_phrase = data.get("reason_phrase", None)
+            echo.hits = 0
 
             is_using_reserved_path = echo.path.startswith("/static") or echo.path.startswith("/echo")
 
@@ -125,6 +130,7 @@ class TestHTTPRequestHandler(http.server.SimpleHTTPRequestHandler):
 
         if key in echo_store:
             echo = echo_store[key]
+            echo.hits += 1
 
             if echo.delay_ms is not None:
                 time.sleep(echo.delay_ms / 1000)
@@ -143,6 +149,19 @@ class TestHTTPRequestHandler(http.server.SimpleHTTPRequestHandler):
         else:
             self.send_error(404, f"Echo response not found for {key}")
 
+    def handle_echo_hits(self):
+        key = f"GET {self.path[len('/echo-hits'):]}"
+
+        if key not in echo_store:
+            self.send_error(404, f"Echo response not found for {key}")
+            return
+
+        self.send_response(200)
+        self.send_header("Access-Control-Allow-Origin", "*")
+        self.send_header("Content-Type", "application/json")
+        self.end_headers()
+        self.wfile.write(json.dumps({"hits": echo_store[key].hits}).encode("utf-8"))
+
     def do_other(self):
         if self.path.startswith("/static/"):
             self.send_error(405, "Method Not Allowed")
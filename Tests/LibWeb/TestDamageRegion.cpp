@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibTest/TestCase.h>
+#include <LibWeb/Painting/DamageRegion.h>
+
+namespace Web::Painting {
+
+TEST_CASE(empty)
+{
+    DamageRegion region;
+    EXPECT(region.is_empty());
+    EXPECT(!region.is_everything());
+    EXPECT_EQ(region.area(), 0u);
+
+    region.add({ 10, 10, 0, 5 });
+    EXPECT(region.is_empty());
+}
+
+TEST_CASE(disjoint_rects_are_kept_apart)
+{
+    DamageRegion region;
+    region.add({ 0, 0, 10, 10 });
+    region.add({ 100, 100, 10, 10 });
+    EXPECT_EQ(region.rects().size(), 2u);
+    EXPECT_EQ(region.area(), 200u);
+}
+
+TEST_CASE(contained_rects_are_ignored)
+{
+    DamageRegion region;
+    region.add({ 0, 0, 100, 100 });
+    region.add({ 10, 10, 10, 10 });
+    EXPECT_EQ(region.rects().size(), 1u);
+    EXPECT_EQ(region.rects()[0], Gfx::IntRect(0, 0, 100, 100));
+}
+
+TEST_CASE(overlapping_rects_are_merged)
+{
+    DamageRegion region;
+    region.add({ 0, 0, 10, 10 });
+    region.add({ 20, 0, 10, 10 });
+    region.add({ 5, 5, 20, 10 });
+    EXPECT_EQ(region.rects().size(), 1u);
+    EXPECT_EQ(region.rects()[0], Gfx::IntRect(0, 0, 30, 15));
+}
+
+TEST_CASE(number_of_rects_is_bounded)
+{
+    DamageRegion region;
+    for (int i = 0; i < 100; ++i)
+        region.add({ i * 20, 0, 10, 10 });
+    EXPECT(region.rects().size() <= 8u);
+
+    Gfx::IntRect bounding_rect;
+    for (auto const& rect : region.rects())
+        bounding_rect = bounding_rect.is_empty() ? rect : bounding_rect.united(rect);
+    EXPECT_EQ(bounding_rect, Gfx::IntRect(0, 0, 1990, 10));
+}
+
+TEST_CASE(everything)
+{
+    DamageRegion region;
+    region.add({ 0, 0, 10, 10 });
+    region.add_everything();
+    EXPECT(region.is_everything());
+    EXPECT(!region.is_empty());
+
+    region.add({ 0, 0, 10, 10 });
+    EXPECT(region.rects().is_empty());
+
+    region.clear();
+    EXPECT(region.is_empty());
+    EXPECT(DamageRegion::everything().is_everything());
+}
+
+}
@@ -251,6 +251,78 @@ TEST_CASE(doctype)
     EXPECT_END_TAG_TOKEN(html, 23u, 27u);
 }
 
+TEST_CASE(non_ascii_text_and_attribute_value)
+{
+    auto tokens = run_tokenizer("<p foo=\"bäz\">héllo</p>"sv);
+    BEGIN_ENUMERATION(tokens);
+    EXPECT_START_TAG_TOKEN(p, 1u, 12u);
+    EXPECT_TAG_TOKEN_ATTRIBUTE_COUNT(1);
+    EXPECT_TAG_TOKEN_ATTRIBUTE(foo, "bäz", 3u, 6u, 7u, 12u);
+    EXPECT_CHARACTER_TOKEN('h');
+    EXPECT_CHARACTER_TOKEN(0xE9);
+    EXPECT_CHARACTER_TOKENS(llo);
+    EXPECT_END_TAG_TOKEN(p, 20u, 21u);
+    EXPECT_END_OF_FILE_TOKEN();
+    END_ENUMERATION();
+}
+
+TEST_CASE(long_text_run)
+{
+    StringBuilder builder;
+    for (size_t i = 0; i < 100; ++i)
+        builder.append("éx"sv);
+    auto tokens = run_tokenizer(builder.string_view());
+    BEGIN_ENUMERATION(tokens);
+    for (size_t i = 0; i < 100; ++i) {
+        EXPECT_CHARACTER_TOKEN(0xE9);
+        EXPECT_CHARACTER_TOKEN('x');
+    }
+    EXPECT_END_OF_FILE_TOKEN();
+    END_ENUMERATION();
+}
+
+TEST_CASE(insert_input_at_insertion_point)
+{
+    Tokenizer tokenizer { "<p>\n</p>"sv, "UTF-8"sv };
+    auto token = tokenizer.next_token();
+    EXPECT(token.has_value() && token->is_start_tag());
+    tokenizer.update_insertion_point();
+
+    // Lots of small insertions that are tokenized right away, like document.write() does.
+    for (size_t i = 0; i < 10000; ++i) {
+        tokenizer.insert_input_at_insertion_point("x"sv);
+        token = tokenizer.next_token(Tokenizer::StopAtInsertionPoint::Yes);
+        EXPECT(token.has_value() && token->is_character() && token->code_point() == 'x');
+        EXPECT(!tokenizer.next_token(Tokenizer::StopAtInsertionPoint::Yes).has_value());
+    }
+
+    // Insertions that are tokenized along with the rest of the input afterwards. The CR at the end of the inserted
+    // input pairs up with the LF after the insertion point.
+    tokenizer.insert_input_at_insertion_point("<i>"sv);
+    tokenizer.insert_input_at_insertion_point("a\r"sv);
+    tokenizer.undefine_insertion_point();
+
+    Vector<Token> tokens;
+    while (true) {
+        auto maybe_token = tokenizer.next_token();
+        if (!maybe_token.has_value())
+            break;
+        tokens.append(maybe_token.release_value());
+    }
+
+    BEGIN_ENUMERATION(tokens);
+    EXPECT_EQ(current_token->type(), Token::Type::StartTag);
+    EXPECT_EQ(current_token->tag_name(), "i"sv);
+    NEXT_TOKEN();
+    EXPECT_CHARACTER_TOKEN('a');
+    EXPECT_CHARACTER_TOKEN('\n');
+    EXPECT_EQ(current_token->type(), Token::Type::EndTag);
+    EXPECT_EQ(current_token->tag_name(), "p"sv);
+    NEXT_TOKEN();
+    EXPECT_END_OF_FILE_TOKEN();
+    END_ENUMERATION();
+}
+
 // NOTE: This relies on the format of HTMLToken::to_string() staying the same.
 //       If that changes, or something is added to the test HTML, the hash needs to be adjusted.
 TEST_CASE(regression)
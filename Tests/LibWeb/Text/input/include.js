@@ -119,6 +119,13 @@ class HTTPTestServer {
         }
         return `${this.baseURL}${path}`;
     }
+    async getHitCount(path) {
+        const result = await fetch(`${this.baseURL}/echo-hits${path}`);
+        if (!result.ok) {
+            throw new Error("Error getting hit count: " + result.statusText);
+        }
+        return (await result.json()).hits;
+    }
     getStaticURL(path) {
         return `${this.baseURL}/static/${path}`;
     }